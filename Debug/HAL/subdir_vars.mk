@@ -7,26 +7,146 @@ SHELL = cmd.exe
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
 ../HAL/UART_API.c \
-../HAL/switch.c 
+../HAL/switch.c \
+../HAL/UART_DMA.c \
+../HAL/arq.c \
+../HAL/baud.c \
+../HAL/bench.c \
+../HAL/clock.c \
+../HAL/crc.c \
+../HAL/cycle_counter.c \
+../HAL/frag.c \
+../HAL/link.c \
+../HAL/log.c \
+../HAL/lz.c \
+../HAL/net.c \
+../HAL/ping.c \
+../HAL/power.c \
+../HAL/profile.c \
+../HAL/ring_buffer.c \
+../HAL/sched.c \
+../HAL/timebase.c \
+../HAL/trace.c \
+../HAL/xfer.c 
 
 C_DEPS += \
 ./HAL/UART_API.d \
-./HAL/switch.d 
+./HAL/switch.d \
+./HAL/UART_DMA.d \
+./HAL/arq.d \
+./HAL/baud.d \
+./HAL/bench.d \
+./HAL/clock.d \
+./HAL/crc.d \
+./HAL/cycle_counter.d \
+./HAL/frag.d \
+./HAL/link.d \
+./HAL/log.d \
+./HAL/lz.d \
+./HAL/net.d \
+./HAL/ping.d \
+./HAL/power.d \
+./HAL/profile.d \
+./HAL/ring_buffer.d \
+./HAL/sched.d \
+./HAL/timebase.d \
+./HAL/trace.d \
+./HAL/xfer.d 
 
 OBJS += \
 ./HAL/UART_API.obj \
-./HAL/switch.obj 
+./HAL/switch.obj \
+./HAL/UART_DMA.obj \
+./HAL/arq.obj \
+./HAL/baud.obj \
+./HAL/bench.obj \
+./HAL/clock.obj \
+./HAL/crc.obj \
+./HAL/cycle_counter.obj \
+./HAL/frag.obj \
+./HAL/link.obj \
+./HAL/log.obj \
+./HAL/lz.obj \
+./HAL/net.obj \
+./HAL/ping.obj \
+./HAL/power.obj \
+./HAL/profile.obj \
+./HAL/ring_buffer.obj \
+./HAL/sched.obj \
+./HAL/timebase.obj \
+./HAL/trace.obj \
+./HAL/xfer.obj 
 
 OBJS__QUOTED += \
 "HAL\UART_API.obj" \
-"HAL\switch.obj" 
+"HAL\switch.obj" \
+"HAL\UART_DMA.obj" \
+"HAL\arq.obj" \
+"HAL\baud.obj" \
+"HAL\bench.obj" \
+"HAL\clock.obj" \
+"HAL\crc.obj" \
+"HAL\cycle_counter.obj" \
+"HAL\frag.obj" \
+"HAL\link.obj" \
+"HAL\log.obj" \
+"HAL\lz.obj" \
+"HAL\net.obj" \
+"HAL\ping.obj" \
+"HAL\power.obj" \
+"HAL\profile.obj" \
+"HAL\ring_buffer.obj" \
+"HAL\sched.obj" \
+"HAL\timebase.obj" \
+"HAL\trace.obj" \
+"HAL\xfer.obj" 
 
 C_DEPS__QUOTED += \
 "HAL\UART_API.d" \
-"HAL\switch.d" 
+"HAL\switch.d" \
+"HAL\UART_DMA.d" \
+"HAL\arq.d" \
+"HAL\baud.d" \
+"HAL\bench.d" \
+"HAL\clock.d" \
+"HAL\crc.d" \
+"HAL\cycle_counter.d" \
+"HAL\frag.d" \
+"HAL\link.d" \
+"HAL\log.d" \
+"HAL\lz.d" \
+"HAL\net.d" \
+"HAL\ping.d" \
+"HAL\power.d" \
+"HAL\profile.d" \
+"HAL\ring_buffer.d" \
+"HAL\sched.d" \
+"HAL\timebase.d" \
+"HAL\trace.d" \
+"HAL\xfer.d" 
 
 C_SRCS__QUOTED += \
 "../HAL/UART_API.c" \
-"../HAL/switch.c" 
+"../HAL/switch.c" \
+"../HAL/UART_DMA.c" \
+"../HAL/arq.c" \
+"../HAL/baud.c" \
+"../HAL/bench.c" \
+"../HAL/clock.c" \
+"../HAL/crc.c" \
+"../HAL/cycle_counter.c" \
+"../HAL/frag.c" \
+"../HAL/link.c" \
+"../HAL/log.c" \
+"../HAL/lz.c" \
+"../HAL/net.c" \
+"../HAL/ping.c" \
+"../HAL/power.c" \
+"../HAL/profile.c" \
+"../HAL/ring_buffer.c" \
+"../HAL/sched.c" \
+"../HAL/timebase.c" \
+"../HAL/trace.c" \
+"../HAL/xfer.c" 
 
 
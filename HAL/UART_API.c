@@ -17,191 +17,2098 @@
  *                                 Includes                                    *
  *******************************************************************************/
 #include "HAL/UART_API.h"
+#include "inc/hw_types.h"
+#include "inc/hw_uart.h"
 #include "HAL/switch.h"
+#include "HAL/UART_DMA.h"
+#include "HAL/power.h"
+#include "HAL/sched.h"
+#include "HAL/frag.h"
+#include "HAL/net.h"
+#include "HAL/profile.h"
+#include "HAL/trace.h"
+#include "HAL/log.h"
+#include "HAL/timebase.h"
 #include "string.h"
 
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* Characters typed and gathered before being sent as one fragment: a few in
+ * streaming mode, as many as a fragment carries in store and forward mode */
+#if (UART_STREAM_MODE == 1U)
+#define UART_SEND_SEGMENT_SIZE UART_STREAM_SEGMENT_SIZE
+#else
+#define UART_SEND_SEGMENT_SIZE FRAG_MAX_DATA
+#endif
+
+/* Characters gathered by the "Message Sent : " echo before being shown */
+#define UART_ECHO_BUFFER_SIZE MAX_UART_SEND_CHARS
+
+/* Characters of the message being typed shown on one terminal line after
+ * its label, longer messages go on below, so that the line fits in 80
+ * columns and can be erased and drawn again */
+#define UART_EDIT_LINE_SIZE 56U
+
+/* Characters of a received message held back while the message being
+ * typed is on the last terminal line, then shown above it as one line */
+#define UART_HELD_LINE_SIZE UART_EDIT_LINE_SIZE
+
+/* VT100 carriage return and erase line, known to the usual terminal programs */
+#define UART_ERASE_LINE "\r\033[K"
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Structure representing the software side of a UART module.
+ *              - base      : The UART module base address.
+ *              - interrupt : The UART interrupt number in the NVIC.
+ *              - rxRing    : Ring buffer filled by the UART ISR and drained by the states.
+ *              - txRing    : Ring buffer filled by the write functions and drained by the UART ISR.
+ *              - stats     : Traffic counters of the UART module.
+ *              - baudRate  : The baud rate the UART module runs at.
+ *              - bus       : The UART module is on an RS-485 bus in 9-bit mode.
+ *              - busDriving: The transceiver driver is enabled, a transmission is running.
+ *              - busDestination : The address byte sent ahead of every transmission.
+ */
+typedef struct
+{
+    uint32_t base;
+    uint32_t interrupt;
+    ringBuffer_t rxRing;
+    ringBuffer_t txRing;
+    uartStats_t stats;
+    uint32_t baudRate;
+    bool bus;
+    bool busDriving;
+    uint8_t busDestination;
+} uartChannel_t;
+
+/*
+ * Description: Enum describing the terminal line the cursor is at the end of.
+ *              - UART_LINE_FRESH  : An empty line.
+ *              - UART_LINE_LOCAL  : The line of the message being typed.
+ *              - UART_LINE_REMOTE : The line of a received message being shown.
+ */
+typedef enum
+{
+    UART_LINE_FRESH,
+    UART_LINE_LOCAL,
+    UART_LINE_REMOTE
+} uartLine_t;
+
+/*******************************************************************************
+ *                            Global Variables                                 *
+ *******************************************************************************/
+static volatile uint8_t uart0RxStorage[UART0_RX_BUFFER_SIZE];
+static volatile uint8_t uart1RxStorage[UART1_RX_BUFFER_SIZE];
+static volatile uint8_t uart0TxStorage[UART0_TX_BUFFER_SIZE];
+static volatile uint8_t uart1TxStorage[UART1_TX_BUFFER_SIZE];
+#if (UART3_LINK_MODE == 1U)
+static volatile uint8_t uart3RxStorage[UART3_RX_BUFFER_SIZE];
+static volatile uint8_t uart3TxStorage[UART3_TX_BUFFER_SIZE];
+#endif
+
+static uartChannel_t uart0Channel = {
+                .base = (uint32_t)UART0_MODULE ,
+                .interrupt = (uint32_t)INT_UART0
+};
+
+static uartChannel_t uart1Channel = {
+                .base = (uint32_t)UART1_MODULE ,
+                .interrupt = (uint32_t)INT_UART1
+};
+
+#if (UART3_LINK_MODE == 1U)
+static uartChannel_t uart3Channel = {
+                .base = (uint32_t)UART3_MODULE ,
+                .interrupt = (uint32_t)INT_UART3
+};
+#endif
+
+/* A message from another board is being shown, and the board it comes from */
+static bool messageReceiving = false;
+static uint8_t messageSource = NET_NO_ADDRESS;
+
+/* The label of the received messages, whether the next text shown needs
+ * it, and whether that text goes on with a message already partly shown */
+static logId_t remoteLabel = LOG_MESSAGE_RECEIVED;
+
+#if (UART_SHOW_TIMESTAMPS == 1U)
+/* The first fragment of the message shown, as described by FragReceive() */
+static fragPiece_t remoteStamp;
+#endif
+static bool remoteLabelDue = false;
+static bool remoteResumed = false;
+
+/* The terminal line the cursor is on. The message being typed keeps the
+ * last line: what a board sends meanwhile is held back, then shown above
+ * it, and its current line is drawn again from editLine */
+static uartLine_t screenLine = UART_LINE_FRESH;
+static uint8_t editLine[UART_EDIT_LINE_SIZE];
+static uint8_t editLength = 0U;
+static bool editWrapped = false;
+static uint8_t heldLine[UART_HELD_LINE_SIZE];
+static uint8_t heldLength = 0U;
+
+/* Characters typed and not sent yet, the characters of the message typed
+ * so far, the cycle count when the first one of the segment was typed,
+ * and whether the message is over so its last fragment is due */
+static uint8_t sendSegment[UART_SEND_SEGMENT_SIZE];
+static uint8_t sendLength = 0U;
+static uint32_t sendTyped = 0U;
+static uint32_t sendFirstCycles = 0U;
+static bool sendEnding = false;
+
+/* The board the message goes to: an "@<address> " prefix typed first
+ * chooses one, the message is broadcast to every board otherwise */
+static uint8_t sendDestination = NET_BROADCAST;
+static bool sendAddressing = false;
+static bool sendAddressed = false;
+static uint16_t sendAddress = 0U;
+
+/* Characters waiting to be echoed, and whether the echo label was shown */
+static uint8_t echoBuffer[UART_ECHO_BUFFER_SIZE];
+static uint8_t echoLength = 0U;
+static bool echoStarted = false;
+
+#if (UART1_DMA_MODE == 1U)
+/* The UART1 bytes collected so far */
+static uint32_t linkRxBytes = 0U;
+#endif
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static uartChannel_t* UARTGetChannel(uint32_t base);
+static void UARTFIFOConfigure(uint32_t base);
+static uint32_t UARTStatusHandler(uartChannel_t *channel);
+static void UARTCountRxErrors(uartChannel_t *channel, uint32_t errors);
+static void UARTIntHandler(uartChannel_t *channel);
+static void UARTRxCollect(uartChannel_t *channel);
+static void UARTTxFill(uartChannel_t *channel);
+#if (UART3_MULTIDROP_MODE == 1U)
+static void UARTBusTake(uartChannel_t *channel);
+static void UARTBusRelease(uartChannel_t *channel);
+#endif
+static void UARTTxStart(uartChannel_t *channel);
+static bool UARTDrainWait(const uartChannel_t *channel, uint16_t *left, uint64_t *since);
+static void UARTprintPercentX100(int32_t value);
+static void UARTLineBreak(void);
+static void UARTRemoteLabel(void);
+static void UARTHeldShow(bool last);
+static void UARTRemoteText(const uint8_t *data, uint16_t length, bool last);
+static bool UARTShowFrame(const netPacket_t *packet, logId_t label);
+static bool UARTAddressChar(uint8_t data);
+static void UARTLocalLabel(void);
+static void UARTLocalErase(void);
+static void UARTLocalRedraw(void);
+static void UARTLocalWrite(const uint8_t *data, uint16_t length);
+static void UARTEchoFlush(void);
+static void UARTEchoChar(uint8_t data);
+static bool UARTSendDue(void);
+static bool UARTSendWorkPending(void);
+static bool UARTSendFlush(void);
+static void UARTChatStart(void);
+static void UARTChatFinish(void);
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function maps a UART module base address to its channel.
+ * Parameters: base -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ * Returns: A pointer to the channel, or NULL for an unsupported module.
+ */
+static uartChannel_t* UARTGetChannel(uint32_t base)
+{
+    uartChannel_t *channel = NULL;
+
+    if (base == (uint32_t)UART0_MODULE)
+    {
+        channel = &uart0Channel;
+    }
+
+    else if (base == (uint32_t)UART1_MODULE)
+    {
+        channel = &uart1Channel;
+    }
+
+#if (UART3_LINK_MODE == 1U)
+    else if (base == (uint32_t)UART3_MODULE)
+    {
+        channel = &uart3Channel;
+    }
+#endif
+
+    else
+    {
+
+    }
+
+    return channel;
+}
+
+/*
+ * Description :
+ * This function applies the hardware FIFO configuration of UART_API.h
+ * to a UART module. UARTEnable() always turns the FIFOs on, so this
+ * function must be called again every time the module is enabled.
+ * Parameters: base -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ * Returns: None.
+ */
+static void UARTFIFOConfigure(uint32_t base)
+{
+#if (UART_FIFO_MODE == 1U)
+    /* Interrupt once per FIFO watermark instead of once per byte */
+    UARTFIFOLevelSet(base, (uint32_t)UART_TX_FIFO_LEVEL, (uint32_t)UART_RX_FIFO_LEVEL);
+    UARTFIFOEnable(base);
+#else
+    /* Interrupt once per byte through the single byte holding register */
+    UARTFIFODisable(base);
+#endif
+}
+
+/*
+ * Description :
+ * This function reads and clears the pending interrupts of a UART
+ * module, counts them per direction to measure the interrupts per
+ * byte, and counts hardware overruns.
+ * Parameters: channel -> The channel of the UART module that raised the interrupt.
+ * Returns: The interrupts that were pending.
+ */
+static uint32_t UARTStatusHandler(uartChannel_t *channel)
+{
+    uint32_t base = channel->base;
+    uint32_t status = UARTIntStatus(base, true);
+    UARTIntClear(base, status);
+
+    /* Count the interrupts per direction to measure the interrupts per byte */
+    if ((status & ((uint32_t)UART_INT_RX | (uint32_t)UART_INT_RT)) != 0U)
+    {
+        channel->stats.rxInterrupts++;
+    }
+
+    else
+    {
+
+    }
+
+    if ((status & (uint32_t)UART_INT_TX) != 0U)
+    {
+        channel->stats.txInterrupts++;
+    }
+
+    else
+    {
+
+    }
+
+    /* The UART holding register was overwritten before it could be read */
+    if ((status & (uint32_t)UART_INT_OE) != 0U)
+    {
+        channel->stats.rxOverrun++;
+        UARTRxErrorClear(base);
+    }
+
+#if (UART1_DMA_MODE == 1U)
+    /* The uDMA controller reads the data words, so the line errors are
+     * only seen through the receive status register */
+    else if (channel == &uart1Channel)
+    {
+        UARTCountRxErrors(channel, UARTRxErrorGet(base));
+        UARTRxErrorClear(base);
+    }
+#endif
+
+    else
+    {
+
+    }
+
+    return status;
+}
+
+/*
+ * Description :
+ * This function counts the line errors of a received byte, as
+ * reported by UARTRxErrorGet() or by the upper bits of the data word.
+ * Overruns are counted from the overrun interrupt instead.
+ * Parameters: channel -> The channel of the UART module that received the byte.
+ *             errors  -> The UART_RXERROR_xxx flags of the byte.
+ * Returns: None.
+ */
+static void UARTCountRxErrors(uartChannel_t *channel, uint32_t errors)
+{
+    if ((errors & (uint32_t)UART_RXERROR_FRAMING) != 0U)
+    {
+        channel->stats.rxFraming++;
+    }
+
+    else
+    {
+
+    }
+
+    if ((errors & (uint32_t)UART_RXERROR_PARITY) != 0U)
+    {
+        channel->stats.rxParity++;
+    }
+
+    else
+    {
+
+    }
+
+    if ((errors & (uint32_t)UART_RXERROR_BREAK) != 0U)
+    {
+        channel->stats.rxBreak++;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function is the common body of the UART ISRs, it handles the
+ * pending interrupts, empties the UART into the receive ring buffer,
+ * counting any byte that does not fit, and refills the UART from the
+ * transmit ring buffer.
+ * Parameters: channel -> The channel of the UART module that raised the interrupt.
+ * Returns: None.
+ */
+static void UARTIntHandler(uartChannel_t *channel)
+{
+    uint32_t base = channel->base;
+    uint32_t status = UARTStatusHandler(channel);
+    bool received = false;
+
+    while (UARTCharsAvail(base))
+    {
+        /* The data word carries the UARTRxErrorGet() flags of this byte
+         * in its upper bits, so no error is missed between two reads */
+        uint32_t word = (uint32_t)UARTCharGetNonBlocking(base);
+        uint8_t receivedChar = (uint8_t)word;
+
+        if ((word >> 8) != 0U)
+        {
+            UARTCountRxErrors(channel, word >> 8);
+        }
+
+        else
+        {
+
+        }
+
+        if (RingBufferPut(&channel->rxRing, receivedChar))
+        {
+            channel->stats.rxBytes++;
+        }
+
+        else
+        {
+            channel->stats.rxDropped++;
+        }
+
+        received = true;
+    }
+
+    /* Tell the scheduler where the bytes came from */
+    if (received)
+    {
+        SchedPost((channel == &uart0Channel) ? SCHED_EVENT_TERMINAL : SCHED_EVENT_LINK);
+    }
+
+    else
+    {
+
+    }
+
+    /* The UART has room for more data, keep the transmitter busy */
+    if ((status & (uint32_t)UART_INT_TX) != 0U)
+    {
+        UARTTxFill(channel);
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function brings the receive ring buffer of a UART module up to
+ * date before it is read. Only the uDMA transport needs it, as bytes of
+ * a partially filled uDMA block do not raise any interrupt.
+ * Parameters: channel -> The channel of the UART module to be read.
+ * Returns: None.
+ */
+static void UARTRxCollect(uartChannel_t *channel)
+{
+#if (UART1_DMA_MODE == 1U)
+    if (channel == &uart1Channel)
+    {
+        IntDisable(channel->interrupt);
+        (void)UART1DMARxCollect();
+        IntEnable(channel->interrupt);
+    }
+
+    else
+    {
+
+    }
+#else
+    (void)channel;
+#endif
+}
+
+/*
+ * Description :
+ * This function moves queued bytes from the transmit ring buffer into
+ * the UART until the UART is full or the ring buffer is empty. It is
+ * the only consumer of the transmit ring buffer, so it must run either
+ * from the UART ISR or with the UART interrupt masked. On an RS-485 bus
+ * it also takes the line for a new transmission and gives it back once
+ * the transmission is over.
+ * Parameters: channel -> The channel of the UART module to be refilled.
+ * Returns: None.
+ */
+static void UARTTxFill(uartChannel_t *channel)
+{
+    uint8_t data;
+
+#if (UART3_MULTIDROP_MODE == 1U)
+    if (channel->bus && !channel->busDriving && (RingBufferCount(&channel->txRing) != 0U))
+    {
+        UARTBusTake(channel);
+    }
+
+    else
+    {
+
+    }
+#endif
+
+    while (UARTSpaceAvail(channel->base) && RingBufferGet(&channel->txRing, &data))
+    {
+        (void)UARTCharPutNonBlocking(channel->base, data);
+        channel->stats.txBytes++;
+    }
+
+#if (UART3_MULTIDROP_MODE == 1U)
+    if (channel->bus && channel->busDriving)
+    {
+        UARTBusRelease(channel);
+    }
+
+    else
+    {
+
+    }
+#endif
+}
+
+#if (UART3_MULTIDROP_MODE == 1U)
+/*
+ * Description :
+ * This function starts a transmission on the RS-485 bus: it enables the
+ * transceiver driver and sends the address byte selecting the receiving
+ * board. The transmitter is idle, so the address byte only waits for its
+ * own character time.
+ * Parameters: channel -> The channel of the UART module on the bus.
+ * Returns: None.
+ */
+static void UARTBusTake(uartChannel_t *channel)
+{
+    GPIOPinWrite((uint32_t)UART3_DE_GPIO_BASE, (uint8_t)UART3_DE_PIN, (uint8_t)UART3_DE_PIN);
+
+    /* Refill at the FIFO level while the transmission runs */
+    UARTTxIntModeSet(channel->base, (uint32_t)UART_TXINT_MODE_FIFO);
+    UART9BitAddrSend(channel->base, channel->busDestination);
+
+    channel->stats.txAddresses++;
+    channel->busDriving = true;
+}
+
+/*
+ * Description :
+ * This function ends a transmission on the RS-485 bus once its last
+ * stop bit is out. While bytes are still queued nothing changes; once
+ * the last ones are in the UART, the TX interrupt is moved to the end
+ * of transmission, and the transceiver driver is released when the
+ * transmitter is idle.
+ * Parameters: channel -> The channel of the UART module on the bus.
+ * Returns: None.
+ */
+static void UARTBusRelease(uartChannel_t *channel)
+{
+    if (RingBufferCount(&channel->txRing) == 0U)
+    {
+        UARTTxIntModeSet(channel->base, (uint32_t)UART_TXINT_MODE_EOT);
+
+        /* Checked after the mode is set, so an end of transmission is not missed */
+        if (!UARTBusy(channel->base))
+        {
+            GPIOPinWrite((uint32_t)UART3_DE_GPIO_BASE, (uint8_t)UART3_DE_PIN, 0U);
+            channel->busDriving = false;
+        }
+
+        else
+        {
+
+        }
+    }
+
+    else
+    {
+        /* More bytes follow at the FIFO level */
+    }
+}
+#endif
+
+/*
+ * Description :
+ * This function starts the transmission of newly queued bytes. When the
+ * transmitter is idle no TX interrupt is pending, so the first bytes are
+ * written here and the TX interrupt takes over from there.
+ * Parameters: channel -> The channel of the UART module to be started.
+ * Returns: None.
+ */
+static void UARTTxStart(uartChannel_t *channel)
+{
+    IntDisable(channel->interrupt);
+
+#if (UART1_DMA_MODE == 1U)
+    if (channel == &uart1Channel)
+    {
+        /* UART1 is fed by the uDMA controller straight from the ring buffer */
+        UART1DMATxStart();
+    }
+
+    else
+    {
+        UARTTxFill(channel);
+    }
+#else
+    UARTTxFill(channel);
+#endif
+
+    IntEnable(channel->interrupt);
+}
+
+/*
+ * Description :
+ * This function tells a waiting write whether it may go on waiting for
+ * the transmit ring buffer of a UART module to drain.
+ * Parameters: channel -> The channel of the UART module.
+ *             left    -> The bytes queued at the last progress, updated.
+ *             since   -> The time of the last progress in us, updated.
+ * Returns: true while the UART module is enabled and a byte left the
+ *          ring buffer within UART_DRAIN_TIMEOUT_MS.
+ */
+static bool UARTDrainWait(const uartChannel_t *channel, uint16_t *left, uint64_t *since)
+{
+    uint16_t count = RingBufferCount(&channel->txRing);
+    uint64_t now = TimebaseGetUs();
+
+    if (count != *left)
+    {
+        *left = count;
+        *since = now;
+    }
+
+    else
+    {
+
+    }
+
+    return UARTIsEnabled(channel->base) && ((now - *since) < ((uint64_t)UART_DRAIN_TIMEOUT_MS * 1000U));
+}
+
+/*
+ * Description :
+ * This function queues a whole buffer for transmission, waiting
+ * only while the transmit ring buffer is full. The bytes that still do
+ * not fit when the UART module is disabled or stopped draining for
+ * UART_DRAIN_TIMEOUT_MS are refused and counted as rejected.
+ * Parameters: base   -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ *             buffer -> The bytes to be transmitted.
+ *             length -> The number of bytes to be transmitted.
+ * Returns: None.
+ */
+void UARTWriteAll(uint32_t base, const uint8_t *buffer, uint16_t length)
+{
+    uint16_t sent = 0U;
+    uartChannel_t *channel = UARTGetChannel(base);
+    uint16_t left = 0U;
+    uint64_t since = TimebaseGetUs();
+    bool waiting = true;
+
+    while ((NULL != channel) && (sent < length) && waiting)
+    {
+        uint16_t count = (uint16_t)(length - sent);
+        uint16_t space = RingBufferFree(&channel->txRing);
+
+        if (count > space)
+        {
+            count = space;
+        }
+
+        else
+        {
+
+        }
+
+        /* Only queue what fits, so the backpressure counter is not charged */
+        sent += UARTWrite(base, &buffer[sent], count);
+
+        if ((sent < length) && !UARTDrainWait(channel, &left, &since))
+        {
+            /* Give the rest up, UARTWrite() counts it as rejected */
+            (void)UARTWrite(base, &buffer[sent], (uint16_t)(length - sent));
+            waiting = false;
+        }
+
+        else
+        {
+
+        }
+    }
+}
+
+/*
+ * Description :
+ * This function prints a signed value given in 1/100 on the terminal
+ * as a percentage with two decimals, for example +1.25%.
+ * Parameters: value -> The value in 1/100 %.
+ * Returns: None.
+ */
+static void UARTprintPercentX100(int32_t value)
+{
+    uint32_t magnitude = (value < 0) ? (uint32_t)(-value) : (uint32_t)value;
+
+    UARTprint((value < 0) ? "-" : "+");
+    UARTprintDecimal(magnitude / 100U);
+    UARTprint(((magnitude % 100U) < 10U) ? ".0" : ".");
+    UARTprintDecimal(magnitude % 100U);
+    UARTprint("%");
+}
+
+/*
+ * Description :
+ * This function ends the terminal line the cursor is on. A received
+ * message not over yet goes on below, after its label.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void UARTLineBreak(void)
+{
+    UARTprint("\n\r");
+    screenLine = UART_LINE_FRESH;
+
+    if (messageReceiving)
+    {
+        remoteLabelDue = true;
+        remoteResumed = true;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function shows the label of a received message on a new line:
+ * the board it comes from, and "..." when the message was partly shown
+ * on a line before.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void UARTRemoteLabel(void)
+{
+    if (remoteLabelDue)
+    {
+        Log1(remoteLabel, messageSource);
+
+#if (UART_SHOW_TIMESTAMPS == 1U)
+        Log1(LOG_RECEIVED_AT, remoteStamp.receivedUs);
+
+        if (remoteStamp.timed)
+        {
+            Log1(LOG_ONE_WAY, (uint32_t)remoteStamp.oneWayUs);
+        }
+
+        else
+        {
+
+        }
+#endif
+
+        Log0(remoteResumed ? LOG_LABEL_RESUMED : LOG_LABEL_END);
+        remoteLabelDue = false;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function shows the held back text of a received message as a line
+ * of its own in place of the line of the message being typed, then draws
+ * that line again below it.
+ * Parameters: last -> The held text ends the message.
+ * Returns: None.
+ */
+static void UARTHeldShow(bool last)
+{
+    UARTLocalErase();
+    UARTRemoteLabel();
+    UARTWriteAll((uint32_t)UART0_MODULE, heldLine, (uint16_t)heldLength);
+    heldLength = 0U;
+    UARTprint("\n\r");
+    screenLine = UART_LINE_FRESH;
+
+    if (!last)
+    {
+        remoteLabelDue = true;
+        remoteResumed = true;
+    }
+
+    else
+    {
+
+    }
+
+    UARTLocalRedraw();
+}
+
+/*
+ * Description :
+ * This function shows text of a received message: at once when the cursor
+ * is free, held back while the message being typed is on the last line,
+ * until the message is over or a line is full.
+ * Parameters: data   -> The text.
+ *             length -> The number of characters.
+ *             last   -> The text ends the message.
+ * Returns: None.
+ */
+static void UARTRemoteText(const uint8_t *data, uint16_t length, bool last)
+{
+    uint16_t i;
+
+    if (screenLine == UART_LINE_LOCAL)
+    {
+        for (i = 0U; i < length; i++)
+        {
+            if (heldLength == UART_HELD_LINE_SIZE)
+            {
+                UARTHeldShow(false);
+            }
+
+            else
+            {
+
+            }
+
+            heldLine[heldLength] = data[i];
+            heldLength++;
+        }
+
+        if (last && (heldLength != 0U))
+        {
+            UARTHeldShow(true);
+        }
+
+        else
+        {
+
+        }
+    }
+
+    else
+    {
+        UARTRemoteLabel();
+
+        /* Send the received message on UART1 to UART0 to be displayed over the terminal */
+        UARTWriteAll((uint32_t)UART0_MODULE, data, length);
+        screenLine = UART_LINE_REMOTE;
+    }
+}
+
+/*
+ * Description :
+ * This function shows a fragment of a message from another board on the
+ * terminal as soon as it arrives, the label and the source only before
+ * its first fragment, or when it interrupts a message from another board.
+ * The line of a message being typed is never written into (UARTRemoteText()).
+ * Parameters: packet -> The received packet.
+ *             label  -> The log message shown before a message, naming its source.
+ * Returns: true if the packet completed a message, false otherwise.
+ */
+static bool UARTShowFrame(const netPacket_t *packet, logId_t label)
+{
+    fragPiece_t piece;
+    bool complete = false;
+
+    if (FragReceive(packet, &piece))
+    {
+        bool labelled = piece.first || (piece.source != messageSource);
+
+        /* The message shown will never be completed, or goes on later */
+        if (messageReceiving && labelled)
+        {
+            messageReceiving = false;
+
+            if (piece.broken && (piece.source == messageSource))
+            {
+                UARTRemoteText((const uint8_t*)" [cut]", 6U, true);
+            }
+
+            else if (heldLength != 0U)
+            {
+                UARTHeldShow(true);
+            }
+
+            else
+            {
+
+            }
+
+            if (screenLine == UART_LINE_REMOTE)
+            {
+                UARTLineBreak();
+            }
+
+            else
+            {
+
+            }
+        }
+
+        else
+        {
+
+        }
+
+        if (labelled)
+        {
+            remoteLabelDue = true;
+            remoteResumed = false;
+#if (UART_SHOW_TIMESTAMPS == 1U)
+            remoteStamp = piece;
+#endif
+        }
+
+        else
+        {
+
+        }
+
+        messageReceiving = !piece.last;
+        messageSource = piece.source;
+        remoteLabel = label;
+        UARTRemoteText(piece.data, (uint16_t)piece.length, piece.last);
+        complete = piece.last;
+    }
+
+    else
+    {
+
+    }
+
+    return complete;
+}
+
+/*
+ * Description :
+ * This function reads the "@<address> " prefix choosing the board a
+ * message goes to, typed before the message. The character ending the
+ * address, a space, is not part of the message. An address of 0 or
+ * above 254 broadcasts the message.
+ * Parameters: data -> The typed character.
+ * Returns: true if the character belongs to the prefix.
+ */
+static bool UARTAddressChar(uint8_t data)
+{
+    bool consumed = true;
+
+    if (sendAddressing && (data >= (uint8_t)'0') && (data <= (uint8_t)'9'))
+    {
+        sendAddress = (uint16_t)((sendAddress * 10U) + (uint16_t)(data - (uint8_t)'0'));
+
+        if (sendAddress > NET_BROADCAST)
+        {
+            sendAddress = NET_BROADCAST;
+        }
+
+        else
+        {
+
+        }
+    }
+
+    else if (sendAddressing)
+    {
+        sendAddressing = false;
+        sendDestination = (sendAddress == NET_NO_ADDRESS) ? (uint8_t)NET_BROADCAST : (uint8_t)sendAddress;
+    }
+
+    else if (!sendAddressed && (data == (uint8_t)'@'))
+    {
+        sendAddressing = true;
+        sendAddressed = true;
+        sendAddress = 0U;
+    }
+
+    else
+    {
+        consumed = false;
+    }
+
+    return consumed;
+}
+
+/*
+ * Description :
+ * This function shows the label of the message being typed, naming the
+ * board it goes to unless it is broadcast.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void UARTLocalLabel(void)
+{
+    if (sendDestination == NET_BROADCAST)
+    {
+        Log0(LOG_MESSAGE_SENT);
+    }
+
+    else
+    {
+        Log1(LOG_MESSAGE_SENT_TO, sendDestination);
+    }
+}
+
+/*
+ * Description :
+ * This function erases the line of the message being typed, if the cursor
+ * is on it, to make room for a received message.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void UARTLocalErase(void)
+{
+    if (screenLine == UART_LINE_LOCAL)
+    {
+        UARTprint(UART_ERASE_LINE);
+        screenLine = UART_LINE_FRESH;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function draws the current line of the message being typed again
+ * on an empty line, once its echo started: the label, or "..." when the
+ * message went on from a line above, then the characters of the line.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void UARTLocalRedraw(void)
+{
+    if (echoStarted && (screenLine == UART_LINE_FRESH))
+    {
+        if (editWrapped)
+        {
+            UARTprint("...");
+        }
+
+        else
+        {
+            UARTLocalLabel();
+        }
+
+        UARTWriteAll((uint32_t)UART0_MODULE, editLine, (uint16_t)editLength);
+        screenLine = UART_LINE_LOCAL;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function adds echoed characters to the line of the message being
+ * typed, going on with "..." on the next line when it is full.
+ * Parameters: data   -> The characters.
+ *             length -> The number of characters.
+ * Returns: None.
+ */
+static void UARTLocalWrite(const uint8_t *data, uint16_t length)
+{
+    uint16_t written = 0U;
+
+    while (written < length)
+    {
+        uint16_t count = (uint16_t)(length - written);
+
+        if (editLength == UART_EDIT_LINE_SIZE)
+        {
+            UARTprint("\n\r...");
+            editLength = 0U;
+            editWrapped = true;
+        }
+
+        else
+        {
+            if (count > (UART_EDIT_LINE_SIZE - (uint16_t)editLength))
+            {
+                count = (uint16_t)(UART_EDIT_LINE_SIZE - (uint16_t)editLength);
+            }
+
+            else
+            {
+
+            }
+
+            UARTWriteAll((uint32_t)UART0_MODULE, &data[written], count);
+            (void)memcpy(&editLine[editLength], &data[written], count);
+            editLength = (uint8_t)(editLength + count);
+            written += count;
+        }
+    }
+}
+
+/*
+ * Description :
+ * This function shows the characters gathered by the echo, after the
+ * "Message Sent : " label the first time. The echo takes the last line:
+ * a received message being shown goes on below it later.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void UARTEchoFlush(void)
+{
+    if (echoLength != 0U)
+    {
+        if (screenLine == UART_LINE_REMOTE)
+        {
+            UARTLineBreak();
+        }
+
+        else
+        {
+
+        }
+
+        if (!echoStarted)
+        {
+            UARTLocalLabel();
+            echoStarted = true;
+            screenLine = UART_LINE_LOCAL;
+        }
+
+        else
+        {
+            UARTLocalRedraw();
+        }
+
+        UARTLocalWrite(echoBuffer, (uint16_t)echoLength);
+        echoLength = 0U;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function echoes a typed character: at once in streaming mode
+ * without the message echo, otherwise once the message is over or the
+ * echo buffer is full.
+ * Parameters: data -> The typed character.
+ * Returns: None.
+ */
+static void UARTEchoChar(uint8_t data)
+{
+    echoBuffer[echoLength] = data;
+    echoLength++;
+
+#if ((UART_STREAM_MODE == 1U) && (UART_STREAM_ECHO_MESSAGE == 0U))
+    UARTEchoFlush();
+#else
+    if (echoLength >= UART_ECHO_BUFFER_SIZE)
+    {
+        UARTEchoFlush();
+    }
+
+    else
+    {
+
+    }
+#endif
+}
+
+/*
+ * Description :
+ * This function tells whether the typed characters must be sent: at the
+ * end of the message or when the segment is full, and in streaming mode
+ * as soon as the first one waited UART_STREAM_COALESCE_US.
+ * Parameters: None.
+ * Returns: true if a fragment is due.
+ */
+static bool UARTSendDue(void)
+{
+    bool due = sendEnding || (sendLength >= UART_SEND_SEGMENT_SIZE);
+
+#if (UART_STREAM_MODE == 1U)
+    if ((UART_STREAM_COALESCE_US == 0U) ||
+        ((CYCLE_COUNTER_GET() - sendFirstCycles) >= ((uint32_t)UART_STREAM_COALESCE_US * (ClockGetHz() / 1000000U))))
+    {
+        due = due || (sendLength != 0U);
+    }
+
+    else
+    {
+
+    }
+#endif
+
+    return due;
+}
+
+/*
+ * Description :
+ * This function tells whether the send and receive state must run again
+ * without waiting for an event: a fragment due with room for it in the
+ * send windows towards its destination. A fragment waiting for its
+ * coalescing time keeps the state running, the window being short.
+ * Parameters: None.
+ * Returns: true if work is pending.
+ */
+static bool UARTSendWorkPending(void)
+{
+#if (UART_STREAM_MODE == 1U)
+    bool waiting = (sendLength != 0U) || sendEnding;
+#else
+    bool waiting = UARTSendDue();
+#endif
+
+    return UARTLinkPolling() || (waiting && NetCanSend(sendDestination));
+}
+
+/*
+ * Description :
+ * This function hands the typed characters to the fragmentation layer
+ * once they are due.
+ * Parameters: None.
+ * Returns: true if a fragment was handed over.
+ */
+static bool UARTSendFlush(void)
+{
+    bool sent = false;
+
+    if (UARTSendDue() && FragSend(sendDestination, sendSegment, sendLength, sendEnding))
+    {
+        sendLength = 0U;
+        sent = true;
+    }
+
+    else
+    {
+
+    }
+
+    return sent;
+}
+
+/*
+ * Description :
+ * This function starts a new message in the send and receive state.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void UARTChatStart(void)
+{
+    sendLength = 0U;
+    sendTyped = 0U;
+    sendEnding = false;
+    sendDestination = NET_BROADCAST;
+    sendAddressing = false;
+    sendAddressed = false;
+    echoLength = 0U;
+    echoStarted = false;
+    editLength = 0U;
+    editWrapped = false;
+}
+
+/*
+ * Description :
+ * This function ends the message of the send and receive state on the
+ * terminal: the rest of its echo, a new line, then what was held back
+ * while it was typed.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void UARTChatFinish(void)
+{
+    UARTEchoFlush();
+
+    if (screenLine != UART_LINE_FRESH)
+    {
+        UARTLineBreak();
+    }
+
+    else
+    {
+
+    }
+
+    echoStarted = false;
+
+    if (heldLength != 0U)
+    {
+        UARTHeldShow(!messageReceiving);
+    }
+
+    else
+    {
+
+    }
+}
+
 /*******************************************************************************
  *                      Functions definitions                                  *
  *******************************************************************************/
 /*
  * Description :
- * This function initializes the UART module, sets up
- * the necessary GPIO pins for UART communication, and
- * establishes communication parameters including the baud rate,
- * data frame format, and parity settings.
+ * This function initializes the UART module, sets up
+ * the necessary GPIO pins for UART communication, and
+ * establishes communication parameters including the baud rate,
+ * data frame format, and parity settings.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UARTInit(void)
+{
+    /* Enable UART0 peripheral */
+    SysCtlPeripheralEnable((uint32_t)UART0_PERIPH);
+
+    /* Enable GPIOA peripheral (UART0 pins) */
+    SysCtlPeripheralEnable((uint32_t)UART0_GPIO_PERIPH);
+
+    /* Configure UART0 pins (PA0 as UART0 Rx, PA1 as UART0 Tx) */
+    GPIOPinConfigure((uint32_t)GPIO_PA0_U0RX);
+    GPIOPinConfigure((uint32_t)GPIO_PA1_U0TX);
+    GPIOPinTypeUART((uint32_t)UART0_GPIO_BASE, (uint8_t)UART0_RX_PIN | (uint8_t)UART0_TX_PIN);
+
+    /* Initialize UART0 module */
+    UARTConfigSetExpClk((uint32_t)UART0_MODULE, ClockGetHz(), (uint32_t)UART0_BAUD_RATE, UART_LINE_CONFIG);
+    uart0Channel.baudRate = (uint32_t)UART0_BAUD_RATE;
+
+    /* Enable UART0 module */
+    UARTEnable((uint32_t)UART0_MODULE);
+
+    /* Configure UART0 FIFO */
+    UARTFIFOConfigure((uint32_t)UART0_MODULE);
+
+    /* Receive and transmit UART0 characters in the background through the UART0 ring buffers */
+    RingBufferInit(&uart0Channel.rxRing, uart0RxStorage, (uint16_t)UART0_RX_BUFFER_SIZE);
+    RingBufferInit(&uart0Channel.txRing, uart0TxStorage, (uint16_t)UART0_TX_BUFFER_SIZE);
+    UARTIntRegister((uint32_t)UART0_MODULE, &UART0ISR);
+    UARTIntEnable((uint32_t)UART0_MODULE, (uint32_t)UART_INT_RX | (uint32_t)UART_INT_RT | (uint32_t)UART_INT_OE | (uint32_t)UART_INT_TX);
+
+    /* Enable UART1 peripheral */
+    SysCtlPeripheralEnable((uint32_t)UART1_PERIPH);
+
+    /* Enable GPIOB peripheral (UART1 pins) */
+    SysCtlPeripheralEnable((uint32_t)SYSCTL_PERIPH_GPIOB);
+
+    /* Configure UART1 pins (PB0 as UART0 Rx, PB1 as UART0 Tx) */
+    GPIOPinConfigure((uint32_t)GPIO_PB0_U1RX);
+    GPIOPinConfigure((uint32_t)GPIO_PB1_U1TX);
+    GPIOPinTypeUART((uint32_t)UART1_GPIO_BASE, (uint8_t)UART1_RX_PIN | (uint8_t)UART1_TX_PIN);
+
+    /* Initialize UART1 module */
+    UARTConfigSetExpClk((uint32_t)UART1_MODULE, ClockGetHz(), (uint32_t)UART1_BAUD_RATE, UART_LINE_CONFIG);
+    uart1Channel.baudRate = (uint32_t)UART1_BAUD_RATE;
+
+    /* Enable UART1 module */
+    UARTEnable((uint32_t)UART1_MODULE);
+
+    /* Configure UART1 FIFO */
+    UARTFIFOConfigure((uint32_t)UART1_MODULE);
+
+    /* Receive and transmit UART1 characters in the background through the UART1 ring buffers */
+    RingBufferInit(&uart1Channel.rxRing, uart1RxStorage, (uint16_t)UART1_RX_BUFFER_SIZE);
+    RingBufferInit(&uart1Channel.txRing, uart1TxStorage, (uint16_t)UART1_TX_BUFFER_SIZE);
+    UARTIntRegister((uint32_t)UART1_MODULE, &UART1ISR);
+
+#if (UART1_DMA_MODE == 1U)
+    /* The uDMA controller moves the data, the UART1 interrupt only
+     * reports overruns and the uDMA transfer completions */
+    UART1DMAInit(&uart1Channel.rxRing, &uart1Channel.txRing, &uart1Channel.stats);
+    UARTIntEnable((uint32_t)UART1_MODULE, (uint32_t)UART_INT_OE);
+#else
+    UARTIntEnable((uint32_t)UART1_MODULE, (uint32_t)UART_INT_RX | (uint32_t)UART_INT_RT | (uint32_t)UART_INT_OE | (uint32_t)UART_INT_TX);
+#endif
+
+#if (UART3_LINK_MODE == 1U)
+    /* Enable UART3 peripheral */
+    SysCtlPeripheralEnable((uint32_t)UART3_PERIPH);
+
+    /* Enable GPIOC peripheral (UART3 pins) */
+    SysCtlPeripheralEnable((uint32_t)UART3_GPIO_PERIPH);
+
+    /* Configure UART3 pins (PC6 as UART3 Rx, PC7 as UART3 Tx) */
+    GPIOPinConfigure((uint32_t)GPIO_PC6_U3RX);
+    GPIOPinConfigure((uint32_t)GPIO_PC7_U3TX);
+    GPIOPinTypeUART((uint32_t)UART3_GPIO_BASE, (uint8_t)UART3_RX_PIN | (uint8_t)UART3_TX_PIN);
+
+#if (UART3_MULTIDROP_MODE == 1U)
+    /* Configure the transceiver driver enable pin, the bus is released */
+    SysCtlPeripheralEnable((uint32_t)UART3_DE_GPIO_PERIPH);
+    GPIOPinTypeGPIOOutput((uint32_t)UART3_DE_GPIO_BASE, (uint8_t)UART3_DE_PIN);
+    GPIOPinWrite((uint32_t)UART3_DE_GPIO_BASE, (uint8_t)UART3_DE_PIN, 0U);
+
+    /* Initialize UART3 module in 9-bit mode, the 9th bit of the data bytes is 0 */
+    UARTConfigSetExpClk((uint32_t)UART3_MODULE, ClockGetHz(), (uint32_t)UART3_BAUD_RATE, UART_BUS_LINE_CONFIG);
+    UART9BitEnable((uint32_t)UART3_MODULE);
+    uart3Channel.bus = true;
+#else
+    /* Initialize UART3 module */
+    UARTConfigSetExpClk((uint32_t)UART3_MODULE, ClockGetHz(), (uint32_t)UART3_BAUD_RATE, UART_LINE_CONFIG);
+#endif
+    uart3Channel.baudRate = (uint32_t)UART3_BAUD_RATE;
+
+    /* Enable UART3 module */
+    UARTEnable((uint32_t)UART3_MODULE);
+
+    /* Configure UART3 FIFO */
+    UARTFIFOConfigure((uint32_t)UART3_MODULE);
+
+    /* Receive and transmit UART3 characters in the background through the UART3 ring buffers */
+    RingBufferInit(&uart3Channel.rxRing, uart3RxStorage, (uint16_t)UART3_RX_BUFFER_SIZE);
+    RingBufferInit(&uart3Channel.txRing, uart3TxStorage, (uint16_t)UART3_TX_BUFFER_SIZE);
+    UARTIntRegister((uint32_t)UART3_MODULE, &UART3ISR);
+    UARTIntEnable((uint32_t)UART3_MODULE, (uint32_t)UART_INT_RX | (uint32_t)UART_INT_RT | (uint32_t)UART_INT_OE | (uint32_t)UART_INT_TX);
+#endif
+}
+
+
+/*
+ * Description :
+ * This function turns off the UART module.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UARTOff(void)
+{
+    /* Disable UART1 module */
+    UARTDisable((uint32_t)UART1_MODULE);
+
+#if (UART3_LINK_MODE == 1U)
+    /* Disable UART3 module */
+    UARTDisable((uint32_t)UART3_MODULE);
+#endif
+
+#if (UART3_MULTIDROP_MODE == 1U)
+    /* Release the bus, the bytes still queued start a new transmission later */
+    IntDisable(uart3Channel.interrupt);
+    GPIOPinWrite((uint32_t)UART3_DE_GPIO_BASE, (uint8_t)UART3_DE_PIN, 0U);
+    uart3Channel.busDriving = false;
+    IntEnable(uart3Channel.interrupt);
+#endif
+}
+
+/*
+ * Description :
+ * This function puts the UART module in a listening
+ * mode, it prepares the UART to listen for incoming
+ * data on the dedicated UART pins.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UARTListen(void)
+{
+    /* enable UART1 module */
+    UARTEnable((uint32_t)UART1_MODULE);
+    UARTFIFOConfigure((uint32_t)UART1_MODULE);
+
+#if (UART3_LINK_MODE == 1U)
+    /* enable UART3 module */
+    UARTEnable((uint32_t)UART3_MODULE);
+    UARTFIFOConfigure((uint32_t)UART3_MODULE);
+#endif
+}
+
+/*
+ * Description :
+ * This function runs the listening mode once: it serves the links and
+ * shows a message from another board fragment by fragment, on a line of
+ * its own once it is complete.
+ * Parameters: None.
+ * Returns: true if it must run again without waiting for an event.
+ */
+bool UARTListenStep(void)
+{
+    /* Take the next message packet delivered in order by another board */
+    const netPacket_t *packet = NetPoll();
+
+    if ((NULL != packet) && UARTShowFrame(packet, LOG_MESSAGE_RECEIVED))
+    {
+        /* New line */
+        UARTLineBreak();
+    }
+
+    else
+    {
+
+    }
+
+    return (NULL != packet) || UARTLinkPolling();
+}
+
+/*
+ * Description :
+ * This function leaves the listening mode.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UARTListenLeave(void)
+{
+    /* New line, a message cut by the button goes on after its label */
+    UARTLineBreak();
+}
+
+/*
+ * Description :
+ * This function applies bidirectional UART
+ * communication, enables the UART module to send a
+ * message over UART or listen for incoming UART data.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UARTSendandReceive(void)
+{
+    UARTChatStart();
+}
+
+/*
+ * Description :
+ * This function runs the bidirectional communication once: it takes a
+ * character typed on the terminal, shows what the other boards send and
+ * sends the typed characters once they are due. Both directions go on
+ * at every run, so neither waits for the other.
+ * Parameters: None.
+ * Returns: true if it must run again without waiting for an event.
+ */
+bool UARTSendandReceiveStep(void)
+{
+    uint8_t receivedChar;
+    bool busy = false;
+    bool done = false;
+    PROFILE_START(profileStart);
+
+    /* Read the next character typed on the terminal, if any, while
+     * the segment has room for it */
+    if (!sendEnding && (sendLength < UART_SEND_SEGMENT_SIZE) &&
+        UARTReceive((uint32_t)UART0_MODULE, &receivedChar))
+    {
+        busy = true;
+
+        /* The terminator ('#' or Enter) only ends the message, it is
+         * not part of it but it is echoed */
+        if ((receivedChar == (uint8_t)'#') || (receivedChar == 13U))
+        {
+            sendEnding = true;
+        }
+
+        /* The destination prefix is neither sent nor echoed */
+        else if ((sendTyped == 0U) && UARTAddressChar(receivedChar))
+        {
+
+        }
+
+        else
+        {
+            if (sendLength == 0U)
+            {
+                sendFirstCycles = CYCLE_COUNTER_GET();
+            }
+
+            else
+            {
+
+            }
+
+            sendSegment[sendLength] = receivedChar;
+            sendLength++;
+            sendTyped++;
+        }
+
+        if (sendTyped != 0U)
+        {
+            UARTEchoChar(receivedChar);
+        }
+
+        else
+        {
+
+        }
+    }
+
+    else
+    {
+
+    }
+
+    /* Show what the other boards send meanwhile */
+    {
+        const netPacket_t *packet = NetPoll();
+
+        if (NULL != packet)
+        {
+            busy = true;
+
+            if (UARTShowFrame(packet, LOG_MESSEGE_RECEIVED) && (screenLine == UART_LINE_REMOTE))
+            {
+                UARTLineBreak();
+            }
+
+            else
+            {
+
+            }
+        }
+
+        else
+        {
+
+        }
+    }
+
+    /* An empty message is not sent at all */
+    if (sendEnding && (sendTyped == 0U))
+    {
+        done = true;
+    }
+
+    else if (UARTSendFlush())
+    {
+        busy = true;
+        done = sendEnding;
+    }
+
+    else
+    {
+
+    }
+
+    /* The message is over, the next one starts */
+    if (done)
+    {
+        UARTChatFinish();
+        UARTChatStart();
+    }
+
+    else
+    {
+
+    }
+
+    PROFILE_STOP(PROFILE_PROBE_SEND_RECEIVE, profileStart);
+
+    return busy || UARTSendWorkPending();
+}
+
+/*
+ * Description :
+ * This function leaves the bidirectional communication, the message
+ * being typed ends with what was typed. Its last fragment is tried once,
+ * the other board may not acknowledge any more.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UARTSendandReceiveLeave(void)
+{
+    sendEnding = true;
+
+    if (sendTyped != 0U)
+    {
+        (void)UARTSendFlush();
+    }
+
+    else
+    {
+
+    }
+
+    UARTChatFinish();
+}
+
+/*
+ * Description :
+ * This function sends a text message over UART
+ * communication by taking a null-terminated
+ * string as input and queuing it on the UART0
+ * transmit ring buffer, it only waits while the
+ * ring buffer is full.
+ * Parameters: text-> The null-terminated string to be transmitted over UART.
+ * Returns: None.
+ */
+void UARTprint(const char* text)
+{
+    PROFILE_START(profileStart);
+
+    /* The length is evaluated once, the characters are then
+     * sent in the background by the UART0 ISR */
+    UARTWriteAll((uint32_t)UART0_MODULE, (const uint8_t*)text, (uint16_t)strlen(text));
+
+    PROFILE_STOP(PROFILE_PROBE_PRINT, profileStart);
+}
+
+/*
+ * Description :
+ * Interrupt Service Routine for UART0, it moves every received
+ * character from the UART into the UART0 receive ring buffer
+ * and refills the UART from the UART0 transmit ring buffer.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UART0ISR(void)
+{
+    PROFILE_START(profileStart);
+
+    UARTIntHandler(&uart0Channel);
+
+    PROFILE_STOP(PROFILE_PROBE_UART0_ISR, profileStart);
+}
+
+/*
+ * Description :
+ * Interrupt Service Routine for UART1, it moves every received
+ * character from the UART into the UART1 receive ring buffer
+ * and refills the UART from the UART1 transmit ring buffer.
  * Parameters: None.
  * Returns: None.
  */
-void UARTInit(void)
+void UART1ISR(void)
 {
-    /* Enable UART0 peripheral */
-    SysCtlPeripheralEnable((uint32_t)UART0_PERIPH);
+    PROFILE_START(profileStart);
 
-    /* Enable GPIOA peripheral (UART0 pins) */
-    SysCtlPeripheralEnable((uint32_t)UART0_GPIO_PERIPH);
+    TRACE_BEGIN(TRACE_EVENT_UART1_ISR, 0U);
 
-    /* Configure UART0 pins (PA0 as UART0 Rx, PA1 as UART0 Tx) */
-    GPIOPinConfigure((uint32_t)GPIO_PA0_U0RX);
-    GPIOPinConfigure((uint32_t)GPIO_PA1_U0TX);
-    GPIOPinTypeUART((uint32_t)UART0_GPIO_BASE, (uint8_t)UART0_RX_PIN | (uint8_t)UART0_TX_PIN);
+#if (UART1_DMA_MODE == 1U)
+    (void)UARTStatusHandler(&uart1Channel);
+    UART1DMAIntHandler();
+#else
+    UARTIntHandler(&uart1Channel);
+#endif
 
-    /* Initialize UART0 module */
-    UARTConfigSetExpClk((uint32_t)UART0_MODULE, (uint32_t)SysCtlClockGet(), (uint32_t)115200, ((uint32_t)UART_CONFIG_WLEN_8 | (uint32_t)UART_CONFIG_STOP_ONE | (uint32_t)UART_CONFIG_PAR_NONE));
+    TRACE_END(TRACE_EVENT_UART1_ISR, 0U);
+    PROFILE_STOP(PROFILE_PROBE_UART1_ISR, profileStart);
+}
 
-    /* Enable UART0 module */
-    UARTEnable((uint32_t)UART0_MODULE);
+/*
+ * Description :
+ * Interrupt Service Routine for UART3, it moves every received
+ * character from the UART into the UART3 receive ring buffer
+ * and refills the UART from the UART3 transmit ring buffer.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UART3ISR(void)
+{
+    PROFILE_START(profileStart);
 
-    /* Disable UART0 FIFO */
-    UARTFIFODisable((uint32_t)UART0_MODULE);
+    TRACE_BEGIN(TRACE_EVENT_UART3_ISR, 0U);
 
-    /* Enable UART1 peripheral */
-    SysCtlPeripheralEnable((uint32_t)UART1_PERIPH);
+#if (UART3_LINK_MODE == 1U)
+    UARTIntHandler(&uart3Channel);
+#endif
 
-    /* Enable GPIOB peripheral (UART1 pins) */
-    SysCtlPeripheralEnable((uint32_t)SYSCTL_PERIPH_GPIOB);
+    TRACE_END(TRACE_EVENT_UART3_ISR, 0U);
+    PROFILE_STOP(PROFILE_PROBE_UART3_ISR, profileStart);
+}
 
-    /* Configure UART1 pins (PB0 as UART0 Rx, PB1 as UART0 Tx) */
-    GPIOPinConfigure((uint32_t)GPIO_PB0_U1RX);
-    GPIOPinConfigure((uint32_t)GPIO_PB1_U1TX);
-    GPIOPinTypeUART((uint32_t)UART1_GPIO_BASE, (uint8_t)UART1_RX_PIN | (uint8_t)UART1_TX_PIN);
+/*
+ * Description :
+ * This function reads one received character from the
+ * receive ring buffer of a UART module without blocking.
+ * Parameters: base -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ *             data -> A pointer to the variable where the character will be stored.
+ * Returns: true if a character was read, false if nothing was received.
+ */
+bool UARTReceive(uint32_t base, uint8_t *data)
+{
+    bool received = false;
+    uartChannel_t *channel = UARTGetChannel(base);
 
-    /* Initialize UART1 module */
-    UARTConfigSetExpClk((uint32_t)UART1_MODULE, (uint32_t)SysCtlClockGet(), (uint32_t)115200, ((uint32_t)UART_CONFIG_WLEN_8 | (uint32_t)UART_CONFIG_STOP_ONE | (uint32_t)UART_CONFIG_PAR_NONE));
+    if ((NULL != channel) && (NULL != data))
+    {
+        UARTRxCollect(channel);
+        received = RingBufferGet(&channel->rxRing, data);
+    }
 
-    /* Enable UART1 module */
-    UARTEnable((uint32_t)UART1_MODULE);
+    else
+    {
+
+    }
 
-    /* Disable UART1 FIFO */
-    UARTFIFODisable((uint32_t)UART1_MODULE);
+    return received;
 }
 
+/*
+ * Description :
+ * This function returns the number of received characters
+ * waiting in the receive ring buffer of a UART module.
+ * Parameters: base -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ * Returns: The number of characters waiting to be read.
+ */
+uint16_t UARTRxAvailable(uint32_t base)
+{
+    uint16_t count = 0U;
+    uartChannel_t *channel = UARTGetChannel(base);
+
+    if (NULL != channel)
+    {
+        UARTRxCollect(channel);
+        count = RingBufferCount(&channel->rxRing);
+    }
+
+    else
+    {
+
+    }
+
+    return count;
+}
 
 /*
  * Description :
- * This function turns off the UART module.
- * Parameters: None.
- * Returns: None.
+ * This function queues a buffer for transmission on a UART module
+ * without blocking, the bytes are sent in the background by the UART ISR.
+ * Parameters: base   -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ *             buffer -> The bytes to be transmitted.
+ *             length -> The number of bytes to be transmitted.
+ * Returns: The number of bytes queued, less than length when the
+ *          transmit ring buffer is full.
  */
-void UARTOff(void)
+uint16_t UARTWrite(uint32_t base, const uint8_t *buffer, uint16_t length)
 {
-    /* Disable UART1 module */
-    UARTDisable((uint32_t)UART1_MODULE);
+    uint16_t queued = 0U;
+    uartChannel_t *channel = UARTGetChannel(base);
+
+    if ((NULL != channel) && (NULL != buffer))
+    {
+        while ((queued < length) && RingBufferPut(&channel->txRing, buffer[queued]))
+        {
+            queued++;
+        }
+
+        /* Report the bytes refused because the ring buffer is full */
+        channel->stats.txRejected += (uint32_t)length - (uint32_t)queued;
+
+        UARTTxStart(channel);
+    }
 
-    flag_interrupt = 0U;
+    else
+    {
+
+    }
+
+    return queued;
 }
 
 /*
  * Description :
- * This function puts the UART module in a listening
- * mode, it prepares the UART to listen for incoming
- * data on the dedicated UART pins.
- * Parameters: None.
- * Returns: None.
+ * This function queues a null-terminated string for transmission
+ * on a UART module without blocking.
+ * Parameters: base -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ *             text -> The null-terminated string to be transmitted.
+ * Returns: The number of characters queued, less than the string
+ *          length when the transmit ring buffer is full.
  */
-void UARTListen(void)
+uint16_t UARTWriteString(uint32_t base, const char *text)
 {
-    /* enable UART1 module */
-    UARTEnable((uint32_t)UART1_MODULE);
+    uint16_t queued = 0U;
 
-    flag_interrupt = 0U;
-    uint8_t i = 0U;
+    if (NULL != text)
+    {
+        queued = UARTWrite(base, (const uint8_t*)text, (uint16_t)strlen(text));
+    }
 
-    while(flag_interrupt == 0U)
+    else
     {
-        /* Check if data is available to read */
-        if (UARTCharsAvail((uint32_t)UART1_MODULE))
-        {
-            /* Read and process incoming data */
-            int32_t receivedChar = UARTCharGet((uint32_t)UART1_MODULE);
 
-            /* Check if the received character is either '#' or Enter (ASCII 13).
-             * If either condition is met, it breaks out of the loop then
-             * prints the received data */
-            if((receivedChar == '#') || (receivedChar == 13U))
-            {
-                break;
-            }
+    }
 
-            /* This condition is used to print the below message only once */
-            if(i == 0U)
-            {
-                UARTprint("Message Received : ");
-                i = 1U;
-            }
+    return queued;
+}
+
+/*
+ * Description :
+ * This function queues a single byte for transmission
+ * on a UART module without blocking.
+ * Parameters: base -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ *             data -> The byte to be transmitted.
+ * Returns: true if the byte was queued, false if the transmit ring buffer is full.
+ */
+bool UARTWriteByte(uint32_t base, uint8_t data)
+{
+    return (UARTWrite(base, &data, 1U) == 1U);
+}
+
+/*
+ * Description :
+ * This function returns the free space in the transmit
+ * ring buffer of a UART module.
+ * Parameters: base -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ * Returns: The number of bytes that can be queued without being refused.
+ */
+uint16_t UARTTxFree(uint32_t base)
+{
+    uint16_t space = 0U;
+    uartChannel_t *channel = UARTGetChannel(base);
+
+    if (NULL != channel)
+    {
+        space = RingBufferFree(&channel->txRing);
+    }
+
+    else
+    {
 
-            /* Send the received message on UART1 to UART0 to be displayed over the terminal */
-            UARTCharPut((uint32_t)UART0_MODULE, (uint8_t)receivedChar);
+    }
+
+    return space;
+}
+
+/*
+ * Description :
+ * This function waits until every queued byte of a UART module
+ * has been transmitted, including the last stop bit. It does not wait
+ * for a disabled UART module, nor longer than UART_DRAIN_TIMEOUT_MS
+ * without a byte leaving.
+ * Parameters: base -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ * Returns: true if every byte was transmitted, false if the wait was given up.
+ */
+bool UARTFlush(uint32_t base)
+{
+    bool flushed = false;
+    uartChannel_t *channel = UARTGetChannel(base);
+
+    if (NULL != channel)
+    {
+        uint16_t left = RingBufferCount(&channel->txRing);
+        uint64_t since = TimebaseGetUs();
+        bool waiting = true;
+
+        while ((RingBufferCount(&channel->txRing) != 0U) && waiting)
+        {
+            /* Wait for the UART ISR to drain the transmit ring buffer */
+            waiting = UARTDrainWait(channel, &left, &since);
         }
+
+        while (waiting && UARTBusy(base))
+        {
+            /* Wait for the last character to leave the shift register */
+            waiting = UARTDrainWait(channel, &left, &since);
+        }
+
+        flushed = waiting;
     }
 
-    /* New line */
-    UARTprint("\n\r");
+    else
+    {
+
+    }
 
-    flag_interrupt = 1U;
+    return flushed;
 }
 
 /*
  * Description :
- * This function applies bidirectional UART
- * communication, enables the UART module to send a
- * message over UART or listen for incoming UART data.
+ * This function tells whether a UART module is enabled, its ISR only
+ * drains the transmit ring buffer then.
+ * Parameters: base -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ * Returns: true if the UART module is enabled.
+ */
+bool UARTIsEnabled(uint32_t base)
+{
+    return ((HWREG(base + UART_O_CTL) & (uint32_t)UART_CTL_UARTEN) != 0U);
+}
+
+/*
+ * Description :
+ * This function tells whether the links must be polled again without
+ * waiting for an event. In uDMA mode the bytes of a partially filled
+ * block raise no interrupt: the states collect them on the SysTick tick,
+ * and poll again as long as each poll collects new bytes, so the end of
+ * a frame is not held for a tick. The other bytes post their own events.
  * Parameters: None.
+ * Returns: true if the links must be polled.
+ */
+bool UARTLinkPolling(void)
+{
+    bool polling = false;
+
+#if (UART1_DMA_MODE == 1U)
+    UARTRxCollect(&uart1Channel);
+
+    polling = (uart1Channel.stats.rxBytes != linkRxBytes);
+    linkRxBytes = uart1Channel.stats.rxBytes;
+#endif
+
+    return polling;
+}
+
+/*
+ * Description :
+ * This function sets the addresses of a UART module on an RS-485 bus:
+ * the hardware only takes in the bytes that follow an address byte equal
+ * to its own address, and every transmission it starts is preceded by
+ * the address byte of the receiving board.
+ * Parameters: base        -> The UART module (UART3_MODULE with UART3_MULTIDROP_MODE).
+ *             address     -> The address of this board on the bus.
+ *             destination -> The address of the board the transmissions are for.
+ * Returns: true if the UART module is on a bus, false otherwise.
+ */
+bool UARTSetBusAddress(uint32_t base, uint8_t address, uint8_t destination)
+{
+    uartChannel_t *channel = UARTGetChannel(base);
+    bool bus = (NULL != channel) && channel->bus;
+
+    if (bus)
+    {
+        /* Every bit of the address is compared */
+        UART9BitAddrSet(base, address, 0xFFU);
+
+        IntDisable(channel->interrupt);
+        channel->busDestination = destination;
+        IntEnable(channel->interrupt);
+    }
+
+    else
+    {
+
+    }
+
+    return bus;
+}
+
+/*
+ * Description :
+ * This function copies the traffic counters of a UART module.
+ * Parameters: base  -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ *             stats -> A pointer to the structure where the counters will be stored.
  * Returns: None.
  */
-void UARTSendandReceive(void)
+void UARTGetStats(uint32_t base, uartStats_t *stats)
 {
-    uint8_t m = 0U;
-    uint8_t j;
-    uint8_t data[300];
-    flag_interrupt = 0U;
-    uint8_t receive_flag = 1U;
+    uartChannel_t *channel = UARTGetChannel(base);
 
-    while(flag_interrupt == 0U)
+    if ((NULL != channel) && (NULL != stats))
     {
-        /* Check if data is available to read */
-        if (UARTCharsAvail((uint32_t)UART0_MODULE))
-        {
-            /* Read and process incoming data */
-            int32_t receivedChar = UARTCharGet((uint32_t)UART0_MODULE);
+        *stats = channel->stats;
+    }
 
-            /* Store the data to be sent in its array */
-            data[m] = receivedChar;
+    else
+    {
 
-            /* Increment the counter */
-            m++;
+    }
+}
 
-            /* Check if the received character is either '#' or Enter (ASCII 13).
-             * If either condition is met, it breaks out of the loop then
-             * prints the received data */
-            if((receivedChar == '#') || (receivedChar == 13U))
-            {
-                break;
-            }
+/*
+ * Description :
+ * This function clears the traffic counters of a UART module.
+ * Parameters: base -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ * Returns: None.
+ */
+void UARTResetStats(uint32_t base)
+{
+    uartChannel_t *channel = UARTGetChannel(base);
+
+    if (NULL != channel)
+    {
+        /* The counters are updated from the ISR, so clear them atomically */
+        bool masked = IntMasterDisable();
+        (void)memset(&channel->stats, 0, sizeof(channel->stats));
+        if (!masked)
+        {
+            IntMasterEnable();
         }
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function computes the divisors and the error of a baud rate
+ * with the current system clock, the same way UARTConfigSetExpClk() does.
+ * Parameters: baudRate -> The requested baud rate.
+ *             info     -> A pointer to the structure where the result will be stored.
+ * Returns: true if the rate can be produced, false if it is out of range.
+ */
+bool UARTGetBaudInfo(uint32_t baudRate, uartBaudInfo_t *info)
+{
+    bool valid = false;
+    uint32_t clock = ClockGetHz();
 
-        /* Check if data is available to read */
-        else if (UARTCharsAvail((uint32_t)UART1_MODULE))
+    if ((NULL != info) && (baudRate != 0U) && (baudRate <= (clock / 8U)))
+    {
+        /* Above clock / 16 the UART samples 8 times per bit instead of 16,
+         * which is the same as dividing for half the rate */
+        bool highSpeed = ((baudRate * 16U) > clock);
+        uint32_t rate = highSpeed ? (baudRate / 2U) : baudRate;
+
+        /* Divisor in 1/64 steps: 64 * clock / (16 * rate), rounded */
+        uint32_t divisor = (((clock * 8U) / rate) + 1U) / 2U;
+
+        if ((divisor >= 64U) && ((divisor >> 6) <= 0xFFFFU))
         {
-            /* Read and process incoming data */
-            uint8_t receivedChar = UARTCharGet((uint32_t)UART1_MODULE);
+            uint32_t actual = ((clock * 4U) + (divisor / 2U)) / divisor;
 
-            /* Check if the received character is either '#' or Enter (ASCII 13).
-             * If either condition is met, it breaks out of the loop then
-             * prints the received data */
-            if((receivedChar == '#') || (receivedChar == 13U))
+            if (highSpeed)
             {
-                break;
+                actual *= 2U;
             }
 
-            /* This condition is used to print the below message only once */
-            if(receive_flag)
+            else
             {
-                UARTprint("Messege Received : ");
-                receive_flag = 0U;
+
             }
 
-            /* Send the received message on UART1 to UART0 to be displayed over the terminal */
-            UARTCharPut((uint32_t)UART0_MODULE, receivedChar);
+            info->requested = baudRate;
+            info->actual = actual;
+            info->errorPercentX100 = (int32_t)((((int64_t)actual - (int64_t)baudRate) * 10000) / (int64_t)baudRate);
+            info->integerDivisor = (uint16_t)(divisor >> 6);
+            info->fractionDivisor = (uint8_t)(divisor & 0x3FU);
+            info->highSpeed = highSpeed;
+            valid = true;
         }
 
         else
@@ -210,19 +2117,50 @@ void UARTSendandReceive(void)
         }
     }
 
-    /* Verify whether the message size exceeds the permitted limit */
-    if ((m < (uint32_t)MAX_UART_SEND_CHARS) && (m != 0U))
+    else
+    {
+
+    }
+
+    return valid;
+}
+
+/*
+ * Description :
+ * This function changes the baud rate of a UART module, keeping its
+ * enabled/disabled state and FIFO setting. Bytes still queued are sent
+ * at the new rate, call UARTFlush() first to send them at the old one.
+ * Parameters: base     -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ *             baudRate -> The new baud rate.
+ * Returns: true if the rate was applied, false if it is out of range.
+ */
+bool UARTSetBaudRate(uint32_t base, uint32_t baudRate)
+{
+    bool applied = false;
+    uartChannel_t *channel = UARTGetChannel(base);
+    uartBaudInfo_t info;
+
+    if ((NULL != channel) && UARTGetBaudInfo(baudRate, &info))
     {
-        UARTprint("Message Sent : ");
+        bool enabled = UARTIsEnabled(base);
+
+        /* UARTConfigSetExpClk() selects the high-speed mode by itself and
+         * leaves the UART enabled with the FIFOs turned on */
+        UARTConfigSetExpClk(base, ClockGetHz(), baudRate, channel->bus ? UART_BUS_LINE_CONFIG : UART_LINE_CONFIG);
+        UARTFIFOConfigure(base);
+
+        if (!enabled)
+        {
+            UARTDisable(base);
+        }
 
-        for(j = 0U; j < m; j++)
+        else
         {
-            /* Send the message character by charcater to UART0
-             * to be displayed over the terminal and to UART1 to be sent
-             * to the other board */
-            UARTCharPut((uint32_t)UART0_MODULE, data[j]);
-            UARTCharPut((uint32_t)UART1_MODULE, data[j]);
+
         }
+
+        channel->baudRate = baudRate;
+        applied = true;
     }
 
     else
@@ -230,32 +2168,93 @@ void UARTSendandReceive(void)
 
     }
 
-    flag_interrupt = 1U;
-    receive_flag = 1U;
+    return applied;
+}
 
-    /* New line */
-    UARTprint("\n\r");
+/*
+ * Description :
+ * This function returns the baud rate of a UART module.
+ * Parameters: base -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ * Returns: The baud rate, 0 for an unsupported module.
+ */
+uint32_t UARTGetBaudRate(uint32_t base)
+{
+    uint32_t baudRate = 0U;
+    uartChannel_t *channel = UARTGetChannel(base);
+
+    if (NULL != channel)
+    {
+        baudRate = channel->baudRate;
+    }
+
+    else
+    {
+
+    }
 
+    return baudRate;
 }
 
 /*
  * Description :
- * This function sends a text message over UART
- * communication by taking a null-terminated
- * string as input then iterating through each
- * character in the string.
- * Parameters: text-> The null-terminated string to be transmitted over UART.
+ * This function prints the common baud rates on the terminal with the
+ * rate actually produced, its error and the oversampling mode.
+ * Parameters: None.
  * Returns: None.
  */
-void UARTprint(const char* text)
+void UARTPrintBaudTable(void)
 {
-    uint16_t k;
+    static const uint32_t baudRates[] = {
+        9600U, 19200U, 38400U, 57600U, 115200U, 230400U, 460800U, 921600U,
+        1000000U, 1500000U, 2000000U, 2500000U, 3000000U, 4000000U, 5000000U,
+        6000000U, 8000000U, 10000000U
+    };
+    uint8_t i;
 
-    for(k = 0U ; k < strlen(text) ; k++)
+    UARTprint("Clock: ");
+    UARTprintDecimal(ClockGetHz());
+    UARTprint(" Hz\n\rBaud\tActual\tError\tMode\n\r");
+
+    for (i = 0U; i < (uint8_t)(sizeof(baudRates) / sizeof(baudRates[0])); i++)
     {
-        /* Send the message character by character till
-         * reaching the null terminator */
-        UARTCharPut((uint32_t)UART0_MODULE, (uint8_t)(text[k]));
+        uartBaudInfo_t info;
+
+        UARTprintDecimal(baudRates[i]);
+        UARTprint("\t");
+
+        if (UARTGetBaudInfo(baudRates[i], &info))
+        {
+            UARTprintDecimal(info.actual);
+            UARTprint("\t");
+            UARTprintPercentX100(info.errorPercentX100);
+            UARTprint(info.highSpeed ? "\t8x\n\r" : "\t16x\n\r");
+        }
+
+        else
+        {
+            UARTprint("-\t-\t-\n\r");
+        }
     }
+}
+
+/*
+ * Description :
+ * This function prints an unsigned number in decimal on the terminal.
+ * Parameters: value -> The number to be printed.
+ * Returns: None.
+ */
+void UARTprintDecimal(uint32_t value)
+{
+    uint8_t digits[10];
+    uint8_t count = 0U;
+
+    /* Fill the digits from the last one */
+    do
+    {
+        count++;
+        digits[sizeof(digits) - count] = (uint8_t)('0' + (value % 10U));
+        value /= 10U;
+    } while (value != 0U);
 
+    UARTWriteAll((uint32_t)UART0_MODULE, &digits[sizeof(digits) - count], (uint16_t)count);
 }
@@ -29,6 +29,8 @@
 #include "driverlib/uart.h"
 #include "inc/hw_ints.h"
 #include "driverlib/interrupt.h"
+#include "HAL/ring_buffer.h"
+#include "HAL/clock.h"
 
 /*******************************************************************************
  *                                Definitions                                  *
@@ -49,7 +51,184 @@
 #define UART1_TX_PIN GPIO_PIN_1
 #define UART1_RX_PIN GPIO_PIN_0
 
-#define MAX_UART_SEND_CHARS 200
+/* UART3 configuration */
+#define UART3_MODULE UART3_BASE
+#define UART3_PERIPH SYSCTL_PERIPH_UART3
+#define UART3_GPIO_PERIPH SYSCTL_PERIPH_GPIOC
+#define UART3_GPIO_BASE GPIO_PORTC_BASE
+#define UART3_TX_PIN GPIO_PIN_7
+#define UART3_RX_PIN GPIO_PIN_6
+
+/* Spare link configuration:
+ * UART3_LINK_MODE turns UART3 (PC6 RX, PC7 TX) into a second link port when
+ * 1U, so that a further board can be chained to this one and reached
+ * through it (see net.h), or leaves UART3 unused when 0U. It runs at
+ * UART3_BAUD_RATE, the baud rate negotiation only moves UART1. The host
+ * simulation build sets it from the command line. */
+#ifndef UART3_LINK_MODE
+#define UART3_LINK_MODE 0U
+#endif
+#define UART3_BAUD_RATE 115200U
+
+/* RS-485 multidrop configuration:
+ * UART3_MULTIDROP_MODE puts the UART3 link port on a half-duplex RS-485 bus
+ * shared by many boards when 1U (UART3_LINK_MODE must be 1U). UART3 runs in
+ * 9-bit mode: every transmission starts with an address byte, the 9th bit
+ * set, naming the board it is for (UARTSetBusAddress()), and the address
+ * match hardware of every other board drops the bytes that follow without
+ * raising an interrupt, so the load of a board does not grow with the
+ * traffic between the others. The data bytes carry a 9th bit of 0
+ * (UART_BUS_LINE_CONFIG, stick parity). The transceiver driver enable, with
+ * the active low receiver enable tied to it, is driven on UART3_DE_PIN from
+ * the first byte of a transmission until its last stop bit is out (end of
+ * transmission interrupt). The bus has no arbitration: frames sent at the
+ * same time are lost and sent again by the reliable delivery layer. */
+#ifndef UART3_MULTIDROP_MODE
+#define UART3_MULTIDROP_MODE 0U
+#endif
+#define UART3_DE_GPIO_PERIPH SYSCTL_PERIPH_GPIOC
+#define UART3_DE_GPIO_BASE GPIO_PORTC_BASE
+#define UART3_DE_PIN GPIO_PIN_5
+#define UART_BUS_LINE_CONFIG ((uint32_t)UART_CONFIG_WLEN_8 | (uint32_t)UART_CONFIG_STOP_ONE | (uint32_t)UART_CONFIG_PAR_ZERO)
+
+#if ((UART3_MULTIDROP_MODE == 1U) && (UART3_LINK_MODE != 1U))
+#error "UART3_MULTIDROP_MODE needs UART3_LINK_MODE"
+#endif
+
+/* Messages of any length are sent, cut into fragments (see frag.h), the
+ * "Message Sent : " echo shows them MAX_UART_SEND_CHARS characters at a time */
+#define MAX_UART_SEND_CHARS 200U
+
+/* Baud rate configuration:
+ * UART0_BAUD_RATE and UART1_BAUD_RATE are applied by UARTInit(), UART1 can be
+ * moved to another rate at runtime with UARTSetBaudRate(). Rates above
+ * ClockGetHz() / 16 use the high-speed mode (8x oversampling), up to
+ * ClockGetHz() / 8, that is 10 Mbaud with the 80 MHz PLL clock.
+ * UART_PRINT_BAUD_TABLE prints the achievable rates and their error on
+ * the terminal at startup when 1U. */
+#define UART0_BAUD_RATE 115200U
+#define UART1_BAUD_RATE 115200U
+#define UART_LINE_CONFIG ((uint32_t)UART_CONFIG_WLEN_8 | (uint32_t)UART_CONFIG_STOP_ONE | (uint32_t)UART_CONFIG_PAR_NONE)
+#define UART_PRINT_BAUD_TABLE 0U
+
+/* Hardware FIFO configuration:
+ * UART_FIFO_MODE enables the 16 byte hardware FIFOs of UART0 and UART1 when 1U,
+ * or keeps the single byte holding register (one interrupt per byte) when 0U.
+ * UART_RX_FIFO_LEVEL raises the RX interrupt once the RX FIFO holds at least
+ * 1/8, 2/8, 4/8, 6/8 or 7/8 of its 16 bytes (UART_FIFO_RX1_8 ... UART_FIFO_RX7_8),
+ * a partial burst below that level is flushed by the RX timeout interrupt.
+ * UART_TX_FIFO_LEVEL raises the TX interrupt once the TX FIFO drains down to
+ * 1/8 ... 7/8 of its 16 bytes (UART_FIFO_TX1_8 ... UART_FIFO_TX7_8). */
+#define UART_FIFO_MODE 1U
+#define UART_RX_FIFO_LEVEL UART_FIFO_RX4_8
+#define UART_TX_FIFO_LEVEL UART_FIFO_TX2_8
+
+/* uDMA transport configuration:
+ * UART1_DMA_MODE moves the UART1 data with the uDMA controller when 1U, using
+ * ping-pong RX blocks and basic mode TX transfers read in place from the UART1
+ * transmit ring buffer, or with the UART1 RX/TX interrupts when 0U. The
+ * host simulation build sets it from the command line. */
+#ifndef UART1_DMA_MODE
+#define UART1_DMA_MODE 0U
+#endif
+
+/* Streaming send configuration:
+ * UART_STREAM_MODE forwards the characters typed in the send and receive state
+ * to the other board while they are being typed when 1U, or sends the
+ * message once the terminator ('#' or Enter) is typed when 0U. A frame leaves
+ * as soon as the send window has room, carrying every character typed since
+ * the previous one, up to UART_STREAM_SEGMENT_SIZE characters. When
+ * UART_STREAM_COALESCE_US is not 0U, a frame also waits up to that long after
+ * its first character for the next ones, trading latency for fewer frames.
+ * UART_STREAM_ECHO_MESSAGE keeps the "Message Sent : " echo of the whole
+ * message after the terminator when 1U, or echoes every character as it is
+ * typed when 0U. In store and forward mode a fragment of FRAG_MAX_DATA
+ * characters leaves whenever that many were typed, so a message may be
+ * longer than the RAM set aside for it in both modes. */
+#define UART_STREAM_MODE 1U
+#define UART_STREAM_SEGMENT_SIZE 32U
+#define UART_STREAM_COALESCE_US 0U
+#define UART_STREAM_ECHO_MESSAGE 1U
+
+/* Message timestamps:
+ * UART_SHOW_TIMESTAMPS adds to the label of a received message the time its
+ * first fragment arrived, on the timebase of this board in microseconds,
+ * and the time it took to come once a receipt gave the offset of the
+ * sender's clock (see frag.h), when 1U. */
+#define UART_SHOW_TIMESTAMPS 0U
+
+/* Receive and transmit ring buffer sizes, each one must be a power of two */
+#define UART0_RX_BUFFER_SIZE 64U
+#define UART1_RX_BUFFER_SIZE 256U
+#define UART0_TX_BUFFER_SIZE 256U
+#define UART1_TX_BUFFER_SIZE 512U
+#define UART3_RX_BUFFER_SIZE 256U
+#define UART3_TX_BUFFER_SIZE 512U
+
+/* Waiting writes configuration:
+ * UARTWriteAll() and UARTFlush() wait for the UART ISR to drain the transmit
+ * ring buffer. They stop waiting at once when the UART module is disabled,
+ * and when no byte left it for UART_DRAIN_TIMEOUT_MS (the interrupts masked,
+ * the module stuck), so they never hang the main loop. */
+#define UART_DRAIN_TIMEOUT_MS 100U
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Structure holding the traffic counters of a UART module.
+ *              - rxInterrupts : UART interrupts raised by received data (RX or RX timeout).
+ *              - txInterrupts : UART interrupts raised by the transmitter.
+ *              - rxBytes      : Bytes moved from the UART into the receive ring buffer.
+ *              - rxDropped    : Bytes lost because the receive ring buffer was full.
+ *              - rxOverrun    : Hardware overrun events reported by the UART.
+ *              - rxFraming    : Bytes received without a valid stop bit.
+ *              - rxParity     : Bytes received with a parity error.
+ *              - rxBreak      : Break conditions seen on the RX line.
+ *              - txBytes      : Bytes moved from the transmit ring buffer into the UART.
+ *              - txRejected   : Bytes refused by a non-blocking write because the
+ *                               transmit ring buffer was full (backpressure).
+ *              - txAddresses  : Address bytes sent ahead of the transmissions on
+ *                               an RS-485 bus (UART3_MULTIDROP_MODE).
+ *              A loss free link keeps rxDropped, rxOverrun and the line errors
+ *              (rxFraming, rxParity, rxBreak) at zero, and
+ *              rxInterrupts/rxBytes and txInterrupts/txBytes give the interrupts
+ *              per byte used to compare FIFO settings.
+ */
+typedef struct
+{
+    uint32_t rxInterrupts;
+    uint32_t txInterrupts;
+    uint32_t rxBytes;
+    uint32_t rxDropped;
+    uint32_t rxOverrun;
+    uint32_t rxFraming;
+    uint32_t rxParity;
+    uint32_t rxBreak;
+    uint32_t txBytes;
+    uint32_t txRejected;
+    uint32_t txAddresses;
+} uartStats_t;
+
+/*
+ * Description: Structure describing how a baud rate is produced by the
+ *              fractional baud rate generator.
+ *              - requested        : The requested baud rate.
+ *              - actual           : The baud rate actually produced.
+ *              - errorPercentX100 : The error of the actual rate, in 1/100 %.
+ *              - integerDivisor   : The UARTIBRD value.
+ *              - fractionDivisor  : The UARTFBRD value (1/64 steps).
+ *              - highSpeed        : The rate needs the high-speed (8x) mode.
+ */
+typedef struct
+{
+    uint32_t requested;
+    uint32_t actual;
+    int32_t errorPercentX100;
+    uint16_t integerDivisor;
+    uint8_t fractionDivisor;
+    bool highSpeed;
+} uartBaudInfo_t;
 
 /*******************************************************************************
  *                      Functions Prototypes                                   *
@@ -83,6 +262,24 @@ void UARTOff(void);
  */
 void UARTListen(void);
 
+/*
+ * Description :
+ * This function runs the listening mode once: it serves the links and
+ * shows a message from another board fragment by fragment, on a line of
+ * its own once it is complete.
+ * Parameters: None.
+ * Returns: true if it must run again without waiting for an event.
+ */
+bool UARTListenStep(void);
+
+/*
+ * Description :
+ * This function leaves the listening mode.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UARTListenLeave(void);
+
 /*
  * Description :
  * This function applies bidirectional UART
@@ -93,15 +290,249 @@ void UARTListen(void);
  */
 void UARTSendandReceive(void);
 
+/*
+ * Description :
+ * This function runs the bidirectional communication once: it takes a
+ * character typed on the terminal, shows what the other boards send and
+ * sends the typed characters once they are due. Both directions go on
+ * at every run, so neither waits for the other.
+ * Parameters: None.
+ * Returns: true if it must run again without waiting for an event.
+ */
+bool UARTSendandReceiveStep(void);
+
+/*
+ * Description :
+ * This function leaves the bidirectional communication, the message
+ * being typed ends with what was typed. Its last fragment is tried once,
+ * the other board may not acknowledge any more.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UARTSendandReceiveLeave(void);
+
 /*
  * Description :
  * This function sends a text message over UART
  * communication by taking a null-terminated
- * string as input then iterating through each
- * character in the string.
+ * string as input and queuing it on the UART0
+ * transmit ring buffer, it only waits while the
+ * ring buffer is full.
  * Parameters: text-> The null-terminated string to be transmitted over UART.
  * Returns: None.
  */
 void UARTprint(const char* text);
 
+/*
+ * Description :
+ * Interrupt Service Routine for UART0, it moves every received
+ * character from the UART into the UART0 receive ring buffer
+ * and refills the UART from the UART0 transmit ring buffer.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UART0ISR(void);
+
+/*
+ * Description :
+ * Interrupt Service Routine for UART1, it moves every received
+ * character from the UART into the UART1 receive ring buffer
+ * and refills the UART from the UART1 transmit ring buffer.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UART1ISR(void);
+
+/*
+ * Description :
+ * Interrupt Service Routine for UART3, it moves every received
+ * character from the UART into the UART3 receive ring buffer
+ * and refills the UART from the UART3 transmit ring buffer.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UART3ISR(void);
+
+/*
+ * Description :
+ * This function reads one received character from the
+ * receive ring buffer of a UART module without blocking.
+ * Parameters: base -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ *             data -> A pointer to the variable where the character will be stored.
+ * Returns: true if a character was read, false if nothing was received.
+ */
+bool UARTReceive(uint32_t base, uint8_t *data);
+
+/*
+ * Description :
+ * This function returns the number of received characters
+ * waiting in the receive ring buffer of a UART module.
+ * Parameters: base -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ * Returns: The number of characters waiting to be read.
+ */
+uint16_t UARTRxAvailable(uint32_t base);
+
+/*
+ * Description :
+ * This function queues a buffer for transmission on a UART module
+ * without blocking, the bytes are sent in the background by the UART ISR.
+ * Parameters: base   -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ *             buffer -> The bytes to be transmitted.
+ *             length -> The number of bytes to be transmitted.
+ * Returns: The number of bytes queued, less than length when the
+ *          transmit ring buffer is full.
+ */
+uint16_t UARTWrite(uint32_t base, const uint8_t *buffer, uint16_t length);
+
+/*
+ * Description :
+ * This function queues a whole buffer for transmission, waiting
+ * only while the transmit ring buffer is full. The bytes that still do
+ * not fit when the UART module is disabled or stopped draining for
+ * UART_DRAIN_TIMEOUT_MS are refused and counted as rejected.
+ * Parameters: base   -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ *             buffer -> The bytes to be transmitted.
+ *             length -> The number of bytes to be transmitted.
+ * Returns: None.
+ */
+void UARTWriteAll(uint32_t base, const uint8_t *buffer, uint16_t length);
+
+/*
+ * Description :
+ * This function queues a null-terminated string for transmission
+ * on a UART module without blocking.
+ * Parameters: base -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ *             text -> The null-terminated string to be transmitted.
+ * Returns: The number of characters queued, less than the string
+ *          length when the transmit ring buffer is full.
+ */
+uint16_t UARTWriteString(uint32_t base, const char *text);
+
+/*
+ * Description :
+ * This function queues a single byte for transmission
+ * on a UART module without blocking.
+ * Parameters: base -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ *             data -> The byte to be transmitted.
+ * Returns: true if the byte was queued, false if the transmit ring buffer is full.
+ */
+bool UARTWriteByte(uint32_t base, uint8_t data);
+
+/*
+ * Description :
+ * This function returns the free space in the transmit
+ * ring buffer of a UART module.
+ * Parameters: base -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ * Returns: The number of bytes that can be queued without being refused.
+ */
+uint16_t UARTTxFree(uint32_t base);
+
+/*
+ * Description :
+ * This function waits until every queued byte of a UART module
+ * has been transmitted, including the last stop bit. It does not wait
+ * for a disabled UART module, nor longer than UART_DRAIN_TIMEOUT_MS
+ * without a byte leaving.
+ * Parameters: base -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ * Returns: true if every byte was transmitted, false if the wait was given up.
+ */
+bool UARTFlush(uint32_t base);
+
+/*
+ * Description :
+ * This function tells whether a UART module is enabled, its ISR only
+ * drains the transmit ring buffer then.
+ * Parameters: base -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ * Returns: true if the UART module is enabled.
+ */
+bool UARTIsEnabled(uint32_t base);
+
+/*
+ * Description :
+ * This function tells whether the links must be polled again without
+ * waiting for an event. In uDMA mode the bytes of a partially filled
+ * block raise no interrupt: the states collect them on the SysTick tick,
+ * and poll again as long as each poll collects new bytes, so the end of
+ * a frame is not held for a tick. The other bytes post their own events.
+ * Parameters: None.
+ * Returns: true if the links must be polled.
+ */
+bool UARTLinkPolling(void);
+
+/*
+ * Description :
+ * This function sets the addresses of a UART module on an RS-485 bus:
+ * the hardware only takes in the bytes that follow an address byte equal
+ * to its own address, and every transmission it starts is preceded by
+ * the address byte of the receiving board.
+ * Parameters: base        -> The UART module (UART3_MODULE with UART3_MULTIDROP_MODE).
+ *             address     -> The address of this board on the bus.
+ *             destination -> The address of the board the transmissions are for.
+ * Returns: true if the UART module is on a bus, false otherwise.
+ */
+bool UARTSetBusAddress(uint32_t base, uint8_t address, uint8_t destination);
+
+/*
+ * Description :
+ * This function copies the traffic counters of a UART module.
+ * Parameters: base  -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ *             stats -> A pointer to the structure where the counters will be stored.
+ * Returns: None.
+ */
+void UARTGetStats(uint32_t base, uartStats_t *stats);
+
+/*
+ * Description :
+ * This function clears the traffic counters of a UART module.
+ * Parameters: base -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ * Returns: None.
+ */
+void UARTResetStats(uint32_t base);
+
+/*
+ * Description :
+ * This function computes the divisors and the error of a baud rate
+ * with the current system clock, the same way UARTConfigSetExpClk() does.
+ * Parameters: baudRate -> The requested baud rate.
+ *             info     -> A pointer to the structure where the result will be stored.
+ * Returns: true if the rate can be produced, false if it is out of range.
+ */
+bool UARTGetBaudInfo(uint32_t baudRate, uartBaudInfo_t *info);
+
+/*
+ * Description :
+ * This function changes the baud rate of a UART module, keeping its
+ * enabled/disabled state and FIFO setting. Bytes still queued are sent
+ * at the new rate, call UARTFlush() first to send them at the old one.
+ * Parameters: base     -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ *             baudRate -> The new baud rate.
+ * Returns: true if the rate was applied, false if it is out of range.
+ */
+bool UARTSetBaudRate(uint32_t base, uint32_t baudRate);
+
+/*
+ * Description :
+ * This function returns the baud rate of a UART module.
+ * Parameters: base -> The UART module (UART0_MODULE, UART1_MODULE or UART3_MODULE).
+ * Returns: The baud rate, 0 for an unsupported module.
+ */
+uint32_t UARTGetBaudRate(uint32_t base);
+
+/*
+ * Description :
+ * This function prints the common baud rates on the terminal with the
+ * rate actually produced, its error and the oversampling mode.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UARTPrintBaudTable(void);
+
+/*
+ * Description :
+ * This function prints an unsigned number in decimal on the terminal.
+ * Parameters: value -> The number to be printed.
+ * Returns: None.
+ */
+void UARTprintDecimal(uint32_t value);
+
 #endif /* UART_API_H_ */
@@ -0,0 +1,339 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   UART_DMA.c                                                   *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the UART1 uDMA transport used by the         *
+ *                UART APIs when UART1_DMA_MODE is enabled                     *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include "HAL/UART_DMA.h"
+#include "HAL/sched.h"
+
+#if (UART1_DMA_MODE == 1U)
+
+/*******************************************************************************
+ *                            Global Variables                                 *
+ *******************************************************************************/
+/* The uDMA channel control table must be aligned on a 1024 byte boundary */
+#if defined(ccs)
+#pragma DATA_ALIGN(udmaControlTable, 1024)
+static uint8_t udmaControlTable[1024];
+#else
+static uint8_t udmaControlTable[1024] __attribute__ ((aligned(1024)));
+#endif
+
+/* The two ping-pong receive blocks, block 0 is described by the primary
+ * control structure and block 1 by the alternate one */
+static uint8_t rxBlock[2][UART1_DMA_RX_BLOCK_SIZE];
+
+/* The block the uDMA controller is currently filling */
+static uint8_t rxActiveBlock = 0U;
+
+/* The bytes of the active block already copied into the receive ring buffer */
+static uint32_t rxCollected = 0U;
+
+/* The bytes of the transmit ring buffer handed to the current TX transfer */
+static uint16_t txInFlight = 0U;
+
+static uint32_t dmaErrorCount = 0U;
+
+static ringBuffer_t *uart1RxRing = NULL;
+static ringBuffer_t *uart1TxRing = NULL;
+static uartStats_t *uart1Stats = NULL;
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static void UART1DMARxCopy(uint32_t from, uint32_t to);
+static void UART1DMARxArm(uint8_t block);
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function copies a range of the active RX block into the
+ * receive ring buffer, counting any byte that does not fit.
+ * Parameters: from -> The first byte of the range.
+ *             to   -> One past the last byte of the range.
+ * Returns: None.
+ */
+static void UART1DMARxCopy(uint32_t from, uint32_t to)
+{
+    uint32_t i;
+
+    for (i = from; i < to; i++)
+    {
+        if (RingBufferPut(uart1RxRing, rxBlock[rxActiveBlock][i]))
+        {
+            uart1Stats->rxBytes++;
+        }
+
+        else
+        {
+            uart1Stats->rxDropped++;
+        }
+    }
+}
+
+/*
+ * Description :
+ * This function hands an RX block back to the uDMA controller.
+ * Parameters: block -> The block to be armed (0 primary, 1 alternate).
+ * Returns: None.
+ */
+static void UART1DMARxArm(uint8_t block)
+{
+    uint32_t select = (block == 0U) ? (uint32_t)UDMA_PRI_SELECT : (uint32_t)UDMA_ALT_SELECT;
+
+    uDMAChannelTransferSet((uint32_t)UDMA_CHANNEL_UART1RX | select, (uint32_t)UDMA_MODE_PINGPONG,
+                           (void *)(UART1_BASE + UART_O_DR), rxBlock[block], (uint32_t)UART1_DMA_RX_BLOCK_SIZE);
+}
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function initializes the uDMA controller and the UART1 RX/TX
+ * channels. The RX channel runs in ping-pong mode between two blocks
+ * forever, the TX channel runs basic mode transfers straight out of
+ * the UART1 transmit ring buffer.
+ * Parameters: rxRing -> The UART1 receive ring buffer to be filled.
+ *             txRing -> The UART1 transmit ring buffer to be drained.
+ *             stats  -> The UART1 traffic counters to be updated.
+ * Returns: None.
+ */
+void UART1DMAInit(ringBuffer_t *rxRing, ringBuffer_t *txRing, uartStats_t *stats)
+{
+    uart1RxRing = rxRing;
+    uart1TxRing = txRing;
+    uart1Stats = stats;
+
+    /* Enable the uDMA controller */
+    SysCtlPeripheralEnable((uint32_t)SYSCTL_PERIPH_UDMA);
+    uDMAIntRegister((uint32_t)UDMA_INT_ERR, &UART1DMAErrorISR);
+    uDMAEnable();
+    uDMAControlBaseSet(udmaControlTable);
+
+    /* Make sure channels 22 and 23 are mapped to UART1 */
+    uDMAChannelAssign((uint32_t)UDMA_CH22_UART1RX);
+    uDMAChannelAssign((uint32_t)UDMA_CH23_UART1TX);
+
+    /* RX: byte by byte from the UART1 data register into the ping-pong blocks,
+     * single requests are kept so the UART FIFO never holds bytes back */
+    uDMAChannelAttributeDisable((uint32_t)UDMA_CHANNEL_UART1RX, (uint32_t)UDMA_ATTR_ALL);
+    uDMAChannelControlSet((uint32_t)UDMA_CHANNEL_UART1RX | (uint32_t)UDMA_PRI_SELECT,
+                          (uint32_t)UDMA_SIZE_8 | (uint32_t)UDMA_SRC_INC_NONE | (uint32_t)UDMA_DST_INC_8 | (uint32_t)UDMA_ARB_4);
+    uDMAChannelControlSet((uint32_t)UDMA_CHANNEL_UART1RX | (uint32_t)UDMA_ALT_SELECT,
+                          (uint32_t)UDMA_SIZE_8 | (uint32_t)UDMA_SRC_INC_NONE | (uint32_t)UDMA_DST_INC_8 | (uint32_t)UDMA_ARB_4);
+    rxActiveBlock = 0U;
+    rxCollected = 0U;
+    UART1DMARxArm(0U);
+    UART1DMARxArm(1U);
+
+    /* TX: byte by byte from the transmit ring buffer into the UART1 data register */
+    uDMAChannelAttributeDisable((uint32_t)UDMA_CHANNEL_UART1TX, (uint32_t)UDMA_ATTR_ALL);
+    uDMAChannelControlSet((uint32_t)UDMA_CHANNEL_UART1TX | (uint32_t)UDMA_PRI_SELECT,
+                          (uint32_t)UDMA_SIZE_8 | (uint32_t)UDMA_SRC_INC_8 | (uint32_t)UDMA_DST_INC_NONE | (uint32_t)UDMA_ARB_4);
+    txInFlight = 0U;
+
+    /* Let UART1 request uDMA transfers and start receiving */
+    UARTDMAEnable((uint32_t)UART1_BASE, (uint32_t)UART_DMA_RX | (uint32_t)UART_DMA_TX);
+    uDMAChannelEnable((uint32_t)UDMA_CHANNEL_UART1RX);
+}
+
+/*
+ * Description :
+ * This function handles the UART1 interrupt raised by the uDMA controller
+ * when an RX block is full or a TX transfer is done, it must be called
+ * from the UART1 ISR.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UART1DMAIntHandler(void)
+{
+    /* A full RX block is what raised the interrupt on the receive side */
+    if (UART1DMARxCollect())
+    {
+        uart1Stats->rxInterrupts++;
+        SchedPost(SCHED_EVENT_LINK);
+    }
+
+    else
+    {
+
+    }
+
+    /* The TX channel disables itself once the transfer is done */
+    if ((txInFlight != 0U) && !uDMAChannelIsEnabled((uint32_t)UDMA_CHANNEL_UART1TX))
+    {
+        uart1Stats->txInterrupts++;
+        UART1DMATxStart();
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function copies the bytes written by the uDMA controller since
+ * the last call into the UART1 receive ring buffer, including those of
+ * a partially filled block. It must run from the UART1 ISR or with the
+ * UART1 interrupt masked.
+ * Parameters: None.
+ * Returns: true if at least one full block was collected.
+ */
+bool UART1DMARxCollect(void)
+{
+    bool blockDone = false;
+    bool done = false;
+
+    while (!done)
+    {
+        uint32_t select = (rxActiveBlock == 0U) ? (uint32_t)UDMA_PRI_SELECT : (uint32_t)UDMA_ALT_SELECT;
+
+        if (uDMAChannelModeGet((uint32_t)UDMA_CHANNEL_UART1RX | select) == (uint32_t)UDMA_MODE_STOP)
+        {
+            /* The block is full and the controller moved to the other one,
+             * take the rest of it, give it back and follow the controller */
+            UART1DMARxCopy(rxCollected, (uint32_t)UART1_DMA_RX_BLOCK_SIZE);
+            UART1DMARxArm(rxActiveBlock);
+            rxActiveBlock ^= 1U;
+            rxCollected = 0U;
+            blockDone = true;
+        }
+
+        else
+        {
+            /* Take whatever was written so far in the block being filled */
+            uint32_t written = (uint32_t)UART1_DMA_RX_BLOCK_SIZE - uDMAChannelSizeGet((uint32_t)UDMA_CHANNEL_UART1RX | select);
+            UART1DMARxCopy(rxCollected, written);
+            rxCollected = written;
+            done = true;
+        }
+    }
+
+    /* The controller stops once both blocks are full, start it again
+     * now that they are given back */
+    if (blockDone && !uDMAChannelIsEnabled((uint32_t)UDMA_CHANNEL_UART1RX))
+    {
+        uDMAChannelEnable((uint32_t)UDMA_CHANNEL_UART1RX);
+    }
+
+    else
+    {
+
+    }
+
+    return blockDone;
+}
+
+/*
+ * Description :
+ * This function starts a TX transfer of the bytes queued in the UART1
+ * transmit ring buffer if the TX channel is idle. It must run from the
+ * UART1 ISR or with the UART1 interrupt masked.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UART1DMATxStart(void)
+{
+    if (!uDMAChannelIsEnabled((uint32_t)UDMA_CHANNEL_UART1TX))
+    {
+        volatile uint8_t *data;
+        uint16_t count;
+
+        /* Release the bytes of the finished transfer */
+        if (txInFlight != 0U)
+        {
+            RingBufferSkip(uart1TxRing, txInFlight);
+            uart1Stats->txBytes += txInFlight;
+            txInFlight = 0U;
+        }
+
+        else
+        {
+
+        }
+
+        /* Send the next contiguous part of the ring buffer in place */
+        count = RingBufferPeekContiguous(uart1TxRing, &data);
+
+        if (count > (uint16_t)UART1_DMA_MAX_TRANSFER)
+        {
+            count = (uint16_t)UART1_DMA_MAX_TRANSFER;
+        }
+
+        else
+        {
+
+        }
+
+        if (count != 0U)
+        {
+            txInFlight = count;
+            uDMAChannelTransferSet((uint32_t)UDMA_CHANNEL_UART1TX | (uint32_t)UDMA_PRI_SELECT, (uint32_t)UDMA_MODE_BASIC,
+                                   (void *)data, (void *)(UART1_BASE + UART_O_DR), (uint32_t)count);
+            uDMAChannelEnable((uint32_t)UDMA_CHANNEL_UART1TX);
+        }
+
+        else
+        {
+
+        }
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * Interrupt Service Routine for the uDMA error interrupt, it counts
+ * and clears bus errors raised by the uDMA controller.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UART1DMAErrorISR(void)
+{
+    if (uDMAErrorStatusGet() != 0U)
+    {
+        uDMAErrorStatusClear();
+        dmaErrorCount++;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function returns the number of uDMA bus errors seen so far.
+ * Parameters: None.
+ * Returns: The number of uDMA bus errors.
+ */
+uint32_t UART1DMAGetErrorCount(void)
+{
+    return dmaErrorCount;
+}
+
+#endif /* UART1_DMA_MODE */
@@ -0,0 +1,108 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   UART_DMA.h                                                   *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file for the UART1 uDMA transport used by the         *
+ *                UART APIs when UART1_DMA_MODE is enabled                     *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef UART_DMA_H_
+#define UART_DMA_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_memmap.h"
+#include "inc/hw_uart.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+#include "driverlib/udma.h"
+#include "HAL/ring_buffer.h"
+#include "HAL/UART_API.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* Size of each of the two ping-pong receive blocks, the receive ring buffer
+ * only gets the bytes of a block once the block is full or when the reader
+ * collects a partially filled block, so keep it small for chat traffic */
+#define UART1_DMA_RX_BLOCK_SIZE 32U
+
+/* The uDMA controller cannot move more than 1024 items per transfer */
+#define UART1_DMA_MAX_TRANSFER 1024U
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function initializes the uDMA controller and the UART1 RX/TX
+ * channels. The RX channel runs in ping-pong mode between two blocks
+ * forever, the TX channel runs basic mode transfers straight out of
+ * the UART1 transmit ring buffer.
+ * Parameters: rxRing -> The UART1 receive ring buffer to be filled.
+ *             txRing -> The UART1 transmit ring buffer to be drained.
+ *             stats  -> The UART1 traffic counters to be updated.
+ * Returns: None.
+ */
+void UART1DMAInit(ringBuffer_t *rxRing, ringBuffer_t *txRing, uartStats_t *stats);
+
+/*
+ * Description :
+ * This function handles the UART1 interrupt raised by the uDMA controller
+ * when an RX block is full or a TX transfer is done, it must be called
+ * from the UART1 ISR.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UART1DMAIntHandler(void);
+
+/*
+ * Description :
+ * This function copies the bytes written by the uDMA controller since
+ * the last call into the UART1 receive ring buffer, including those of
+ * a partially filled block. It must run from the UART1 ISR or with the
+ * UART1 interrupt masked.
+ * Parameters: None.
+ * Returns: true if at least one full block was collected.
+ */
+bool UART1DMARxCollect(void);
+
+/*
+ * Description :
+ * This function starts a TX transfer of the bytes queued in the UART1
+ * transmit ring buffer if the TX channel is idle. It must run from the
+ * UART1 ISR or with the UART1 interrupt masked.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UART1DMATxStart(void);
+
+/*
+ * Description :
+ * Interrupt Service Routine for the uDMA error interrupt, it counts
+ * and clears bus errors raised by the uDMA controller.
+ * Parameters: None.
+ * Returns: None.
+ */
+void UART1DMAErrorISR(void);
+
+/*
+ * Description :
+ * This function returns the number of uDMA bus errors seen so far.
+ * Parameters: None.
+ * Returns: The number of uDMA bus errors.
+ */
+uint32_t UART1DMAGetErrorCount(void);
+
+#endif /* UART_DMA_H_ */
@@ -0,0 +1,1031 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   arq.c                                                        *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the go-back-N reliable delivery layer        *
+ *                running on top of the framed link                            *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <string.h>
+#include "HAL/arq.h"
+#include "HAL/lz.h"
+#include "HAL/cycle_counter.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define ARQ_WINDOW_MASK (ARQ_WINDOW_SIZE - 1U)
+
+/* LINK_FRAME_ARQ_SYNC payload: session (2), session of the other board (2), answer wanted (1) */
+#define ARQ_SYNC_LENGTH 5U
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Structure representing a slot of the send window.
+ *              - type          : The frame type, LINK_FRAME_COMPRESSED included.
+ *              - length        : The number of payload bytes, compressed or not.
+ *              - rawLength     : The number of payload bytes given to ArqSend().
+ *              - retransmitted : The frame was sent more than once, its
+ *                                acknowledgement gives no RTT sample (Karn).
+ *              - sentAt        : The time of the last transmission in ms.
+ *              - payload       : A copy of the payload bytes.
+ */
+typedef struct
+{
+    uint8_t type;
+    uint8_t length;
+    uint8_t rawLength;
+    bool retransmitted;
+    uint32_t sentAt;
+    uint8_t payload[ARQ_MAX_PAYLOAD];
+} arqSlot_t;
+
+/*
+ * Description: Structure holding the reliable delivery state of a link port.
+ *              - port                     : The link port (LINK_PORT_xxx).
+ *              - txWindow                 : The send window.
+ *              - txBase, txNext, txEnd    : Sequence numbers of the send window:
+ *                                           [txBase, txNext) sent and waiting for an
+ *                                           acknowledgement, [txNext, txEnd) accepted
+ *                                           but not sent yet (the UART had no room).
+ *              - txSent                   : End of the frames sent at least once, txNext
+ *                                           going back to txBase on a timeout.
+ *              - rxExpected               : Sequence number of the next data frame to be
+ *                                           delivered, it is also the cumulative
+ *                                           acknowledgement carried by every frame we send.
+ *              - ackPending               : The acknowledgement still has to be sent.
+ *              - rttValid, srttScaled,
+ *                rttvarScaled, rto        : Round trip estimate (RFC 6298), srtt scaled
+ *                                           by 8 and rttvar scaled by 4, and the
+ *                                           retransmission timeout in ms.
+ *              - controlHandler           : The function receiving the control frames.
+ *              - held                     : The data frames are left with the other board.
+ *              - paused                   : Nothing is sent, the UART is changing rate.
+ *              - session, peerSession     : The session numbers of this board and of the
+ *                                           other one as last heard, 0 until known.
+ *              - synced                   : The other board repeated our session number.
+ *              - syncSentAt               : The time of the last LINK_FRAME_ARQ_SYNC in ms.
+ *              - txEncoder, rxDecoder     : Histories of the compressed streams in both
+ *                                           directions, they take in every data frame,
+ *                                           compressed or not, in sequence order.
+ *              - peerDecompresses         : The other board decompresses, as told by
+ *                                           its ACK frames.
+ *              - decodedFrame             : A compressed frame once decoded, delivered
+ *                                           in place of the received one.
+ *              - startTime                : The time of ArqInit() in ms.
+ *              - stats                    : The reliable delivery counters.
+ */
+typedef struct
+{
+    uint8_t port;
+    arqSlot_t txWindow[ARQ_WINDOW_SIZE];
+    uint8_t txBase;
+    uint8_t txNext;
+    uint8_t txSent;
+    uint8_t txEnd;
+    uint8_t rxExpected;
+    bool ackPending;
+    bool rttValid;
+    uint32_t srttScaled;
+    uint32_t rttvarScaled;
+    uint32_t rto;
+    arqControlHandler_t controlHandler;
+    bool held;
+    bool paused;
+    uint16_t session;
+    uint16_t peerSession;
+    bool synced;
+    uint32_t syncSentAt;
+#if (ARQ_COMPRESSION == 1U)
+    lzEncoder_t txEncoder;
+    lzDecoder_t rxDecoder;
+    bool peerDecompresses;
+    linkFrame_t decodedFrame;
+#endif
+    uint32_t startTime;
+    arqStats_t stats;
+} arqPort_t;
+
+/*******************************************************************************
+ *                            Global Variables                                 *
+ *******************************************************************************/
+static arqPort_t arqPorts[LINK_PORT_COUNT];
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static uint32_t ArqNow(void);
+static void ArqRttSample(arqPort_t *arq, uint32_t rtt);
+static void ArqAckReceived(arqPort_t *arq, uint8_t ack);
+static void ArqTransmit(arqPort_t *arq);
+static void ArqCheckTimeout(arqPort_t *arq);
+static bool ArqSendAck(arqPort_t *arq);
+static void ArqPeerCapability(arqPort_t *arq, const linkFrame_t *frame);
+static const linkFrame_t* ArqDecode(arqPort_t *arq, const linkFrame_t *frame);
+static uint16_t ArqNewSession(uint16_t old);
+static void ArqSessionReset(arqPort_t *arq);
+static void ArqSendSync(arqPort_t *arq, bool answerWanted);
+static void ArqHandleSync(arqPort_t *arq, const linkFrame_t *frame);
+static void ArqRestart(arqPort_t *arq);
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function returns the current time.
+ * Parameters: None.
+ * Returns: The time since reset in ms, with the SysTick resolution.
+ */
+static uint32_t ArqNow(void)
+{
+    return SysticGetTicks() * SYSTICK_PERIOD_MS;
+}
+
+/*
+ * Description :
+ * This function updates the round trip estimate with a new sample and
+ * derives the retransmission timeout from it (Jacobson/Karels).
+ * Parameters: arq -> The reliable delivery state of the port.
+ *             rtt -> The measured round trip time in ms.
+ * Returns: None.
+ */
+static void ArqRttSample(arqPort_t *arq, uint32_t rtt)
+{
+    if (!arq->rttValid)
+    {
+        arq->srttScaled = rtt << 3;
+        arq->rttvarScaled = rtt << 1;
+        arq->rttValid = true;
+    }
+
+    else
+    {
+        int32_t delta = (int32_t)rtt - (int32_t)(arq->srttScaled >> 3);
+
+        /* srtt += delta / 8 */
+        arq->srttScaled = (uint32_t)((int32_t)arq->srttScaled + delta);
+
+        if (delta < 0)
+        {
+            delta = -delta;
+        }
+
+        else
+        {
+
+        }
+
+        /* rttvar += (|delta| - rttvar) / 4 */
+        arq->rttvarScaled = (arq->rttvarScaled + (uint32_t)delta) - (arq->rttvarScaled >> 2);
+    }
+
+    /* rto = srtt + max(clock granularity, 4 * rttvar) */
+    arq->rto = (arq->srttScaled >> 3) + ((arq->rttvarScaled > SYSTICK_PERIOD_MS) ? arq->rttvarScaled : SYSTICK_PERIOD_MS);
+
+    if (arq->rto < ARQ_MIN_RTO_MS)
+    {
+        arq->rto = ARQ_MIN_RTO_MS;
+    }
+
+    else if (arq->rto > ARQ_MAX_RTO_MS)
+    {
+        arq->rto = ARQ_MAX_RTO_MS;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function releases the window slots covered by a cumulative
+ * acknowledgement, measuring the round trip of the frames sent once.
+ * Parameters: arq -> The reliable delivery state of the port.
+ *             ack -> The sequence number of the next frame the other
+ *                    board expects.
+ * Returns: None.
+ */
+static void ArqAckReceived(arqPort_t *arq, uint8_t ack)
+{
+    /* Only acknowledgements of frames actually sent move the window,
+     * anything else is an old or repeated ACK. A late one may cover
+     * frames waiting to be sent again after a timeout */
+    if ((uint8_t)(ack - arq->txBase) <= (uint8_t)(arq->txSent - arq->txBase))
+    {
+        uint32_t now = ArqNow();
+
+        while (arq->txBase != ack)
+        {
+            const arqSlot_t *slot = &arq->txWindow[arq->txBase & ARQ_WINDOW_MASK];
+
+            if (!slot->retransmitted)
+            {
+                ArqRttSample(arq, now - slot->sentAt);
+            }
+
+            else
+            {
+
+            }
+
+            if (arq->txNext == arq->txBase)
+            {
+                arq->txNext++;
+            }
+
+            else
+            {
+
+            }
+
+            arq->stats.txGoodputBytes += (uint32_t)slot->rawLength;
+            arq->txBase++;
+        }
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function sends the accepted frames in order while the UART of the
+ * port has room for them, every frame carries the current acknowledgement.
+ * Nothing is sent before the session is agreed on.
+ * Parameters: arq -> The reliable delivery state of the port.
+ * Returns: None.
+ */
+static void ArqTransmit(arqPort_t *arq)
+{
+    bool room = true;
+
+    while (room && arq->synced && !arq->paused && (arq->txNext != arq->txEnd))
+    {
+        arqSlot_t *slot = &arq->txWindow[arq->txNext & ARQ_WINDOW_MASK];
+
+        room = LinkSend(arq->port, slot->type, arq->txNext, arq->rxExpected, slot->payload, slot->length);
+
+        if (room)
+        {
+            if (slot->retransmitted)
+            {
+                arq->stats.retransmits++;
+            }
+
+            else
+            {
+                arq->stats.framesSent++;
+            }
+
+            slot->sentAt = ArqNow();
+            arq->ackPending = false;
+            arq->txNext++;
+
+            if ((uint8_t)(arq->txNext - arq->txBase) > (uint8_t)(arq->txSent - arq->txBase))
+            {
+                arq->txSent = arq->txNext;
+            }
+
+            else
+            {
+
+            }
+        }
+
+        else
+        {
+
+        }
+    }
+}
+
+/*
+ * Description :
+ * This function goes back to the oldest unacknowledged frame when it
+ * was not acknowledged within the retransmission timeout, the timeout
+ * is doubled until a new round trip is measured.
+ * Parameters: arq -> The reliable delivery state of the port.
+ * Returns: None.
+ */
+static void ArqCheckTimeout(arqPort_t *arq)
+{
+    if (!arq->paused && (arq->txBase != arq->txNext) && ((ArqNow() - arq->txWindow[arq->txBase & ARQ_WINDOW_MASK].sentAt) >= arq->rto))
+    {
+        uint8_t seq;
+
+        for (seq = arq->txBase; seq != arq->txNext; seq++)
+        {
+            arq->txWindow[seq & ARQ_WINDOW_MASK].retransmitted = true;
+        }
+
+        arq->txNext = arq->txBase;
+        arq->stats.timeouts++;
+
+        arq->rto <<= 1;
+        if (arq->rto > ARQ_MAX_RTO_MS)
+        {
+            arq->rto = ARQ_MAX_RTO_MS;
+        }
+
+        else
+        {
+
+        }
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function sends an ACK frame on its own. With ARQ_COMPRESSION set
+ * its payload tells the other board that this one decompresses.
+ * Parameters: arq -> The reliable delivery state of the port.
+ * Returns: true if the UART of the port had room for the frame.
+ */
+static bool ArqSendAck(arqPort_t *arq)
+{
+#if (ARQ_COMPRESSION == 1U)
+    static const uint8_t capability[1] = {(uint8_t)LZ_WINDOW_BITS};
+
+    return LinkSend(arq->port, (uint8_t)LINK_FRAME_ACK, 0U, arq->rxExpected, capability, 1U);
+#else
+    return LinkSend(arq->port, (uint8_t)LINK_FRAME_ACK, 0U, arq->rxExpected, NULL, 0U);
+#endif
+}
+
+/*
+ * Description :
+ * This function learns from an ACK frame whether the other board
+ * decompresses with the same window, so that frames may be compressed.
+ * Parameters: arq   -> The reliable delivery state of the port.
+ *             frame -> The received ACK frame.
+ * Returns: None.
+ */
+static void ArqPeerCapability(arqPort_t *arq, const linkFrame_t *frame)
+{
+#if (ARQ_COMPRESSION == 1U)
+    arq->peerDecompresses = (frame->length == 1U) && (frame->payload[0] == (uint8_t)LZ_WINDOW_BITS);
+#else
+    (void)arq;
+    (void)frame;
+#endif
+}
+
+/*
+ * Description :
+ * This function takes a data frame received in order into the history
+ * of the compressed stream, and decodes it when it is compressed.
+ * Parameters: arq   -> The reliable delivery state of the port.
+ *             frame -> The data frame received in order.
+ * Returns: The frame to be delivered, NULL if it could not be decoded.
+ */
+static const linkFrame_t* ArqDecode(arqPort_t *arq, const linkFrame_t *frame)
+{
+#if (ARQ_COMPRESSION == 1U)
+    const linkFrame_t *delivered = frame;
+
+    if ((frame->type & (uint8_t)LINK_FRAME_COMPRESSED) != 0U)
+    {
+        uint16_t length = 0U;
+
+        arq->decodedFrame.type = (uint8_t)(frame->type & (uint8_t)~LINK_FRAME_COMPRESSED);
+        arq->decodedFrame.seq = frame->seq;
+        arq->decodedFrame.ack = frame->ack;
+
+        if (LzDecompress(&arq->rxDecoder, frame->payload, (uint16_t)frame->length,
+                         arq->decodedFrame.payload, (uint16_t)ARQ_MAX_PAYLOAD, &length))
+        {
+            arq->decodedFrame.length = (uint8_t)length;
+            delivered = &arq->decodedFrame;
+        }
+
+        else
+        {
+            arq->stats.decodeErrors++;
+            delivered = NULL;
+        }
+    }
+
+    else
+    {
+        LzDecoderAppend(&arq->rxDecoder, frame->payload, (uint16_t)frame->length);
+    }
+
+    return delivered;
+#else
+    (void)arq;
+
+    return frame;
+#endif
+}
+
+/*
+ * Description :
+ * This function picks a session number. The cycle counter read the
+ * first time a port is polled depends on when the buttons were pressed,
+ * so a board picks another number after every reset.
+ * Parameters: old -> The previous session number, 0 for none.
+ * Returns: A session number, neither 0 nor old.
+ */
+static uint16_t ArqNewSession(uint16_t old)
+{
+    uint32_t seed = CYCLE_COUNTER_GET() ^ (SysticGetTicks() << 16);
+    uint16_t session = (uint16_t)(seed ^ (seed >> 16));
+
+    if (session == old)
+    {
+        session++;
+    }
+
+    else
+    {
+
+    }
+
+    if (session == 0U)
+    {
+        session = (old != 1U) ? 1U : 2U;
+    }
+
+    else
+    {
+
+    }
+
+    return session;
+}
+
+/*
+ * Description :
+ * This function starts the sequence numbers and the compression
+ * histories over, dropping the frames of the send window, which belong
+ * to the previous session.
+ * Parameters: arq -> The reliable delivery state of the port.
+ * Returns: None.
+ */
+static void ArqSessionReset(arqPort_t *arq)
+{
+    arq->stats.framesDropped += (uint32_t)(uint8_t)(arq->txEnd - arq->txBase);
+    arq->stats.sessionResets++;
+
+    arq->txBase = 0U;
+    arq->txNext = 0U;
+    arq->txSent = 0U;
+    arq->txEnd = 0U;
+    arq->rxExpected = 0U;
+    arq->ackPending = false;
+
+#if (ARQ_COMPRESSION == 1U)
+    LzEncoderInit(&arq->txEncoder);
+    LzDecoderInit(&arq->rxDecoder);
+    arq->peerDecompresses = false;
+#endif
+}
+
+/*
+ * Description :
+ * This function sends a LINK_FRAME_ARQ_SYNC frame with the session
+ * numbers of both boards.
+ * Parameters: arq          -> The reliable delivery state of the port.
+ *             answerWanted -> The other board must answer, this one is not synced.
+ * Returns: None.
+ */
+static void ArqSendSync(arqPort_t *arq, bool answerWanted)
+{
+    uint8_t payload[ARQ_SYNC_LENGTH];
+
+    if (arq->session == 0U)
+    {
+        arq->session = ArqNewSession(0U);
+    }
+
+    else
+    {
+
+    }
+
+    payload[0] = (uint8_t)(arq->session >> 8);
+    payload[1] = (uint8_t)arq->session;
+    payload[2] = (uint8_t)(arq->peerSession >> 8);
+    payload[3] = (uint8_t)arq->peerSession;
+    payload[4] = answerWanted ? 1U : 0U;
+
+    (void)LinkSend(arq->port, (uint8_t)LINK_FRAME_ARQ_SYNC, 0U, 0U, payload, ARQ_SYNC_LENGTH);
+    arq->syncSentAt = ArqNow();
+}
+
+/*
+ * Description :
+ * This function handles a LINK_FRAME_ARQ_SYNC frame: a new session number
+ * of the other board starts this one over, and the session is agreed on
+ * once the other board repeats our number.
+ * Parameters: arq   -> The reliable delivery state of the port.
+ *             frame -> The received LINK_FRAME_ARQ_SYNC frame.
+ * Returns: None.
+ */
+static void ArqHandleSync(arqPort_t *arq, const linkFrame_t *frame)
+{
+    uint16_t session = 0U;
+    uint16_t echo = 0U;
+
+    if (frame->length >= ARQ_SYNC_LENGTH)
+    {
+        session = (uint16_t)(((uint16_t)frame->payload[0] << 8) | frame->payload[1]);
+        echo = (uint16_t)(((uint16_t)frame->payload[2] << 8) | frame->payload[3]);
+    }
+
+    else
+    {
+
+    }
+
+    if (session != 0U)
+    {
+        /* The first session heard needs no restart, nothing was exchanged yet */
+        if ((arq->peerSession != 0U) && (session != arq->peerSession))
+        {
+            ArqSessionReset(arq);
+        }
+
+        else
+        {
+
+        }
+
+        arq->peerSession = session;
+        arq->synced = (arq->session != 0U) && (echo == arq->session);
+
+        if (frame->payload[4] != 0U)
+        {
+            ArqSendSync(arq, !arq->synced);
+        }
+
+        else
+        {
+
+        }
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function starts a new session when a frame received in order
+ * could not be decoded: the histories of both boards differ, so sending
+ * the frame again would not help. The new session number makes the other
+ * board start over as well.
+ * Parameters: arq -> The reliable delivery state of the port.
+ * Returns: None.
+ */
+static void ArqRestart(arqPort_t *arq)
+{
+    arq->session = ArqNewSession(arq->session);
+    arq->synced = false;
+    ArqSessionReset(arq);
+    ArqSendSync(arq, true);
+}
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function empties the send windows, resets the sequence numbers,
+ * the sessions, the round trip estimates and the counters of every port.
+ * Parameters: None.
+ * Returns: None.
+ */
+void ArqInit(void)
+{
+    uint8_t port;
+
+    for (port = 0U; port < LINK_PORT_COUNT; port++)
+    {
+        arqPort_t *arq = &arqPorts[port];
+
+        arq->port = port;
+        arq->txBase = 0U;
+        arq->txNext = 0U;
+        arq->txSent = 0U;
+        arq->txEnd = 0U;
+        arq->rxExpected = 0U;
+        arq->ackPending = false;
+        arq->held = false;
+        arq->paused = false;
+
+        arq->session = 0U;
+        arq->peerSession = 0U;
+        arq->synced = false;
+        arq->syncSentAt = 0U;
+
+        arq->rttValid = false;
+        arq->srttScaled = 0U;
+        arq->rttvarScaled = 0U;
+        arq->rto = ARQ_INITIAL_RTO_MS;
+
+#if (ARQ_COMPRESSION == 1U)
+        LzEncoderInit(&arq->txEncoder);
+        LzDecoderInit(&arq->rxDecoder);
+        arq->peerDecompresses = false;
+#endif
+
+        arq->startTime = ArqNow();
+        (void)memset(&arq->stats, 0, sizeof(arq->stats));
+    }
+}
+
+/*
+ * Description :
+ * This function stores a payload in the send window of a port and sends
+ * it as soon as its UART has room, it is sent again until acknowledged.
+ * Parameters: port    -> The link port (LINK_PORT_xxx).
+ *             type    -> The frame type (linkFrameType_t), below LINK_FRAME_CONTROL
+ *                        and not LINK_FRAME_ACK.
+ *             payload -> The payload bytes, may be NULL when length is 0.
+ *             length  -> The number of payload bytes, up to ARQ_MAX_PAYLOAD.
+ * Returns: true if the payload was accepted, false if the window is full.
+ */
+bool ArqSend(uint8_t port, uint8_t type, const uint8_t *payload, uint8_t length)
+{
+    bool accepted = false;
+
+    if ((port >= LINK_PORT_COUNT) || (type == (uint8_t)LINK_FRAME_ACK) || (type >= (uint8_t)LINK_FRAME_CONTROL) ||
+        (length > ARQ_MAX_PAYLOAD) || ((NULL == payload) && (length != 0U)))
+    {
+        /* Nothing to send */
+    }
+
+    else if (ArqWindowFree(port) == 0U)
+    {
+        /* Wait for an acknowledgement to free a slot */
+    }
+
+    else
+    {
+        arqPort_t *arq = &arqPorts[port];
+        arqSlot_t *slot = &arq->txWindow[arq->txEnd & ARQ_WINDOW_MASK];
+
+        slot->type = type;
+        slot->length = length;
+        slot->rawLength = length;
+        slot->retransmitted = false;
+
+#if (ARQ_COMPRESSION == 1U)
+        /* Every frame joins the history, the compressed copy is kept only
+         * when it is shorter */
+        if (arq->peerDecompresses && (length > 1U))
+        {
+            uint16_t compressed = LzCompress(&arq->txEncoder, payload, (uint16_t)length,
+                                             slot->payload, (uint16_t)(length - 1U));
+
+            if (compressed != 0U)
+            {
+                slot->type = (uint8_t)(type | (uint8_t)LINK_FRAME_COMPRESSED);
+                slot->length = (uint8_t)compressed;
+                arq->stats.compressedFrames++;
+                arq->stats.savedBytes += (uint32_t)length - compressed;
+            }
+
+            else
+            {
+
+            }
+        }
+
+        else if (length != 0U)
+        {
+            LzEncoderAppend(&arq->txEncoder, payload, (uint16_t)length);
+        }
+
+        else
+        {
+
+        }
+#endif
+
+        if ((slot->type == type) && (length != 0U))
+        {
+            (void)memcpy(slot->payload, payload, (size_t)length);
+        }
+
+        else
+        {
+
+        }
+
+        arq->txEnd++;
+        ArqTransmit(arq);
+        accepted = true;
+    }
+
+    return accepted;
+}
+
+/*
+ * Description :
+ * This function returns the number of payloads ArqSend() can accept on a port.
+ * Parameters: port -> The link port (LINK_PORT_xxx).
+ * Returns: The number of free slots in the send window.
+ */
+uint8_t ArqWindowFree(uint8_t port)
+{
+    uint8_t free = 0U;
+
+    if (port < LINK_PORT_COUNT)
+    {
+        free = (uint8_t)(ARQ_WINDOW_SIZE - (uint8_t)(arqPorts[port].txEnd - arqPorts[port].txBase));
+    }
+
+    else
+    {
+
+    }
+
+    return free;
+}
+
+/*
+ * Description :
+ * This function processes the received frames of a port and their
+ * acknowledgements, retransmits on timeout and sends the pending ACK
+ * when no data frame carried it, once the session is agreed on. It must
+ * be called often from the main loop.
+ * Parameters: port -> The link port (LINK_PORT_xxx).
+ * Returns: A pointer to the next data frame received in order, valid
+ *          until the next call for the same port, or NULL if there is none yet.
+ */
+const linkFrame_t* ArqPoll(uint8_t port)
+{
+    const linkFrame_t *delivered = NULL;
+    const linkFrame_t *frame = NULL;
+    arqPort_t *arq;
+
+    if (port >= LINK_PORT_COUNT)
+    {
+        return NULL;
+    }
+
+    else
+    {
+
+    }
+
+    arq = &arqPorts[port];
+
+    /* The ACK of the frame delivered by the previous call was left pending
+     * so that a reply could carry it, send it on its own now */
+    if (arq->ackPending && !arq->paused && ArqSendAck(arq))
+    {
+        arq->stats.acksSent++;
+        arq->ackPending = false;
+    }
+
+    else
+    {
+
+    }
+
+    /* Stop at the first delivered frame, the link reuses its frame buffer */
+    do
+    {
+        frame = LinkPoll(port);
+
+        if ((NULL != frame) && (frame->type == (uint8_t)LINK_FRAME_ARQ_SYNC))
+        {
+            ArqHandleSync(arq, frame);
+        }
+
+        else if ((NULL != frame) && (frame->type >= (uint8_t)LINK_FRAME_CONTROL))
+        {
+            /* Control frames carry no valid acknowledgement */
+            if (NULL != arq->controlHandler)
+            {
+                arq->controlHandler(frame);
+            }
+
+            else
+            {
+
+            }
+        }
+
+        else if ((NULL != frame) && !arq->synced)
+        {
+            /* A frame of an earlier session, or sent before ours was agreed on */
+        }
+
+        else if (NULL != frame)
+        {
+            ArqAckReceived(arq, frame->ack);
+
+            if (frame->type == (uint8_t)LINK_FRAME_ACK)
+            {
+                /* Nothing to deliver */
+                ArqPeerCapability(arq, frame);
+            }
+
+            else if ((frame->seq == arq->rxExpected) && arq->held)
+            {
+                /* Neither decoded nor acknowledged, sent again after the timeout */
+                arq->stats.framesRefused++;
+            }
+
+            else if (frame->seq == arq->rxExpected)
+            {
+                /* Only a frame delivered is acknowledged */
+                delivered = ArqDecode(arq, frame);
+
+                if (NULL != delivered)
+                {
+                    arq->rxExpected++;
+                    arq->ackPending = true;
+                    arq->stats.rxGoodputBytes += (uint32_t)delivered->length;
+                }
+
+                else
+                {
+                    ArqRestart(arq);
+                }
+            }
+
+            else
+            {
+                /* Go-back-N drops anything out of order and repeats the ACK */
+                arq->stats.duplicates++;
+                arq->ackPending = true;
+            }
+        }
+
+        else
+        {
+
+        }
+    } while ((NULL != frame) && (NULL == delivered));
+
+    /* Ask again until the other board repeats our session number */
+    if (!arq->synced && !arq->paused && ((arq->session == 0U) || ((ArqNow() - arq->syncSentAt) >= ARQ_SYNC_INTERVAL_MS)))
+    {
+        ArqSendSync(arq, true);
+    }
+
+    else
+    {
+
+    }
+
+    ArqCheckTimeout(arq);
+    ArqTransmit(arq);
+
+    if (arq->ackPending && !arq->paused && (NULL == delivered) && ArqSendAck(arq))
+    {
+        arq->stats.acksSent++;
+        arq->ackPending = false;
+    }
+
+    else
+    {
+
+    }
+
+    return delivered;
+}
+
+/*
+ * Description :
+ * This function sets the function called by ArqPoll() for every
+ * control frame received on a port.
+ * Parameters: port    -> The link port (LINK_PORT_xxx).
+ *             handler -> The control frame handler, NULL to drop them.
+ * Returns: None.
+ */
+void ArqSetControlHandler(uint8_t port, arqControlHandler_t handler)
+{
+    if (port < LINK_PORT_COUNT)
+    {
+        arqPorts[port].controlHandler = handler;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function holds the data frames of a port: ArqPoll() still takes
+ * the acknowledgements and the control frames, but leaves the data
+ * frames with the other board, which sends them again after its
+ * retransmission timeout.
+ * Parameters: port -> The link port (LINK_PORT_xxx).
+ *             hold -> true to leave the data frames, false to deliver them.
+ * Returns: None.
+ */
+void ArqSetHold(uint8_t port, bool hold)
+{
+    if (port < LINK_PORT_COUNT)
+    {
+        arqPorts[port].held = hold;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function pauses the sending on a port while its UART changes rate:
+ * no data frame, ACK or LINK_FRAME_ARQ_SYNC is sent and no retransmission
+ * timeout runs. The frames waiting for an acknowledgement are timed again
+ * from the end of the pause.
+ * Parameters: port  -> The link port (LINK_PORT_xxx).
+ *             pause -> true to pause, false to send again.
+ * Returns: None.
+ */
+void ArqSetPause(uint8_t port, bool pause)
+{
+    if (port < LINK_PORT_COUNT)
+    {
+        arqPort_t *arq = &arqPorts[port];
+
+        if (arq->paused && !pause)
+        {
+            uint32_t now = ArqNow();
+            uint8_t seq;
+
+            for (seq = arq->txBase; seq != arq->txNext; seq++)
+            {
+                arq->txWindow[seq & ARQ_WINDOW_MASK].sentAt = now;
+            }
+        }
+
+        else
+        {
+
+        }
+
+        arq->paused = pause;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function copies the reliable delivery counters of a port.
+ * Parameters: port  -> The link port (LINK_PORT_xxx).
+ *             stats -> A pointer to the structure where the counters will be stored.
+ * Returns: None.
+ */
+void ArqGetStats(uint8_t port, arqStats_t *stats)
+{
+    if ((port < LINK_PORT_COUNT) && (NULL != stats))
+    {
+        const arqPort_t *arq = &arqPorts[port];
+
+        *stats = arq->stats;
+        stats->elapsedMs = ArqNow() - arq->startTime;
+        stats->srttMs = arq->srttScaled >> 3;
+        stats->rtoMs = arq->rto;
+        stats->synced = arq->synced;
+#if (ARQ_COMPRESSION == 1U)
+        stats->compressing = arq->peerDecompresses;
+#endif
+    }
+
+    else
+    {
+
+    }
+}
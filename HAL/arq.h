@@ -0,0 +1,220 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   arq.h                                                        *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file for the go-back-N reliable delivery layer        *
+ *                running on top of the framed link                            *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef ARQ_H_
+#define ARQ_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "HAL/link.h"
+#include "HAL/switch.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* Every link port runs its own send window, sequence numbers and round
+ * trip estimate, towards the board at the other end of its wire. */
+
+/* Sessions:
+ * The sequence numbers and the compression histories only make sense while
+ * neither board restarts. Each port picks a 16-bit session number the first
+ * time it is polled, and both boards exchange LINK_FRAME_ARQ_SYNC control
+ * frames (session, session of the other board as last heard, answer
+ * wanted) every ARQ_SYNC_INTERVAL_MS until each one has heard the other
+ * repeat its number. No data frame or ACK is sent or taken before that.
+ * A board hearing a new session number from the other one, which
+ * restarted, starts over: sequence numbers from 0, empty histories, and
+ * the frames of the send window dropped. A board that cannot decode a
+ * frame picks a new session number, so both boards start over. */
+#define ARQ_SYNC_INTERVAL_MS 250U
+
+/* Frames sent and not yet acknowledged, must be a power of two not greater
+ * than 128 so that the 8-bit sequence numbers never alias within a window */
+#define ARQ_WINDOW_SIZE 4U
+
+/* Largest payload accepted by ArqSend(), every window slot keeps a copy
+ * of its payload until it is acknowledged */
+#define ARQ_MAX_PAYLOAD 200U
+
+/* Retransmission timeout used until the first round trip is measured */
+#define ARQ_INITIAL_RTO_MS 1000U
+
+/* Bounds of the adaptive retransmission timeout */
+#define ARQ_MIN_RTO_MS (2U * SYSTICK_PERIOD_MS)
+#define ARQ_MAX_RTO_MS 8000U
+
+/* Link compression:
+ * ARQ_COMPRESSION compresses the data frames with the streaming LZ77
+ * compressor (lz.h) when 1U, the history going on from one frame to the
+ * next. Every ACK frame then carries LZ_WINDOW_BITS to tell the other
+ * board that this one decompresses, and a board only compresses once the
+ * ACKs of the other one say so: boards built with different settings keep
+ * talking uncompressed. A frame that does not shrink is sent as it is,
+ * LINK_FRAME_COMPRESSED marks the others.
+ * The host simulation build may set it from the command line. */
+#ifndef ARQ_COMPRESSION
+#define ARQ_COMPRESSION 1U
+#endif
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Pointer to the function receiving the control frames
+ *              (types from LINK_FRAME_CONTROL up), which bypass the
+ *              sequence numbers and acknowledgements.
+ */
+typedef void (*arqControlHandler_t)(const linkFrame_t *frame);
+
+/*
+ * Description: Structure holding the reliable delivery counters.
+ *              - framesSent       : Data frames sent for the first time.
+ *              - retransmits      : Data frames sent again after a timeout.
+ *              - timeouts         : Retransmission timeouts that expired.
+ *              - duplicates       : Data frames dropped as duplicate or out of order.
+ *              - acksSent         : ACK frames sent because no data could carry the ACK.
+ *              - txGoodputBytes   : Payload bytes acknowledged by the other board.
+ *              - rxGoodputBytes   : Payload bytes delivered in order to the application.
+ *              - elapsedMs        : Time since ArqInit(), to turn the bytes into rates.
+ *              - srttMs           : The smoothed round trip time.
+ *              - rtoMs            : The current retransmission timeout.
+ *              - compressing      : The other board decompresses, data frames are compressed.
+ *              - compressedFrames : Data frames sent compressed.
+ *              - savedBytes       : Payload bytes the compression saved.
+ *              - decodeErrors     : Compressed frames that could not be decoded, the
+ *                                   histories of the boards differ. They are dropped
+ *                                   without an ACK and a new session is started.
+ *              - synced           : Both boards agree on the session, frames flow.
+ *              - sessionResets    : Sessions started over after the start of the first one.
+ *              - framesDropped    : Frames of the send window dropped by those restarts.
+ *              - framesRefused    : Data frames left with the other board while the
+ *                                   port was held (ArqSetHold()).
+ *              Payload bytes are counted before compression.
+ */
+typedef struct
+{
+    uint32_t framesSent;
+    uint32_t retransmits;
+    uint32_t timeouts;
+    uint32_t duplicates;
+    uint32_t acksSent;
+    uint32_t txGoodputBytes;
+    uint32_t rxGoodputBytes;
+    uint32_t elapsedMs;
+    uint32_t srttMs;
+    uint32_t rtoMs;
+    bool compressing;
+    uint32_t compressedFrames;
+    uint32_t savedBytes;
+    uint32_t decodeErrors;
+    bool synced;
+    uint32_t sessionResets;
+    uint32_t framesDropped;
+    uint32_t framesRefused;
+} arqStats_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function empties the send windows, resets the sequence numbers,
+ * the sessions, the round trip estimates and the counters of every port.
+ * Parameters: None.
+ * Returns: None.
+ */
+void ArqInit(void);
+
+/*
+ * Description :
+ * This function stores a payload in the send window of a port and sends
+ * it as soon as its UART has room, it is sent again until acknowledged.
+ * Parameters: port    -> The link port (LINK_PORT_xxx).
+ *             type    -> The frame type (linkFrameType_t), below LINK_FRAME_CONTROL
+ *                        and not LINK_FRAME_ACK.
+ *             payload -> The payload bytes, may be NULL when length is 0.
+ *             length  -> The number of payload bytes, up to ARQ_MAX_PAYLOAD.
+ * Returns: true if the payload was accepted, false if the window is full.
+ */
+bool ArqSend(uint8_t port, uint8_t type, const uint8_t *payload, uint8_t length);
+
+/*
+ * Description :
+ * This function returns the number of payloads ArqSend() can accept on a port.
+ * Parameters: port -> The link port (LINK_PORT_xxx).
+ * Returns: The number of free slots in the send window.
+ */
+uint8_t ArqWindowFree(uint8_t port);
+
+/*
+ * Description :
+ * This function processes the received frames of a port and their
+ * acknowledgements, retransmits on timeout and sends the pending ACK
+ * when no data frame carried it, once the session is agreed on. It must
+ * be called often from the main loop.
+ * Parameters: port -> The link port (LINK_PORT_xxx).
+ * Returns: A pointer to the next data frame received in order, valid
+ *          until the next call for the same port, or NULL if there is none yet.
+ */
+const linkFrame_t* ArqPoll(uint8_t port);
+
+/*
+ * Description :
+ * This function sets the function called by ArqPoll() for every
+ * control frame received on a port.
+ * Parameters: port    -> The link port (LINK_PORT_xxx).
+ *             handler -> The control frame handler, NULL to drop them.
+ * Returns: None.
+ */
+void ArqSetControlHandler(uint8_t port, arqControlHandler_t handler);
+
+/*
+ * Description :
+ * This function holds the data frames of a port: ArqPoll() still takes
+ * the acknowledgements and the control frames, but leaves the data
+ * frames with the other board, which sends them again after its
+ * retransmission timeout.
+ * Parameters: port -> The link port (LINK_PORT_xxx).
+ *             hold -> true to leave the data frames, false to deliver them.
+ * Returns: None.
+ */
+void ArqSetHold(uint8_t port, bool hold);
+
+/*
+ * Description :
+ * This function pauses the sending on a port while its UART changes rate:
+ * no data frame, ACK or LINK_FRAME_ARQ_SYNC is sent and no retransmission
+ * timeout runs. The frames waiting for an acknowledgement are timed again
+ * from the end of the pause.
+ * Parameters: port  -> The link port (LINK_PORT_xxx).
+ *             pause -> true to pause, false to send again.
+ * Returns: None.
+ */
+void ArqSetPause(uint8_t port, bool pause);
+
+/*
+ * Description :
+ * This function copies the reliable delivery counters of a port.
+ * Parameters: port  -> The link port (LINK_PORT_xxx).
+ *             stats -> A pointer to the structure where the counters will be stored.
+ * Returns: None.
+ */
+void ArqGetStats(uint8_t port, arqStats_t *stats);
+
+#endif /* ARQ_H_ */
@@ -0,0 +1,741 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   baud.c                                                       *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the UART1 baud rate negotiation and the      *
+ *                link error monitor                                           *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include "HAL/baud.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define BAUD_LADDER_SIZE ((uint8_t)(sizeof(baudLadder) / sizeof(baudLadder[0])))
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Enumeration representing the negotiation states.
+ *              - BAUD_IDLE       : Running at the agreed rate, the monitor is active.
+ *              - BAUD_PROPOSING  : Proposed a rate, waiting for BAUD_ACCEPT.
+ *              - BAUD_PROBING    : Switched, sending the test patterns and
+ *                                  waiting for BAUD_RESULT.
+ *              - BAUD_TESTING    : Accepted a rate, receiving the test patterns.
+ *              - BAUD_CONFIRMING : Reported a clean test, waiting for BAUD_CONFIRM.
+ */
+typedef enum
+{
+    BAUD_IDLE = 0U,
+    BAUD_PROPOSING,
+    BAUD_PROBING,
+    BAUD_TESTING,
+    BAUD_CONFIRMING
+} baudState_t;
+
+/*******************************************************************************
+ *                            Global Variables                                 *
+ *******************************************************************************/
+/* Rates tried in turn, the first one is UART1_BAUD_RATE, the safe rate.
+ * Both boards must be built with the same ladder */
+static const uint32_t baudLadder[] = {
+    UART1_BAUD_RATE, 230400U, 460800U, 921600U, 1000000U, 2000000U, 2500000U, 4000000U, 5000000U
+};
+
+static baudState_t baudState = BAUD_IDLE;
+
+/* The agreed rate and the rate being tried, as ladder indexes */
+static uint8_t goodIndex = 0U;
+static uint8_t trialIndex = 0U;
+
+static uint32_t deadline = 0U;
+static uint32_t nextAttempt = 0U;
+static uint16_t nonce = 0U;
+static uint8_t probesSent = 0U;
+static uint8_t probesGood = 0U;
+static uint32_t errorBaseline = 0U;
+static uint32_t guardEnd = 0U;
+static bool guarding = false;
+static uint8_t retries = 0U;
+
+static uint32_t monitorTime = 0U;
+static uint32_t monitorErrors = 0U;
+static uint32_t monitorBytes = 0U;
+
+static baudStats_t baudStats;
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static uint32_t BaudNow(void);
+static bool BaudExpired(uint32_t time);
+static void BaudPut32(uint8_t *buffer, uint32_t value);
+static uint32_t BaudGet32(const uint8_t *buffer);
+static bool BaudUsable(uint8_t index);
+static uint8_t BaudIndexOf(uint32_t rate);
+static uint32_t BaudLineErrors(void);
+static void BaudSwitch(uint8_t index);
+static void BaudCheckGuard(void);
+static void BaudSendRate(uint8_t type, uint8_t index);
+static void BaudGiveUp(void);
+static void BaudFinishTest(void);
+static void BaudSendProbes(void);
+static void BaudMonitor(void);
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function returns the current time.
+ * Parameters: None.
+ * Returns: The time since reset in ms, with the SysTick resolution.
+ */
+static uint32_t BaudNow(void)
+{
+    return SysticGetTicks() * SYSTICK_PERIOD_MS;
+}
+
+/*
+ * Description :
+ * This function tells whether a point in time has been reached.
+ * Parameters: time -> The point in time in ms.
+ * Returns: true if the current time is at or after it.
+ */
+static bool BaudExpired(uint32_t time)
+{
+    return ((int32_t)(BaudNow() - time) >= 0);
+}
+
+/*
+ * Description :
+ * This function stores a 32-bit value in a payload, most significant byte first.
+ * Parameters: buffer -> The first of the 4 payload bytes.
+ *             value  -> The value to be stored.
+ * Returns: None.
+ */
+static void BaudPut32(uint8_t *buffer, uint32_t value)
+{
+    buffer[0] = (uint8_t)(value >> 24);
+    buffer[1] = (uint8_t)(value >> 16);
+    buffer[2] = (uint8_t)(value >> 8);
+    buffer[3] = (uint8_t)value;
+}
+
+/*
+ * Description :
+ * This function reads a 32-bit value from a payload, most significant byte first.
+ * Parameters: buffer -> The first of the 4 payload bytes.
+ * Returns: The value.
+ */
+static uint32_t BaudGet32(const uint8_t *buffer)
+{
+    return ((uint32_t)buffer[0] << 24) | ((uint32_t)buffer[1] << 16) | ((uint32_t)buffer[2] << 8) | (uint32_t)buffer[3];
+}
+
+/*
+ * Description :
+ * This function tells whether a rate of the ladder may be used, the
+ * system clock must produce it accurately enough.
+ * Parameters: index -> The ladder index of the rate.
+ * Returns: true if the rate may be used.
+ */
+static bool BaudUsable(uint8_t index)
+{
+    bool usable = false;
+    uartBaudInfo_t info;
+
+    if ((index < BAUD_LADDER_SIZE) && (baudLadder[index] <= BAUD_MAX_RATE) && UARTGetBaudInfo(baudLadder[index], &info))
+    {
+        usable = (info.errorPercentX100 <= BAUD_MAX_ERROR_X100) && (info.errorPercentX100 >= -BAUD_MAX_ERROR_X100);
+    }
+
+    else
+    {
+
+    }
+
+    return usable;
+}
+
+/*
+ * Description :
+ * This function finds a rate in the ladder.
+ * Parameters: rate -> The baud rate.
+ * Returns: The ladder index, BAUD_LADDER_SIZE if the rate is not in the ladder.
+ */
+static uint8_t BaudIndexOf(uint32_t rate)
+{
+    uint8_t index = 0U;
+
+    while ((index < BAUD_LADDER_SIZE) && (baudLadder[index] != rate))
+    {
+        index++;
+    }
+
+    return index;
+}
+
+/*
+ * Description :
+ * This function adds up every receive error seen on the link so far.
+ * Parameters: None.
+ * Returns: The line errors, overruns and CRC errors of UART1. The bytes
+ *          dropped with the receive buffer full are not line errors.
+ */
+static uint32_t BaudLineErrors(void)
+{
+    uartStats_t uartStats;
+    linkStats_t linkStats;
+
+    UARTGetStats((uint32_t)UART1_MODULE, &uartStats);
+    LinkGetStats(LINK_PORT_UART1, &linkStats);
+
+    return uartStats.rxFraming + uartStats.rxParity + uartStats.rxBreak + uartStats.rxOverrun +
+           linkStats.crcErrors;
+}
+
+/*
+ * Description :
+ * This function moves UART1 to a rate of the ladder once every queued
+ * byte has left at the current rate.
+ * Parameters: index -> The ladder index of the new rate.
+ * Returns: None.
+ */
+static void BaudSwitch(uint8_t index)
+{
+    uartStats_t uartStats;
+
+    (void)UARTFlush((uint32_t)UART1_MODULE);
+    (void)UARTSetBaudRate((uint32_t)UART1_MODULE, baudLadder[index]);
+
+    /* The errors seen at the old rate must not count against the new one */
+    UARTGetStats((uint32_t)UART1_MODULE, &uartStats);
+    monitorTime = BaudNow();
+    monitorErrors = BaudLineErrors();
+    monitorBytes = uartStats.rxBytes;
+
+    errorBaseline = monitorErrors;
+    guarding = true;
+    guardEnd = BaudNow() + BAUD_GUARD_MS;
+}
+
+/*
+ * Description :
+ * This function takes the line errors counted against the tried rate
+ * once BAUD_GUARD_MS passed since the switch.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void BaudCheckGuard(void)
+{
+    if (guarding && BaudExpired(guardEnd))
+    {
+        errorBaseline = BaudLineErrors();
+        guarding = false;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function sends a control frame carrying a rate of the ladder.
+ * Parameters: type  -> The control frame type.
+ *             index -> The ladder index of the rate.
+ * Returns: None.
+ */
+static void BaudSendRate(uint8_t type, uint8_t index)
+{
+    uint8_t payload[4];
+
+    BaudPut32(payload, baudLadder[index]);
+    (void)LinkSend(LINK_PORT_UART1, type, 0U, 0U, payload, 4U);
+}
+
+/*
+ * Description :
+ * This function drops the rate being tried, goes back to the agreed
+ * rate and waits before climbing again, shortly while the link never
+ * left the safe rate.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void BaudGiveUp(void)
+{
+    BaudSwitch(goodIndex);
+    baudStats.probesFailed++;
+    baudState = BAUD_IDLE;
+
+    if ((goodIndex == 0U) && (retries < BAUD_RETRY_COUNT))
+    {
+        retries++;
+        nextAttempt = BaudNow() + BAUD_RETRY_MS;
+    }
+
+    else
+    {
+        nextAttempt = BaudNow() + BAUD_REPROBE_MS;
+    }
+}
+
+/*
+ * Description :
+ * This function ends the test of a rate on the receiving board and
+ * reports how many test patterns arrived intact.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void BaudFinishTest(void)
+{
+    uint8_t payload[6];
+    bool clean = (probesGood == BAUD_PROBE_COUNT) && (BaudLineErrors() == errorBaseline);
+
+    BaudPut32(payload, baudLadder[trialIndex]);
+    payload[4] = probesGood;
+    payload[5] = clean ? 1U : 0U;
+    (void)LinkSend(LINK_PORT_UART1, (uint8_t)LINK_FRAME_BAUD_RESULT, 0U, 0U, payload, 6U);
+
+    if (clean)
+    {
+        baudState = BAUD_CONFIRMING;
+        deadline = BaudNow() + BAUD_REPLY_TIMEOUT_MS;
+    }
+
+    else
+    {
+        BaudGiveUp();
+    }
+}
+
+/*
+ * Description :
+ * This function sends the test patterns UART1 has room for. Pattern i
+ * carries i followed by the bytes i * 64 + 1 ... i * 64 + 63, so the
+ * patterns cover every byte value, FLAG and ESCAPE included.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void BaudSendProbes(void)
+{
+    uint8_t payload[BAUD_PROBE_LENGTH];
+    bool room = true;
+
+    while (room && (probesSent < BAUD_PROBE_COUNT))
+    {
+        uint8_t i;
+
+        payload[0] = probesSent;
+        for (i = 1U; i < BAUD_PROBE_LENGTH; i++)
+        {
+            payload[i] = (uint8_t)((probesSent * BAUD_PROBE_LENGTH) + i);
+        }
+
+        room = LinkSend(LINK_PORT_UART1, (uint8_t)LINK_FRAME_BAUD_PROBE, 0U, 0U, payload, (uint8_t)BAUD_PROBE_LENGTH);
+
+        if (room)
+        {
+            probesSent++;
+        }
+
+        else
+        {
+
+        }
+    }
+}
+
+/*
+ * Description :
+ * This function compares the receive errors with the received bytes
+ * every BAUD_MONITOR_PERIOD_MS and steps one rate down when the error
+ * rate is too high, telling the other board to follow.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void BaudMonitor(void)
+{
+    if (BaudExpired(monitorTime + BAUD_MONITOR_PERIOD_MS))
+    {
+        uartStats_t uartStats;
+        uint32_t errors = BaudLineErrors();
+        uint32_t newErrors = errors - monitorErrors;
+        uint32_t newBytes;
+
+        UARTGetStats((uint32_t)UART1_MODULE, &uartStats);
+        newBytes = uartStats.rxBytes - monitorBytes;
+
+        monitorTime = BaudNow();
+        monitorErrors = errors;
+        monitorBytes = uartStats.rxBytes;
+
+        if ((goodIndex != 0U) && (newErrors >= BAUD_MIN_ERRORS) &&
+            ((newErrors * 1000U) > (newBytes * BAUD_MAX_ERRORS_PER_1000)))
+        {
+            uint8_t lower = (uint8_t)(goodIndex - 1U);
+
+            while ((lower != 0U) && !BaudUsable(lower))
+            {
+                lower--;
+            }
+
+            /* Ask at the current rate, the other board may not hear it,
+             * in which case its own monitor steps down as well */
+            BaudSendRate((uint8_t)LINK_FRAME_BAUD_STEP_DOWN, lower);
+            BaudSwitch(lower);
+            goodIndex = lower;
+            baudStats.stepDowns++;
+            nextAttempt = BaudNow() + BAUD_REPROBE_MS;
+        }
+
+        else
+        {
+
+        }
+    }
+
+    else
+    {
+
+    }
+}
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function resets the negotiation to the safe rate and takes the
+ * control frames of the reliable delivery layer.
+ * Parameters: None.
+ * Returns: None.
+ */
+void BaudInit(void)
+{
+    (void)memset(&baudStats, 0, sizeof(baudStats));
+    baudState = BAUD_IDLE;
+    goodIndex = 0U;
+    trialIndex = 0U;
+    retries = 0U;
+    nextAttempt = BaudNow();
+    BaudSwitch(0U);
+
+    ArqSetControlHandler(LINK_PORT_UART1, &BaudHandleFrame);
+}
+
+/*
+ * Description :
+ * This function runs the negotiation and the error monitor. It is run
+ * once on every tick in every state (MainTick()), so the deadlines of a
+ * negotiation expire even in the Off state. No rate is proposed while
+ * UART1 is disabled.
+ * Parameters: None.
+ * Returns: None.
+ */
+void BaudPoll(void)
+{
+    switch (baudState)
+    {
+    case BAUD_IDLE :
+        BaudMonitor();
+
+        /* No rate is proposed while UART1 is disabled (Off state) */
+        if ((baudState == BAUD_IDLE) && BaudExpired(nextAttempt) && UARTIsEnabled((uint32_t)UART1_MODULE))
+        {
+            /* Propose the next usable rate of the ladder */
+            trialIndex = (uint8_t)(goodIndex + 1U);
+            while ((trialIndex < BAUD_LADDER_SIZE) && !BaudUsable(trialIndex))
+            {
+                trialIndex++;
+            }
+
+            if (trialIndex < BAUD_LADDER_SIZE)
+            {
+                uint8_t payload[6];
+
+                /* The nonce settles which board leads when both propose at once */
+                nonce = (uint16_t)(SysTickValueGet() ^ (SysticGetTicks() << 4));
+                BaudPut32(payload, baudLadder[trialIndex]);
+                payload[4] = (uint8_t)(nonce >> 8);
+                payload[5] = (uint8_t)nonce;
+
+                if (LinkSend(LINK_PORT_UART1, (uint8_t)LINK_FRAME_BAUD_PROPOSE, 0U, 0U, payload, 6U))
+                {
+                    baudState = BAUD_PROPOSING;
+                    deadline = BaudNow() + BAUD_REPLY_TIMEOUT_MS;
+                }
+
+                else
+                {
+
+                }
+            }
+
+            else
+            {
+                /* Already at the fastest rate */
+                nextAttempt = BaudNow() + BAUD_REPROBE_MS;
+            }
+        }
+
+        else
+        {
+
+        }
+        break;
+    case BAUD_PROPOSING :
+        if (BaudExpired(deadline))
+        {
+            /* The other board is off or not listening, try again later */
+            baudStats.noAnswer++;
+            baudState = BAUD_IDLE;
+            nextAttempt = BaudNow() + BAUD_RETRY_MS;
+        }
+
+        else
+        {
+
+        }
+        break;
+    case BAUD_PROBING :
+        BaudCheckGuard();
+
+        if (!guarding)
+        {
+            BaudSendProbes();
+        }
+
+        else
+        {
+
+        }
+
+        if (BaudExpired(deadline))
+        {
+            BaudGiveUp();
+        }
+
+        else
+        {
+
+        }
+        break;
+    case BAUD_TESTING :
+        BaudCheckGuard();
+
+        if (BaudExpired(deadline))
+        {
+            BaudFinishTest();
+        }
+
+        else
+        {
+
+        }
+        break;
+    case BAUD_CONFIRMING :
+        if (BaudExpired(deadline))
+        {
+            BaudGiveUp();
+        }
+
+        else
+        {
+
+        }
+        break;
+    default :
+        baudState = BAUD_IDLE;
+        break;
+    }
+
+    /* The reliable delivery traffic waits for the end of a negotiation */
+    ArqSetPause(LINK_PORT_UART1, (baudState != BAUD_IDLE));
+}
+
+/*
+ * Description :
+ * This function handles a negotiation frame from the other board.
+ * Parameters: frame -> The received control frame.
+ * Returns: None.
+ */
+void BaudHandleFrame(const linkFrame_t *frame)
+{
+    uint8_t index = BAUD_LADDER_SIZE;
+
+    if ((NULL != frame) && (frame->length >= 4U))
+    {
+        index = BaudIndexOf(BaudGet32(frame->payload));
+    }
+
+    else
+    {
+
+    }
+
+    if (NULL == frame)
+    {
+        /* Nothing to handle */
+    }
+
+    else if (frame->type == (uint8_t)LINK_FRAME_BAUD_PROBE)
+    {
+        /* Count the test patterns that arrived intact */
+        if ((baudState == BAUD_TESTING) && (frame->length == BAUD_PROBE_LENGTH))
+        {
+            uint8_t i = 1U;
+
+            while ((i < BAUD_PROBE_LENGTH) && (frame->payload[i] == (uint8_t)((frame->payload[0] * BAUD_PROBE_LENGTH) + i)))
+            {
+                i++;
+            }
+
+            if (i == BAUD_PROBE_LENGTH)
+            {
+                probesGood++;
+            }
+
+            else
+            {
+
+            }
+
+            if (frame->payload[0] == (uint8_t)(BAUD_PROBE_COUNT - 1U))
+            {
+                BaudFinishTest();
+            }
+
+            else
+            {
+
+            }
+        }
+
+        else
+        {
+
+        }
+    }
+
+    else if (!BaudUsable(index))
+    {
+        /* Not a rate of our ladder, let the other board time out */
+    }
+
+    else if (frame->type == (uint8_t)LINK_FRAME_BAUD_PROPOSE)
+    {
+        uint16_t peerNonce = (frame->length >= 6U) ? (uint16_t)(((uint16_t)frame->payload[4] << 8) | frame->payload[5]) : 0U;
+
+        /* When both boards propose at once the lower nonce follows */
+        if ((baudState == BAUD_IDLE) || ((baudState == BAUD_PROPOSING) && (nonce < peerNonce)))
+        {
+            trialIndex = index;
+            BaudSendRate((uint8_t)LINK_FRAME_BAUD_ACCEPT, index);
+            BaudSwitch(index);
+            probesGood = 0U;
+            baudState = BAUD_TESTING;
+            deadline = BaudNow() + BAUD_GUARD_MS + BAUD_PROBE_TIMEOUT_MS;
+        }
+
+        else if ((baudState == BAUD_PROPOSING) && (nonce == peerNonce))
+        {
+            /* Nobody leads, both propose again with new nonces */
+            baudState = BAUD_IDLE;
+        }
+
+        else
+        {
+
+        }
+    }
+
+    else if ((frame->type == (uint8_t)LINK_FRAME_BAUD_ACCEPT) && (baudState == BAUD_PROPOSING) && (index == trialIndex))
+    {
+        /* The probes follow the guard time, see BaudPoll() */
+        BaudSwitch(index);
+        probesSent = 0U;
+        baudState = BAUD_PROBING;
+        deadline = BaudNow() + BAUD_GUARD_MS + BAUD_PROBE_TIMEOUT_MS + BAUD_REPLY_TIMEOUT_MS;
+    }
+
+    else if ((frame->type == (uint8_t)LINK_FRAME_BAUD_RESULT) && (baudState == BAUD_PROBING) && (index == trialIndex))
+    {
+        /* Keep the rate only if both directions were clean */
+        if ((frame->length >= 6U) && (frame->payload[5] == 1U) && (BaudLineErrors() == errorBaseline))
+        {
+            BaudSendRate((uint8_t)LINK_FRAME_BAUD_CONFIRM, index);
+            goodIndex = index;
+            baudStats.probesPassed++;
+            baudState = BAUD_IDLE;
+            retries = 0U;
+
+            /* Climb on at once */
+            nextAttempt = BaudNow();
+        }
+
+        else
+        {
+            BaudGiveUp();
+        }
+    }
+
+    else if ((frame->type == (uint8_t)LINK_FRAME_BAUD_CONFIRM) && (baudState == BAUD_CONFIRMING) && (index == trialIndex))
+    {
+        /* The proposing board leads the climb, just follow it */
+        goodIndex = index;
+        baudStats.probesPassed++;
+        baudState = BAUD_IDLE;
+        retries = 0U;
+        nextAttempt = BaudNow() + BAUD_REPROBE_MS;
+    }
+
+    else if ((frame->type == (uint8_t)LINK_FRAME_BAUD_STEP_DOWN) && (baudState == BAUD_IDLE) && (index < goodIndex))
+    {
+        BaudSwitch(index);
+        goodIndex = index;
+        baudStats.peerStepDowns++;
+        nextAttempt = BaudNow() + BAUD_REPROBE_MS;
+    }
+
+    else
+    {
+
+    }
+
+    ArqSetPause(LINK_PORT_UART1, (baudState != BAUD_IDLE));
+}
+
+/*
+ * Description :
+ * This function copies the baud rate negotiation counters.
+ * Parameters: stats -> A pointer to the structure where the counters will be stored.
+ * Returns: None.
+ */
+void BaudGetStats(baudStats_t *stats)
+{
+    if (NULL != stats)
+    {
+        *stats = baudStats;
+        stats->rate = UARTGetBaudRate((uint32_t)UART1_MODULE);
+    }
+
+    else
+    {
+
+    }
+}
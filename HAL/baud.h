@@ -0,0 +1,135 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   baud.h                                                       *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file for the UART1 baud rate negotiation and the      *
+ *                link error monitor                                           *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef BAUD_H_
+#define BAUD_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "HAL/arq.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* Negotiation: both boards start at UART1_BAUD_RATE, the safe rate. One board
+ * proposes the next rate of the ladder, both switch to it, test patterns are
+ * sent and the rate is kept only if every pattern arrived without any line
+ * error. The climb goes on until a rate fails, BAUD_MAX_RATE is reached or
+ * the top of the ladder is reached. */
+#define BAUD_MAX_RATE 5000000U
+
+/* Rates producing a larger error with the system clock are skipped, in 1/100 % */
+#define BAUD_MAX_ERROR_X100 150
+
+/* Test patterns sent at every tried rate, and their length */
+#define BAUD_PROBE_COUNT  8U
+#define BAUD_PROBE_LENGTH 64U
+
+/* Time allowed for an answer during the negotiation */
+#define BAUD_REPLY_TIMEOUT_MS 300U
+
+/* Time allowed to the test patterns once both boards switched */
+#define BAUD_PROBE_TIMEOUT_MS 300U
+
+/* Time after a switch before the line errors are counted against the new
+ * rate, the bytes sent at the old rate may still be arriving. The reliable
+ * delivery layer sends nothing on UART1 from the proposal until the rate
+ * is confirmed or given up */
+#define BAUD_GUARD_MS 60U
+
+/* Delay before proposing again when the other board did not answer, or
+ * after a failed try while still at the safe rate, at most
+ * BAUD_RETRY_COUNT times in a row */
+#define BAUD_RETRY_MS 2000U
+#define BAUD_RETRY_COUNT 3U
+
+/* Delay before climbing again after the negotiation settled or stepped down */
+#define BAUD_REPROBE_MS 60000U
+
+/* Monitor: every BAUD_MONITOR_PERIOD_MS the UART1 line errors (framing,
+ * parity, break, overrun) and the CRC errors are compared with the
+ * received bytes, and the link steps down one rate of the ladder when
+ * there were at least BAUD_MIN_ERRORS errors and more than
+ * BAUD_MAX_ERRORS_PER_1000 errors per 1000 received bytes. */
+#define BAUD_MONITOR_PERIOD_MS 1000U
+#define BAUD_MIN_ERRORS 3U
+#define BAUD_MAX_ERRORS_PER_1000 5U
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Structure holding the baud rate negotiation counters.
+ *              - rate          : The current UART1 baud rate.
+ *              - probesPassed  : Rates tried and kept.
+ *              - probesFailed  : Rates tried and given up.
+ *              - noAnswer      : Proposals the other board did not answer.
+ *              - stepDowns     : Rate decreases decided by the error monitor.
+ *              - peerStepDowns : Rate decreases requested by the other board.
+ */
+typedef struct
+{
+    uint32_t rate;
+    uint32_t probesPassed;
+    uint32_t probesFailed;
+    uint32_t noAnswer;
+    uint32_t stepDowns;
+    uint32_t peerStepDowns;
+} baudStats_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function resets the negotiation to the safe rate and takes the
+ * control frames of the reliable delivery layer.
+ * Parameters: None.
+ * Returns: None.
+ */
+void BaudInit(void);
+
+/*
+ * Description :
+ * This function runs the negotiation and the error monitor. It is run
+ * once on every tick in every state (MainTick()), so the deadlines of a
+ * negotiation expire even in the Off state. No rate is proposed while
+ * UART1 is disabled.
+ * Parameters: None.
+ * Returns: None.
+ */
+void BaudPoll(void);
+
+/*
+ * Description :
+ * This function handles a negotiation frame from the other board.
+ * Parameters: frame -> The received control frame.
+ * Returns: None.
+ */
+void BaudHandleFrame(const linkFrame_t *frame);
+
+/*
+ * Description :
+ * This function copies the baud rate negotiation counters.
+ * Parameters: stats -> A pointer to the structure where the counters will be stored.
+ * Returns: None.
+ */
+void BaudGetStats(baudStats_t *stats);
+
+#endif /* BAUD_H_ */
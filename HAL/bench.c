@@ -0,0 +1,866 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   bench.c                                                      *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the throughput and latency benchmark suite   *
+ *                of the link between the two boards                           *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include "HAL/bench.h"
+#include "HAL/UART_API.h"
+#include "HAL/baud.h"
+#include "HAL/crc.h"
+#include "HAL/power.h"
+#include "HAL/switch.h"
+#include "HAL/cycle_counter.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* Message sizes measured by the suite, from a single byte to the chat
+ * echo size (MAX_UART_SEND_CHARS) and several fragments beyond it */
+#define BENCH_SIZE_COUNT 7U
+
+/* Frame sizes given to the compressor: a streamed chat segment and a
+ * full frame, as sent by the fragmentation and file transfer layers */
+#define BENCH_COMPRESSION_FRAME_COUNT 2U
+
+/*******************************************************************************
+ *                            Global Variables                                 *
+ *******************************************************************************/
+#if (BENCH_MODE == 1U)
+static const uint16_t benchSizes[BENCH_SIZE_COUNT] = {
+                1U, 16U, 64U, 128U,
+                (uint16_t)MAX_UART_SEND_CHARS,
+                (uint16_t)(2U * (uint32_t)MAX_UART_SEND_CHARS),
+                (uint16_t)(4U * (uint32_t)MAX_UART_SEND_CHARS)
+};
+
+/* Payload of a benchmark frame, refilled with pseudo-random bytes for
+ * each one so the compressor finds nothing to shorten. The last byte of a
+ * message is its number so that the answer tells which message arrived */
+static uint8_t benchChunk[ARQ_MAX_PAYLOAD];
+static uint32_t benchSeed = 1U;
+
+static uint32_t benchLatencies[BENCH_LATENCY_SAMPLES];
+
+/* Answers owed to the other board, the last byte of each of its messages */
+static uint8_t pendingReplies[BENCH_PENDING_REPLIES];
+static uint8_t pendingHead = 0U;
+static uint8_t pendingCount = 0U;
+
+/* The message waited for by the latency run and whether it was answered */
+static uint8_t awaitedId = 0U;
+static bool awaitedAnswered = false;
+
+/* The messages counted by the throughput run and how many were answered */
+static bool throughputRunning = false;
+static uint8_t throughputFirstId = 0U;
+static uint32_t throughputAnswered = 0U;
+
+static uint8_t nextId = 0U;
+
+/* The SysTick tick the negotiation last ran on, see BenchServe() */
+static uint32_t baudTick = 0U;
+
+static const uint8_t benchCompressionFrames[BENCH_COMPRESSION_FRAME_COUNT] = {
+                (uint8_t)UART_STREAM_SEGMENT_SIZE, (uint8_t)ARQ_MAX_PAYLOAD
+};
+
+static const char * const benchCorpusNames[BENCH_CORPUS_COUNT] = {"chat", "log", "random"};
+
+/* Lines the chat corpus is made of, repeated in turn */
+#define BENCH_CHAT_LINES 6U
+static const char * const benchChatLines[BENCH_CHAT_LINES] = {
+                "Hello, are you there?\r\n",
+                "Yes, I can read you, the link is up.\r\n",
+                "I am sending the new configuration now, tell me when it arrives.\r\n",
+                "Got it, thanks! The board restarted with the new settings.\r\n",
+                "Can you check the baud rate on your side?\r\n",
+                "Message received, all good here.\r\n"
+};
+
+/* The corpus being measured, and the streams it goes through */
+static uint8_t benchCorpus[BENCH_CORPUS_SIZE];
+static uint8_t benchPacked[ARQ_MAX_PAYLOAD];
+static uint8_t benchUnpacked[ARQ_MAX_PAYLOAD];
+static lzEncoder_t benchEncoder;
+static lzDecoder_t benchDecoder;
+#endif
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+#if (BENCH_MODE == 1U)
+static uint32_t BenchNow(void);
+static bool BenchExpired(uint32_t time);
+static bool BenchWorkPending(void);
+static void BenchOnReply(uint8_t id);
+static void BenchServe(void);
+static void BenchSendMessage(uint16_t size, uint8_t id);
+static void BenchSort(uint32_t *values, uint32_t count);
+static uint32_t BenchPercentile(const uint32_t *sorted, uint32_t count, uint32_t percent);
+static void BenchChunkFill(uint8_t length);
+static void BenchPrintField(const char *name, uint32_t value);
+static void BenchPrintConfig(void);
+static void BenchPrintResult(const benchResult_t *result);
+static uint16_t BenchCorpusText(uint16_t at, const char *text);
+static uint16_t BenchCorpusNumber(uint16_t at, uint32_t value);
+static void BenchCorpusFill(uint8_t corpus);
+static void BenchPrintCompression(const benchCompression_t *result);
+static void BenchSuite(void);
+#endif
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+#if (BENCH_MODE == 1U)
+/*
+ * Description :
+ * This function returns the current time.
+ * Parameters: None.
+ * Returns: The time since reset in ms, with the SysTick resolution.
+ */
+static uint32_t BenchNow(void)
+{
+    return SysticGetTicks() * SYSTICK_PERIOD_MS;
+}
+
+/*
+ * Description :
+ * This function tells whether a point in time has been reached.
+ * Parameters: time -> The point in time in ms.
+ * Returns: true if the current time is at or after it.
+ */
+static bool BenchExpired(uint32_t time)
+{
+    return ((int32_t)(BenchNow() - time) >= 0);
+}
+
+/*
+ * Description :
+ * This function tells the idle path whether the benchmark has work: bytes
+ * from the other board or a character typed on the terminal. In uDMA mode
+ * the link is polled while its bytes keep arriving (UARTLinkPolling()).
+ * Parameters: None.
+ * Returns: true if work is pending.
+ */
+static bool BenchWorkPending(void)
+{
+    return (UARTRxAvailable((uint32_t)UART1_MODULE) != 0U) || (UARTRxAvailable((uint32_t)UART0_MODULE) != 0U) ||
+           UARTLinkPolling();
+}
+
+/*
+ * Description :
+ * This function takes an answer of the other board into account.
+ * Parameters: id -> The number of the answered message.
+ * Returns: None.
+ */
+static void BenchOnReply(uint8_t id)
+{
+    if (id == awaitedId)
+    {
+        awaitedAnswered = true;
+    }
+
+    else
+    {
+
+    }
+
+    /* Late answers of the latency run are not counted */
+    if (throughputRunning && ((uint8_t)(id - throughputFirstId) < (uint8_t)BENCH_THROUGHPUT_MESSAGES))
+    {
+        throughputAnswered++;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function serves the link once: it runs the baud rate negotiation
+ * on a new tick (the suite runs outside the scheduler, so MainTick() does
+ * not), handles the next benchmark frame, sends the answers owed to the
+ * other board and sleeps when nothing was received.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void BenchServe(void)
+{
+    const linkFrame_t *frame;
+
+    if (SysticGetTicks() != baudTick)
+    {
+        baudTick = SysticGetTicks();
+        BaudPoll();
+    }
+
+    else
+    {
+
+    }
+
+    frame = ArqPoll(LINK_PORT_UART1);
+
+    if (NULL != frame)
+    {
+        if ((frame->type == (uint8_t)LINK_FRAME_BENCH_END) && (frame->length != 0U) &&
+            (pendingCount < BENCH_PENDING_REPLIES))
+        {
+            pendingReplies[(pendingHead + pendingCount) & (BENCH_PENDING_REPLIES - 1U)] = frame->payload[frame->length - 1U];
+            pendingCount++;
+        }
+
+        else if ((frame->type == (uint8_t)LINK_FRAME_BENCH_REPLY) && (frame->length == 1U))
+        {
+            BenchOnReply(frame->payload[0]);
+        }
+
+        else
+        {
+
+        }
+    }
+
+    else
+    {
+
+    }
+
+    /* Answer in order, as the send window frees up */
+    while ((pendingCount != 0U) && ArqSend(LINK_PORT_UART1, (uint8_t)LINK_FRAME_BENCH_REPLY, &pendingReplies[pendingHead], 1U))
+    {
+        pendingHead = (uint8_t)((pendingHead + 1U) & (BENCH_PENDING_REPLIES - 1U));
+        pendingCount--;
+    }
+
+    /* Sleep until the next byte, timer tick or character */
+    if (NULL == frame)
+    {
+        PowerIdle(&BenchWorkPending);
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function fills the payload of the next benchmark frame with
+ * pseudo-random bytes: every byte value appears, FLAG and ESCAPE
+ * included, so the byte stuffing costs what it costs on average.
+ * Parameters: length -> The frame length in bytes.
+ * Returns: None.
+ */
+static void BenchChunkFill(uint8_t length)
+{
+    uint8_t i;
+
+    for (i = 0U; i < length; i++)
+    {
+        benchSeed = (benchSeed * 1103515245U) + 12345U;
+        benchChunk[i] = (uint8_t)(benchSeed >> 16);
+    }
+}
+
+/*
+ * Description :
+ * This function hands a benchmark message to the reliable delivery layer,
+ * in frames of up to ARQ_MAX_PAYLOAD bytes, serving the link while the
+ * send window is full.
+ * Parameters: size -> The message size in bytes.
+ *             id   -> The message number, carried by its last byte.
+ * Returns: None.
+ */
+static void BenchSendMessage(uint16_t size, uint8_t id)
+{
+    uint16_t offset = 0U;
+
+    while (offset < size)
+    {
+        uint16_t left = (uint16_t)(size - offset);
+        uint8_t length = (left > ARQ_MAX_PAYLOAD) ? (uint8_t)ARQ_MAX_PAYLOAD : (uint8_t)left;
+        bool last = ((uint16_t)(offset + length) == size);
+
+        BenchChunkFill(length);
+
+        if (last)
+        {
+            benchChunk[length - 1U] = id;
+        }
+
+        else
+        {
+
+        }
+
+        /* The payload is copied into the send window */
+        while (!ArqSend(LINK_PORT_UART1, last ? (uint8_t)LINK_FRAME_BENCH_END : (uint8_t)LINK_FRAME_BENCH, benchChunk, length))
+        {
+            BenchServe();
+        }
+
+        offset += length;
+    }
+}
+
+/*
+ * Description :
+ * This function sorts values in ascending order (insertion sort, the
+ * sample count is small).
+ * Parameters: values -> The values to be sorted.
+ *             count  -> The number of values.
+ * Returns: None.
+ */
+static void BenchSort(uint32_t *values, uint32_t count)
+{
+    uint32_t i;
+
+    for (i = 1U; i < count; i++)
+    {
+        uint32_t value = values[i];
+        uint32_t j = i;
+
+        while ((j > 0U) && (values[j - 1U] > value))
+        {
+            values[j] = values[j - 1U];
+            j--;
+        }
+
+        values[j] = value;
+    }
+}
+
+/*
+ * Description :
+ * This function picks a percentile of sorted values (nearest rank).
+ * Parameters: sorted  -> The values in ascending order.
+ *             count   -> The number of values.
+ *             percent -> The percentile, from 1 to 100.
+ * Returns: The percentile, 0 when there are no values.
+ */
+static uint32_t BenchPercentile(const uint32_t *sorted, uint32_t count, uint32_t percent)
+{
+    return (count != 0U) ? sorted[(((count * percent) + 99U) / 100U) - 1U] : 0U;
+}
+
+/*
+ * Description :
+ * This function prints a JSON number field followed by a comma.
+ * Parameters: name  -> The field name.
+ *             value -> The field value.
+ * Returns: None.
+ */
+static void BenchPrintField(const char *name, uint32_t value)
+{
+    UARTprint("\"");
+    UARTprint(name);
+    UARTprint("\":");
+    UARTprintDecimal(value);
+    UARTprint(",");
+}
+
+/*
+ * Description :
+ * This function prints the settings the results depend on.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void BenchPrintConfig(void)
+{
+    baudStats_t baud;
+    uint32_t crcCycles = CRC16Benchmark();
+
+    BaudGetStats(&baud);
+
+    UARTprint("{\"type\":\"config\",\"firmware\":\"" BENCH_FIRMWARE_VERSION "\",");
+    BenchPrintField("clock_hz", ClockGetHz());
+    BenchPrintField("baud", baud.rate);
+    BenchPrintField("fifo", (uint32_t)UART_FIFO_MODE);
+    BenchPrintField("dma", (uint32_t)UART1_DMA_MODE);
+    BenchPrintField("idle_sleep", (uint32_t)POWER_IDLE_SLEEP);
+    BenchPrintField("window", (uint32_t)ARQ_WINDOW_SIZE);
+    BenchPrintField("max_payload", (uint32_t)ARQ_MAX_PAYLOAD);
+    BenchPrintField("compression", (uint32_t)ARQ_COMPRESSION);
+    BenchPrintField("random_payload", 1U);
+    BenchPrintField("crc_cycles_per_byte_x100", crcCycles);
+    BenchPrintField("crc_cpu_x100_at_max_baud", CRC16LoadX100(crcCycles, BAUD_MAX_RATE));
+    BenchPrintField("max_baud", (uint32_t)BAUD_MAX_RATE);
+    BenchPrintField("latency_samples", (uint32_t)BENCH_LATENCY_SAMPLES);
+    UARTprint("\"throughput_messages\":");
+    UARTprintDecimal((uint32_t)BENCH_THROUGHPUT_MESSAGES);
+    UARTprint("}\n\r");
+}
+
+/*
+ * Description :
+ * This function prints the results of one message size.
+ * Parameters: result -> The results.
+ * Returns: None.
+ */
+static void BenchPrintResult(const benchResult_t *result)
+{
+    UARTprint("{\"type\":\"result\",");
+    BenchPrintField("size", (uint32_t)result->size);
+    BenchPrintField("messages", result->messages);
+    BenchPrintField("lost", result->lost);
+    BenchPrintField("loss_ppm", (result->messages != 0U) ?
+                    (uint32_t)(((uint64_t)result->lost * 1000000U) / result->messages) : 0U);
+    BenchPrintField("latency_p50_us", result->latencyP50Us);
+    BenchPrintField("latency_p99_us", result->latencyP99Us);
+    BenchPrintField("latency_max_us", result->latencyMaxUs);
+    BenchPrintField("goodput_bytes_per_s", result->goodput);
+    BenchPrintField("cycles_per_byte", result->cyclesPerByte);
+    BenchPrintField("retransmits", result->retransmits);
+    BenchPrintField("crc_errors", result->crcErrors);
+    BenchPrintField("rx_overruns", result->rxOverruns);
+    BenchPrintField("rx_dropped", result->rxDropped);
+    UARTprint("\"baud\":");
+    UARTprintDecimal(result->baudRate);
+    UARTprint("}\n\r");
+}
+
+/*
+ * Description :
+ * This function copies text into the corpus, as far as it has room.
+ * Parameters: at   -> The corpus index of the first character.
+ *             text -> The text to be copied.
+ * Returns: The corpus index following the text.
+ */
+static uint16_t BenchCorpusText(uint16_t at, const char *text)
+{
+    uint16_t index = at;
+
+    while ((index < BENCH_CORPUS_SIZE) && (*text != '\0'))
+    {
+        benchCorpus[index] = (uint8_t)*text;
+        index++;
+        text++;
+    }
+
+    return index;
+}
+
+/*
+ * Description :
+ * This function writes a number into the corpus in decimal, as far as it has room.
+ * Parameters: at    -> The corpus index of the first digit.
+ *             value -> The number to be written.
+ * Returns: The corpus index following the number.
+ */
+static uint16_t BenchCorpusNumber(uint16_t at, uint32_t value)
+{
+    char digits[11];
+    uint8_t count = 0U;
+    uint16_t index = at;
+
+    do
+    {
+        digits[count] = (char)('0' + (value % 10U));
+        count++;
+        value /= 10U;
+    } while (value != 0U);
+
+    while ((index < BENCH_CORPUS_SIZE) && (count != 0U))
+    {
+        count--;
+        benchCorpus[index] = (uint8_t)digits[count];
+        index++;
+    }
+
+    return index;
+}
+
+/*
+ * Description :
+ * This function fills the corpus: chat lines, status log lines whose
+ * counters change from one line to the next, or pseudo-random bytes
+ * that do not compress.
+ * Parameters: corpus -> The corpus (BENCH_CORPUS_xxx).
+ * Returns: None.
+ */
+static void BenchCorpusFill(uint8_t corpus)
+{
+    uint16_t at = 0U;
+    uint32_t line = 0U;
+    uint32_t seed = 12345U;
+
+    while (at < BENCH_CORPUS_SIZE)
+    {
+        if (corpus == BENCH_CORPUS_CHAT)
+        {
+            at = BenchCorpusText(at, benchChatLines[line % BENCH_CHAT_LINES]);
+        }
+
+        else if (corpus == BENCH_CORPUS_LOG)
+        {
+            at = BenchCorpusText(at, "[");
+            at = BenchCorpusNumber(at, 1000U + (line * 30U));
+            at = BenchCorpusText(at, "] uart1 rx=");
+            at = BenchCorpusNumber(at, line * 417U);
+            at = BenchCorpusText(at, " dropped=0 crc=");
+            at = BenchCorpusNumber(at, line / 16U);
+            at = BenchCorpusText(at, " baud=1000000\r\n");
+        }
+
+        else
+        {
+            seed = (seed * 1103515245U) + 12345U;
+            benchCorpus[at] = (uint8_t)(seed >> 16);
+            at++;
+        }
+
+        line++;
+    }
+}
+
+/*
+ * Description :
+ * This function prints the compression results of one corpus.
+ * Parameters: result -> The results.
+ * Returns: None.
+ */
+static void BenchPrintCompression(const benchCompression_t *result)
+{
+    UARTprint("{\"type\":\"compression\",\"corpus\":\"");
+    UARTprint(benchCorpusNames[result->corpus]);
+    UARTprint("\",");
+    BenchPrintField("frame_bytes", (uint32_t)result->frameSize);
+    BenchPrintField("bytes", result->bytes);
+    BenchPrintField("packed_bytes", result->packedBytes);
+    BenchPrintField("ratio_x100", (result->packedBytes != 0U) ? ((result->bytes * 100U) / result->packedBytes) : 0U);
+    BenchPrintField("compress_cycles_per_byte", result->compressCycles);
+    BenchPrintField("decompress_cycles_per_byte", result->decompressCycles);
+    UARTprint("\"round_trip\":");
+    UARTprintDecimal(result->roundTrip ? 1U : 0U);
+    UARTprint("}\n\r");
+}
+
+/*
+ * Description :
+ * This function runs the whole suite and prints its results.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void BenchSuite(void)
+{
+    benchResult_t result;
+    uint8_t i;
+
+    BenchPrintConfig();
+
+    for (i = 0U; i < (BENCH_CORPUS_COUNT * BENCH_COMPRESSION_FRAME_COUNT); i++)
+    {
+        benchCompression_t compression;
+
+        BenchCompression(i / BENCH_COMPRESSION_FRAME_COUNT, benchCompressionFrames[i % BENCH_COMPRESSION_FRAME_COUNT], &compression);
+        BenchPrintCompression(&compression);
+    }
+
+    for (i = 0U; i < BENCH_SIZE_COUNT; i++)
+    {
+        BenchMeasure(benchSizes[i], &result);
+        BenchPrintResult(&result);
+    }
+
+    UARTprint("{\"type\":\"end\"}\n\r");
+}
+#endif
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function runs the benchmark mode: it answers the benchmark messages
+ * of the other board and runs the suite when a character is typed on the
+ * terminal. It never returns, unless BENCH_MODE is 0U: it then only says
+ * so, the suite and its buffers being left out of the build.
+ * Parameters: None.
+ * Returns: None.
+ */
+void BenchRun(void)
+{
+#if (BENCH_MODE == 1U)
+    uint32_t settle = BenchNow() + BENCH_SETTLE_MS;
+    uint8_t key;
+
+    while(1)
+    {
+        if (UARTReceive((uint32_t)UART0_MODULE, &key))
+        {
+            /* Measure at the rate the negotiation settles on */
+            while (!BenchExpired(settle))
+            {
+                BenchServe();
+            }
+
+            BenchSuite();
+        }
+
+        else
+        {
+            BenchServe();
+        }
+    }
+#else
+    UARTprint("Bench : build with BENCH_MODE set to 1U\n\r");
+#endif
+}
+
+/*
+ * Description :
+ * This function measures one message size against the other board,
+ * which must be running BenchRun().
+ * Parameters: size   -> The message size in bytes, messages larger than
+ *                       ARQ_MAX_PAYLOAD are sent in several frames.
+ *             result -> A pointer to the structure where the results will be
+ *                       stored, cleared when BENCH_MODE is 0U.
+ * Returns: None.
+ */
+void BenchMeasure(uint16_t size, benchResult_t *result)
+{
+#if (BENCH_MODE == 1U)
+    uint32_t cyclesPerUs = ClockGetHz() / 1000000U;
+    uint32_t samples = 0U;
+    uint32_t deadline;
+    uint32_t start;
+    uint32_t cycles;
+    uint32_t bytes;
+    uint32_t i;
+    arqStats_t arqBefore;
+    arqStats_t arqAfter;
+    linkStats_t linkBefore;
+    linkStats_t linkAfter;
+    uartStats_t uartBefore;
+    uartStats_t uartAfter;
+    powerStats_t power;
+    baudStats_t baud;
+
+    if ((NULL == result) || (size == 0U))
+    {
+        return;
+    }
+
+    else
+    {
+
+    }
+
+    (void)memset(result, 0, sizeof(*result));
+    result->size = size;
+    ArqGetStats(LINK_PORT_UART1, &arqBefore);
+    LinkGetStats(LINK_PORT_UART1, &linkBefore);
+    UARTGetStats((uint32_t)UART1_MODULE, &uartBefore);
+
+    /* Latency: one message at a time, from handing it to the link
+     * until its answer is received */
+    for (i = 0U; i < BENCH_LATENCY_SAMPLES; i++)
+    {
+        awaitedId = nextId;
+        awaitedAnswered = false;
+        nextId++;
+
+        start = CYCLE_COUNTER_GET();
+        BenchSendMessage(size, awaitedId);
+
+        deadline = BenchNow() + BENCH_REPLY_TIMEOUT_MS;
+        while (!awaitedAnswered && !BenchExpired(deadline))
+        {
+            BenchServe();
+        }
+
+        if (awaitedAnswered)
+        {
+            benchLatencies[samples] = (CYCLE_COUNTER_GET() - start) / cyclesPerUs;
+            samples++;
+        }
+
+        else
+        {
+            result->lost++;
+        }
+    }
+
+    BenchSort(benchLatencies, samples);
+    result->latencyP50Us = BenchPercentile(benchLatencies, samples, 50U);
+    result->latencyP99Us = BenchPercentile(benchLatencies, samples, 99U);
+    result->latencyMaxUs = BenchPercentile(benchLatencies, samples, 100U);
+
+    /* Throughput: every message queued as soon as the send window has
+     * room, until the last one is answered */
+    throughputFirstId = nextId;
+    throughputAnswered = 0U;
+    throughputRunning = true;
+    PowerResetStats();
+    start = CYCLE_COUNTER_GET();
+
+    for (i = 0U; i < BENCH_THROUGHPUT_MESSAGES; i++)
+    {
+        BenchSendMessage(size, nextId);
+        nextId++;
+    }
+
+    deadline = BenchNow() + BENCH_REPLY_TIMEOUT_MS;
+    while ((throughputAnswered < BENCH_THROUGHPUT_MESSAGES) && !BenchExpired(deadline))
+    {
+        BenchServe();
+    }
+
+    cycles = CYCLE_COUNTER_GET() - start;
+    throughputRunning = false;
+    PowerGetStats(&power);
+
+    bytes = throughputAnswered * (uint32_t)size;
+    result->lost += BENCH_THROUGHPUT_MESSAGES - throughputAnswered;
+    result->messages = BENCH_LATENCY_SAMPLES + BENCH_THROUGHPUT_MESSAGES;
+
+    if ((cycles != 0U) && (bytes != 0U))
+    {
+        result->goodput = (uint32_t)(((uint64_t)bytes * ClockGetHz()) / cycles);
+        result->cyclesPerByte = (uint32_t)((((uint64_t)cycles * (10000U - power.idlePercentX100)) / 10000U) / bytes);
+    }
+
+    else
+    {
+
+    }
+
+    ArqGetStats(LINK_PORT_UART1, &arqAfter);
+    LinkGetStats(LINK_PORT_UART1, &linkAfter);
+    UARTGetStats((uint32_t)UART1_MODULE, &uartAfter);
+    BaudGetStats(&baud);
+    result->retransmits = arqAfter.retransmits - arqBefore.retransmits;
+    result->crcErrors = linkAfter.crcErrors - linkBefore.crcErrors;
+    result->rxOverruns = uartAfter.rxOverrun - uartBefore.rxOverrun;
+    result->rxDropped = uartAfter.rxDropped - uartBefore.rxDropped;
+    result->baudRate = baud.rate;
+#else
+    (void)size;
+
+    if (NULL != result)
+    {
+        (void)memset(result, 0, sizeof(*result));
+    }
+
+    else
+    {
+
+    }
+#endif
+}
+
+/*
+ * Description :
+ * This function measures the link compressor on one corpus, without the
+ * other board: every frame is compressed on a fresh stream and decoded back.
+ * Parameters: corpus    -> The corpus (BENCH_CORPUS_xxx).
+ *             frameSize -> The bytes given to the compressor at a time, up
+ *                          to ARQ_MAX_PAYLOAD.
+ *             result    -> A pointer to the structure where the results will be
+ *                          stored, cleared when BENCH_MODE is 0U.
+ * Returns: None.
+ */
+void BenchCompression(uint8_t corpus, uint8_t frameSize, benchCompression_t *result)
+{
+#if (BENCH_MODE == 1U)
+    uint32_t compressCycles = 0U;
+    uint32_t decompressCycles = 0U;
+    uint16_t offset = 0U;
+
+    if ((NULL == result) || (corpus >= BENCH_CORPUS_COUNT) || (frameSize == 0U) || (frameSize > ARQ_MAX_PAYLOAD))
+    {
+        return;
+    }
+
+    else
+    {
+
+    }
+
+    (void)memset(result, 0, sizeof(*result));
+    result->corpus = corpus;
+    result->frameSize = frameSize;
+    result->bytes = BENCH_CORPUS_SIZE;
+    result->roundTrip = true;
+
+    BenchCorpusFill(corpus);
+    LzEncoderInit(&benchEncoder);
+    LzDecoderInit(&benchDecoder);
+    CycleCounterInit();
+
+    while (offset < BENCH_CORPUS_SIZE)
+    {
+        uint16_t left = (uint16_t)(BENCH_CORPUS_SIZE - offset);
+        uint16_t length = (left > frameSize) ? (uint16_t)frameSize : left;
+        uint16_t produced = length;
+        uint16_t packed;
+        bool decoded = true;
+        uint32_t start;
+
+        /* Only what is kept shorter is sent compressed, as on the link */
+        start = CYCLE_COUNTER_GET();
+        packed = LzCompress(&benchEncoder, &benchCorpus[offset], length, benchPacked, (uint16_t)(length - 1U));
+        compressCycles += CYCLE_COUNTER_GET() - start;
+
+        start = CYCLE_COUNTER_GET();
+        if (packed != 0U)
+        {
+            decoded = LzDecompress(&benchDecoder, benchPacked, packed, benchUnpacked, (uint16_t)ARQ_MAX_PAYLOAD, &produced);
+        }
+
+        else
+        {
+            LzDecoderAppend(&benchDecoder, &benchCorpus[offset], length);
+        }
+        decompressCycles += CYCLE_COUNTER_GET() - start;
+
+        if ((packed != 0U) && (!decoded || (produced != length) || (memcmp(benchUnpacked, &benchCorpus[offset], length) != 0)))
+        {
+            result->roundTrip = false;
+        }
+
+        else
+        {
+
+        }
+
+        result->packedBytes += (packed != 0U) ? packed : length;
+        offset += length;
+    }
+
+    result->compressCycles = compressCycles / BENCH_CORPUS_SIZE;
+    result->decompressCycles = decompressCycles / BENCH_CORPUS_SIZE;
+#else
+    (void)corpus;
+    (void)frameSize;
+
+    if (NULL != result)
+    {
+        (void)memset(result, 0, sizeof(*result));
+    }
+
+    else
+    {
+
+    }
+#endif
+}
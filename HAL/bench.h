@@ -0,0 +1,169 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   bench.h                                                      *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file for the throughput and latency benchmark suite   *
+ *                of the link between the two boards                           *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "HAL/arq.h"
+#include "HAL/lz.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* Benchmark configuration:
+ * BENCH_MODE replaces the chat by the benchmark suite when 1U. Both boards
+ * then answer the benchmark messages of the other one, and a character
+ * typed on the terminal of a board starts the suite on it. The results are
+ * printed on that terminal, one JSON object per line (see the README).
+ * When 0U the suite and its buffers are left out of the build. The host
+ * simulation build sets it from the command line. */
+#ifndef BENCH_MODE
+#define BENCH_MODE 0U
+#endif
+
+/* Reported with the results, to tell the firmware versions apart */
+#define BENCH_FIRMWARE_VERSION "1.0.0"
+
+/* Messages sent one at a time to measure the latency of each size */
+#define BENCH_LATENCY_SAMPLES 100U
+
+/* Messages sent back to back, as fast as the send window allows, to
+ * measure the goodput and the CPU cycles per byte of each size */
+#define BENCH_THROUGHPUT_MESSAGES 32U
+
+/* A message not answered within this time is counted as lost */
+#define BENCH_REPLY_TIMEOUT_MS 3000U
+
+/* Time given to the baud rate negotiation before the first measurement */
+#define BENCH_SETTLE_MS 4000U
+
+/* Answers waiting for room in the send window of the answering board */
+#define BENCH_PENDING_REPLIES 16U
+
+/* Bytes of every corpus given to the link compressor (lz.h), cut in
+ * frames of each of the BENCH_COMPRESSION_FRAMES sizes */
+#define BENCH_CORPUS_SIZE 1024U
+
+/* Corpora of the compression measurements */
+#define BENCH_CORPUS_CHAT   0U
+#define BENCH_CORPUS_LOG    1U
+#define BENCH_CORPUS_RANDOM 2U
+#define BENCH_CORPUS_COUNT  3U
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Structure holding the results of one message size.
+ *              - size          : The message size in bytes.
+ *              - messages      : Messages sent, latency and throughput runs together.
+ *              - lost          : Messages not answered within BENCH_REPLY_TIMEOUT_MS.
+ *              - latencyP50Us  : Median time from sending a message to its answer, in us.
+ *              - latencyP99Us  : 99th percentile of that time, in us.
+ *              - latencyMaxUs  : Slowest answer, in us.
+ *              - goodput       : Message bytes per second of the throughput run.
+ *              - cyclesPerByte : CPU cycles spent awake per message byte of the
+ *                                throughput run, sending and receiving included.
+ *              - retransmits   : Frames sent again by the reliable delivery layer.
+ *              - crcErrors     : Frames received with a CRC mismatch.
+ *              - rxOverruns    : UART1 hardware overruns on this board.
+ *              - rxDropped     : UART1 bytes lost because the receive ring buffer was full.
+ *              - baudRate      : The UART1 baud rate at the end of the size.
+ */
+typedef struct
+{
+    uint16_t size;
+    uint32_t messages;
+    uint32_t lost;
+    uint32_t latencyP50Us;
+    uint32_t latencyP99Us;
+    uint32_t latencyMaxUs;
+    uint32_t goodput;
+    uint32_t cyclesPerByte;
+    uint32_t retransmits;
+    uint32_t crcErrors;
+    uint32_t rxOverruns;
+    uint32_t rxDropped;
+    uint32_t baudRate;
+} benchResult_t;
+
+/*
+ * Description: Structure holding the compression results of one corpus.
+ *              - corpus           : The corpus (BENCH_CORPUS_xxx).
+ *              - frameSize        : The bytes given to the compressor at a time.
+ *              - bytes            : The corpus size in bytes.
+ *              - packedBytes      : The bytes sent, frames that do not shrink
+ *                                   counted at their own size.
+ *              - compressCycles   : CPU cycles per corpus byte spent compressing.
+ *              - decompressCycles : CPU cycles per corpus byte spent decompressing.
+ *              - roundTrip        : Every frame was decoded back to the original.
+ */
+typedef struct
+{
+    uint8_t corpus;
+    uint8_t frameSize;
+    uint32_t bytes;
+    uint32_t packedBytes;
+    uint32_t compressCycles;
+    uint32_t decompressCycles;
+    bool roundTrip;
+} benchCompression_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function runs the benchmark mode: it answers the benchmark messages
+ * of the other board and runs the suite when a character is typed on the
+ * terminal. It never returns, unless BENCH_MODE is 0U: it then only says
+ * so, the suite and its buffers being left out of the build.
+ * Parameters: None.
+ * Returns: None.
+ */
+void BenchRun(void);
+
+/*
+ * Description :
+ * This function measures one message size against the other board,
+ * which must be running BenchRun().
+ * Parameters: size   -> The message size in bytes, messages larger than
+ *                       ARQ_MAX_PAYLOAD are sent in several frames.
+ *             result -> A pointer to the structure where the results will be
+ *                       stored, cleared when BENCH_MODE is 0U.
+ * Returns: None.
+ */
+void BenchMeasure(uint16_t size, benchResult_t *result);
+
+/*
+ * Description :
+ * This function measures the link compressor on one corpus, without the
+ * other board: every frame is compressed on a fresh stream and decoded back.
+ * Parameters: corpus    -> The corpus (BENCH_CORPUS_xxx).
+ *             frameSize -> The bytes given to the compressor at a time, up
+ *                          to ARQ_MAX_PAYLOAD.
+ *             result    -> A pointer to the structure where the results will be
+ *                          stored, cleared when BENCH_MODE is 0U.
+ * Returns: None.
+ */
+void BenchCompression(uint8_t corpus, uint8_t frameSize, benchCompression_t *result);
+
+#endif /* BENCH_H_ */
@@ -0,0 +1,53 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   clock.c                                                      *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the system clock setup                       *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include "HAL/clock.h"
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function sets up the system clock, it must be called
+ * first, before any peripheral is initialized.
+ * Parameters: None.
+ * Returns: None.
+ */
+void ClockInit(void)
+{
+#if (CLOCK_USE_PLL == 1U)
+    /* 16 MHz crystal -> PLL 400 MHz -> /2 -> /2.5 = 80 MHz */
+    SysCtlClockSet((uint32_t)SYSCTL_SYSDIV_2_5 | (uint32_t)SYSCTL_USE_PLL | (uint32_t)SYSCTL_OSC_MAIN | (uint32_t)SYSCTL_XTAL_16MHZ);
+#else
+    /* 16 MHz crystal, PLL bypassed */
+    SysCtlClockSet((uint32_t)SYSCTL_SYSDIV_1 | (uint32_t)SYSCTL_USE_OSC | (uint32_t)SYSCTL_OSC_MAIN | (uint32_t)SYSCTL_XTAL_16MHZ);
+#endif
+}
+
+/*
+ * Description :
+ * This function returns the system clock frequency. The configured
+ * value is returned rather than SysCtlClockGet(), which some TivaWare
+ * releases get wrong for the fractional /2.5 divider.
+ * Parameters: None.
+ * Returns: The system clock frequency in Hz.
+ */
+uint32_t ClockGetHz(void)
+{
+    return CLOCK_SYSTEM_HZ;
+}
@@ -0,0 +1,62 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   clock.h                                                      *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file for the system clock setup                       *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef CLOCK_H_
+#define CLOCK_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "driverlib/sysctl.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* System clock configuration:
+ * CLOCK_USE_PLL runs the core at 80 MHz from the PLL (400 MHz / 2 / 2.5) fed
+ * by the 16 MHz crystal of the LaunchPad when 1U, or straight from the
+ * 16 MHz crystal when 0U. Every peripheral timing (UART baud rates, SysTick)
+ * is derived from ClockGetHz(). */
+#define CLOCK_USE_PLL 1U
+
+#if (CLOCK_USE_PLL == 1U)
+#define CLOCK_SYSTEM_HZ 80000000U
+#else
+#define CLOCK_SYSTEM_HZ 16000000U
+#endif
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function sets up the system clock, it must be called
+ * first, before any peripheral is initialized.
+ * Parameters: None.
+ * Returns: None.
+ */
+void ClockInit(void);
+
+/*
+ * Description :
+ * This function returns the system clock frequency.
+ * Parameters: None.
+ * Returns: The system clock frequency in Hz.
+ */
+uint32_t ClockGetHz(void);
+
+#endif /* CLOCK_H_ */
@@ -0,0 +1,82 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   crc.h                                                        *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file for the table-driven CRC-16 used to protect      *
+ *                the frames of the inter-board link                           *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef CRC_H_
+#define CRC_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* CRC-16/CCITT-FALSE: polynomial 0x1021, initial value 0xFFFF, no reflection,
+ * no final XOR, the CRC of the ASCII string "123456789" is 0x29B1 */
+#define CRC16_INIT 0xFFFFU
+
+/* Number of bytes hashed by CRC16Benchmark() */
+#define CRC16_BENCHMARK_BYTES 512U
+
+/* Bits on the wire per byte of a UART running 8N1, for CRC16LoadX100() */
+#define CRC16_BITS_PER_BYTE 10U
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function adds one byte to a running CRC-16.
+ * Parameters: crc  -> The running CRC, CRC16_INIT for the first byte.
+ *             data -> The byte to be added.
+ * Returns: The updated CRC.
+ */
+uint16_t CRC16UpdateByte(uint16_t crc, uint8_t data);
+
+/*
+ * Description :
+ * This function adds a buffer to a running CRC-16, one table
+ * lookup per byte.
+ * Parameters: crc    -> The running CRC, CRC16_INIT for the first buffer.
+ *             data   -> The bytes to be added.
+ *             length -> The number of bytes to be added.
+ * Returns: The updated CRC.
+ */
+uint16_t CRC16Update(uint16_t crc, const uint8_t *data, uint32_t length);
+
+/*
+ * Description :
+ * This function measures the cost of CRC16Update() with the Cortex-M4
+ * DWT cycle counter over CRC16_BENCHMARK_BYTES bytes.
+ * Parameters: None.
+ * Returns: The CPU cycles per byte multiplied by 100.
+ */
+uint32_t CRC16Benchmark(void);
+
+/*
+ * Description :
+ * This function gives the share of the CPU the CRC of the received
+ * bytes takes when a UART receives without a pause at a baud rate.
+ * Parameters: cyclesX100 -> The CPU cycles per byte multiplied by 100,
+ *                           as returned by CRC16Benchmark().
+ *             baudRate   -> The baud rate of the UART.
+ * Returns: The share of the CPU time in 1/100 %.
+ */
+uint32_t CRC16LoadX100(uint32_t cyclesX100, uint32_t baudRate);
+
+#endif /* CRC_H_ */
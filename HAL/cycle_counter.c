@@ -0,0 +1,36 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   cycle_counter.c                                              *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the Cortex-M4 DWT cycle counter used to      *
+ *                measure execution and idle times                             *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include "HAL/cycle_counter.h"
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function starts the DWT cycle counter, it may be called
+ * more than once.
+ * Parameters: None.
+ * Returns: None.
+ */
+void CycleCounterInit(void)
+{
+    HWREG(CORE_DEMCR) |= CORE_DEMCR_TRCENA;
+    HWREG(DWT_CTRL) |= DWT_CTRL_CYCCNTENA;
+}
@@ -0,0 +1,53 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   cycle_counter.h                                              *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file for the Cortex-M4 DWT cycle counter used to      *
+ *                measure execution and idle times                             *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef CYCLE_COUNTER_H_
+#define CYCLE_COUNTER_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "inc/hw_types.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* Cortex-M4 debug registers used to count CPU cycles */
+#define CORE_DEMCR          0xE000EDFCU
+#define CORE_DEMCR_TRCENA   0x01000000U
+#define DWT_CTRL            0xE0001000U
+#define DWT_CTRL_CYCCNTENA  0x00000001U
+#define DWT_CYCCNT          0xE0001004U
+
+/* Reads the free running CPU cycle counter, it wraps around every
+ * 2^32 cycles (53 s at 80 MHz) so only differences are meaningful */
+#define CYCLE_COUNTER_GET() (HWREG(DWT_CYCCNT))
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function starts the DWT cycle counter, it may be called
+ * more than once.
+ * Parameters: None.
+ * Returns: None.
+ */
+void CycleCounterInit(void);
+
+#endif /* CYCLE_COUNTER_H_ */
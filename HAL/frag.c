@@ -0,0 +1,541 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   frag.c                                                       *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the fragmentation layer carrying messages    *
+ *                of any length over the network layer                         *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <string.h>
+#include "HAL/frag.h"
+#include "HAL/timebase.h"
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Structure holding the receive state of a source.
+ *              - address   : The address of the board, NET_NO_ADDRESS if free.
+ *              - number    : The number of the next fragment expected.
+ *              - inMessage : A message is being received.
+ *              - length    : The length of the message so far.
+ *              - sentUs    : The time its first fragment was sent, on its clock.
+ *              - receivedUs: The time its first fragment was received.
+ */
+typedef struct
+{
+    uint8_t address;
+    uint8_t number;
+    bool inMessage;
+    uint32_t length;
+    uint32_t sentUs;
+    uint32_t receivedUs;
+} fragSource_t;
+
+/*******************************************************************************
+ *                            Global Variables                                 *
+ *******************************************************************************/
+/* Number of the next fragment sent */
+static uint8_t txNumber = FRAG_FIRST;
+
+/* The sources heard from, and the entry given to the next new one */
+static fragSource_t rxSources[FRAG_SOURCE_COUNT];
+static uint8_t rxNextSource = 0U;
+
+/* The boards receipts came from, and the entry given to the next new one */
+static fragTiming_t timings[FRAG_SOURCE_COUNT];
+static uint8_t nextTiming = 0U;
+
+/* The fragment header followed by its data, as handed to NetSend() */
+static uint8_t txPayload[NET_MAX_DATA];
+
+static fragStats_t fragStats;
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static uint8_t FragNextNumber(uint8_t number);
+static fragSource_t* FragFindSource(uint8_t address);
+static fragTiming_t* FragFindTiming(uint8_t address, bool create);
+static uint32_t FragNow(void);
+static void FragPut32(uint8_t *buffer, uint32_t value);
+static uint32_t FragGet32(const uint8_t *buffer);
+static void FragSendReceipt(uint8_t destination, const fragSource_t *source);
+static void FragTakeReceipt(const netPacket_t *packet);
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function gives the number following a fragment number, FRAG_FIRST
+ * is skipped so that it only ever marks the start of a message.
+ * Parameters: number -> The fragment number.
+ * Returns: The next fragment number.
+ */
+static uint8_t FragNextNumber(uint8_t number)
+{
+    uint8_t next = (uint8_t)(number + 1U);
+
+    if (next == FRAG_FIRST)
+    {
+        next++;
+    }
+
+    else
+    {
+
+    }
+
+    return next;
+}
+
+/*
+ * Description :
+ * This function finds the receive state of a source. A new source takes
+ * a free entry, else an entry not in a message, else the entries in turn.
+ * Parameters: address -> The address of the board.
+ * Returns: A pointer to the receive state.
+ */
+static fragSource_t* FragFindSource(uint8_t address)
+{
+    fragSource_t *source = NULL;
+    fragSource_t *idle = NULL;
+    uint8_t i;
+
+    for (i = 0U; (i < FRAG_SOURCE_COUNT) && (NULL == source); i++)
+    {
+        if (rxSources[i].address == address)
+        {
+            source = &rxSources[i];
+        }
+
+        else if ((NULL == idle) && ((rxSources[i].address == NET_NO_ADDRESS) || !rxSources[i].inMessage))
+        {
+            idle = &rxSources[i];
+        }
+
+        else
+        {
+
+        }
+    }
+
+    if (NULL != source)
+    {
+        /* Known source */
+    }
+
+    else
+    {
+        if (NULL != idle)
+        {
+            source = idle;
+        }
+
+        else
+        {
+            source = &rxSources[rxNextSource];
+            rxNextSource = (uint8_t)((rxNextSource + 1U) % FRAG_SOURCE_COUNT);
+        }
+
+        source->address = address;
+        source->number = FRAG_FIRST;
+        source->inMessage = false;
+        source->length = 0U;
+    }
+
+    return source;
+}
+
+/*
+ * Description :
+ * This function finds the timing of a board, a new board takes a free
+ * entry, else the entries in turn.
+ * Parameters: address -> The address of the board.
+ *             create  -> Give the board an entry if it has none.
+ * Returns: A pointer to the timing, NULL if the board has none and create is false.
+ */
+static fragTiming_t* FragFindTiming(uint8_t address, bool create)
+{
+    fragTiming_t *timing = NULL;
+    fragTiming_t *unused = NULL;
+    uint8_t i;
+
+    for (i = 0U; (i < FRAG_SOURCE_COUNT) && (NULL == timing); i++)
+    {
+        if (timings[i].address == address)
+        {
+            timing = &timings[i];
+        }
+
+        else if ((NULL == unused) && (timings[i].address == NET_NO_ADDRESS))
+        {
+            unused = &timings[i];
+        }
+
+        else
+        {
+
+        }
+    }
+
+    if ((NULL != timing) || !create)
+    {
+        /* Known board, or none wanted */
+    }
+
+    else
+    {
+        if (NULL != unused)
+        {
+            timing = unused;
+        }
+
+        else
+        {
+            timing = &timings[nextTiming];
+            nextTiming = (uint8_t)((nextTiming + 1U) % FRAG_SOURCE_COUNT);
+        }
+
+        (void)memset(timing, 0, sizeof(*timing));
+        timing->address = address;
+    }
+
+    return timing;
+}
+
+/*
+ * Description :
+ * This function returns the time the fragments are stamped with.
+ * Parameters: None.
+ * Returns: The low 32 bits of the timebase in microseconds.
+ */
+static uint32_t FragNow(void)
+{
+    return (uint32_t)TimebaseGetUs();
+}
+
+/*
+ * Description :
+ * This function stores a 32-bit value in a payload, most significant byte first.
+ * Parameters: buffer -> The first of the 4 payload bytes.
+ *             value  -> The value to be stored.
+ * Returns: None.
+ */
+static void FragPut32(uint8_t *buffer, uint32_t value)
+{
+    buffer[0] = (uint8_t)(value >> 24);
+    buffer[1] = (uint8_t)(value >> 16);
+    buffer[2] = (uint8_t)(value >> 8);
+    buffer[3] = (uint8_t)value;
+}
+
+/*
+ * Description :
+ * This function reads a 32-bit value from a payload, most significant byte first.
+ * Parameters: buffer -> The first of the 4 payload bytes.
+ * Returns: The value.
+ */
+static uint32_t FragGet32(const uint8_t *buffer)
+{
+    return ((uint32_t)buffer[0] << 24) | ((uint32_t)buffer[1] << 16) | ((uint32_t)buffer[2] << 8) | (uint32_t)buffer[3];
+}
+
+/*
+ * Description :
+ * This function answers a message with a receipt, it is dropped when the
+ * send window is full as the message itself was delivered.
+ * Parameters: destination -> The board that sent the message.
+ *             source      -> Its receive state, with the times of the first fragment.
+ * Returns: None.
+ */
+static void FragSendReceipt(uint8_t destination, const fragSource_t *source)
+{
+    uint8_t receipt[FRAG_RECEIPT_LENGTH];
+
+    FragPut32(&receipt[0], source->sentUs);
+    FragPut32(&receipt[4], source->receivedUs);
+    FragPut32(&receipt[8], FragNow());
+
+    if (NetSend(destination, (uint8_t)LINK_FRAME_RECEIPT, receipt, (uint8_t)FRAG_RECEIPT_LENGTH))
+    {
+        fragStats.receiptsSent++;
+    }
+
+    else
+    {
+        fragStats.receiptDrops++;
+    }
+}
+
+/*
+ * Description :
+ * This function takes the receipt of a message sent by this board: the
+ * round trip time leaves out the time the receiver held the message, and
+ * the offset of its clock is the one putting the middle of the round trip
+ * at the middle of that time.
+ * Parameters: packet -> The receipt packet.
+ * Returns: None.
+ */
+static void FragTakeReceipt(const netPacket_t *packet)
+{
+    uint32_t now = FragNow();
+    uint32_t sent = FragGet32(&packet->data[0]);
+    uint32_t received = FragGet32(&packet->data[4]);
+    uint32_t replied = FragGet32(&packet->data[8]);
+    uint32_t rtt = (now - sent) - (replied - received);
+    fragTiming_t *timing = FragFindTiming(packet->source, true);
+
+    timing->rttUs = rtt;
+    timing->offsetUs = (received - sent) - (rtt / 2U);
+    timing->minRttUs = ((timing->receipts == 0U) || (rtt < timing->minRttUs)) ? rtt : timing->minRttUs;
+    timing->maxRttUs = (rtt > timing->maxRttUs) ? rtt : timing->maxRttUs;
+    timing->receipts++;
+    fragStats.receiptsReceived++;
+}
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function resets the fragment numbers and the counters.
+ * Parameters: None.
+ * Returns: None.
+ */
+void FragInit(void)
+{
+    txNumber = FRAG_FIRST;
+    (void)memset(rxSources, 0, sizeof(rxSources));
+    rxNextSource = 0U;
+    (void)memset(timings, 0, sizeof(timings));
+    nextTiming = 0U;
+    (void)memset(&fragStats, 0, sizeof(fragStats));
+}
+
+/*
+ * Description :
+ * This function sends the next fragment of the current message, the
+ * fragment following a last one starts a new message.
+ * Parameters: destination -> A node address or NET_BROADCAST, the same for
+ *                            every fragment of a message.
+ *             data        -> The fragment data, may be NULL when length is 0.
+ *             length      -> The number of data bytes, up to FRAG_MAX_DATA.
+ *             last        -> The fragment ends the message.
+ * Returns: true if the fragment was accepted, false if no port is up or a
+ *          send window is full.
+ */
+bool FragSend(uint8_t destination, const uint8_t *data, uint8_t length, bool last)
+{
+    bool accepted = false;
+
+    if ((length <= FRAG_MAX_DATA) && ((NULL != data) || (length == 0U)))
+    {
+        txPayload[0] = txNumber;
+        FragPut32(&txPayload[1], FragNow());
+
+        if (length != 0U)
+        {
+            (void)memcpy(&txPayload[FRAG_HEADER_LENGTH], data, length);
+        }
+
+        else
+        {
+
+        }
+
+        accepted = NetSend(destination, last ? (uint8_t)LINK_FRAME_FRAGMENT_END : (uint8_t)LINK_FRAME_FRAGMENT,
+                           txPayload, (uint8_t)(length + FRAG_HEADER_LENGTH));
+    }
+
+    else
+    {
+
+    }
+
+    if (accepted)
+    {
+        fragStats.fragmentsSent++;
+
+        if (last)
+        {
+            fragStats.messagesSent++;
+            txNumber = FRAG_FIRST;
+        }
+
+        else
+        {
+            txNumber = FragNextNumber(txNumber);
+        }
+    }
+
+    else
+    {
+
+    }
+
+    return accepted;
+}
+
+/*
+ * Description :
+ * This function takes a packet delivered by the network layer and
+ * describes the fragment it carries.
+ * Parameters: packet -> The packet returned by NetPoll().
+ *             piece  -> A pointer to the structure where the fragment will be described.
+ * Returns: true if the packet carries a fragment, false for another type.
+ */
+bool FragReceive(const netPacket_t *packet, fragPiece_t *piece)
+{
+    bool fragment = (NULL != packet) && (NULL != piece) && (packet->length >= FRAG_HEADER_LENGTH) &&
+                    ((packet->type == (uint8_t)LINK_FRAME_FRAGMENT) || (packet->type == (uint8_t)LINK_FRAME_FRAGMENT_END));
+
+    if (fragment)
+    {
+        fragSource_t *source = FragFindSource(packet->source);
+        const fragTiming_t *timing = FragFindTiming(packet->source, false);
+        uint8_t number = packet->data[0];
+
+        piece->source = packet->source;
+        piece->data = &packet->data[FRAG_HEADER_LENGTH];
+        piece->length = (uint8_t)(packet->length - FRAG_HEADER_LENGTH);
+        piece->last = (packet->type == (uint8_t)LINK_FRAME_FRAGMENT_END);
+        piece->first = (number == FRAG_FIRST) || !source->inMessage;
+        piece->sentUs = FragGet32(&packet->data[1]);
+        piece->receivedUs = FragNow();
+
+        /* The sender's time on this board's clock is its own minus the offset */
+        piece->timed = (NULL != timing) && (timing->receipts != 0U);
+        piece->oneWayUs = piece->timed ? (int32_t)(piece->receivedUs - (piece->sentUs - timing->offsetUs)) : 0;
+
+        /* A new message while one is open, or a gap in the numbers */
+        piece->broken = (source->inMessage && (number == FRAG_FIRST)) || (number != source->number);
+
+        if (piece->first)
+        {
+            source->length = 0U;
+            source->sentUs = piece->sentUs;
+            source->receivedUs = piece->receivedUs;
+        }
+
+        else
+        {
+
+        }
+
+        if (piece->broken)
+        {
+            fragStats.brokenMessages++;
+        }
+
+        else
+        {
+
+        }
+
+        source->length += piece->length;
+        fragStats.fragmentsReceived++;
+
+        if (piece->last)
+        {
+            fragStats.messagesReceived++;
+
+            if (source->length > fragStats.largestMessage)
+            {
+                fragStats.largestMessage = source->length;
+            }
+
+            else
+            {
+
+            }
+
+            source->inMessage = false;
+            source->number = FRAG_FIRST;
+
+            if (packet->destination != NET_BROADCAST)
+            {
+                FragSendReceipt(packet->source, source);
+            }
+
+            else
+            {
+
+            }
+        }
+
+        else
+        {
+            source->inMessage = true;
+            source->number = FragNextNumber(number);
+        }
+    }
+
+    else if ((NULL != packet) && (packet->type == (uint8_t)LINK_FRAME_RECEIPT) && (packet->length == FRAG_RECEIPT_LENGTH))
+    {
+        FragTakeReceipt(packet);
+    }
+
+    else
+    {
+
+    }
+
+    return fragment;
+}
+
+/*
+ * Description :
+ * This function copies the fragmentation counters.
+ * Parameters: stats -> A pointer to the structure where the counters will be stored.
+ * Returns: None.
+ */
+void FragGetStats(fragStats_t *stats)
+{
+    if (NULL != stats)
+    {
+        *stats = fragStats;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function describes the timing of the messages sent to a board.
+ * Parameters: address -> The address of the board.
+ *             timing  -> A pointer to the structure where the timing will be stored.
+ * Returns: true if a receipt was received from the board.
+ */
+bool FragGetTiming(uint8_t address, fragTiming_t *timing)
+{
+    const fragTiming_t *entry = FragFindTiming(address, false);
+    bool found = (NULL != entry) && (entry->receipts != 0U) && (NULL != timing);
+
+    if (found)
+    {
+        *timing = *entry;
+    }
+
+    else
+    {
+
+    }
+
+    return found;
+}
@@ -0,0 +1,196 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   frag.h                                                       *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file for the fragmentation layer carrying messages    *
+ *                of any length over the network layer                         *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef FRAG_H_
+#define FRAG_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "HAL/net.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/*
+ * A message is cut into fragments, each one sent in a network packet of
+ * type LINK_FRAME_FRAGMENT and the last one of type LINK_FRAME_FRAGMENT_END:
+ *   NUMBER | SENT (4 bytes) | DATA (up to FRAG_MAX_DATA bytes)
+ * NUMBER is 0 for the first fragment of a message, then counts from 1 to
+ * 255 and wraps back to 1. The reliable delivery layer keeps the fragments
+ * of a source in order, so the receiver rebuilds the message by handing on
+ * every fragment as it arrives: it never holds more than one frame, whatever
+ * the message length. The numbers only reveal a message cut short, for
+ * example when the sender gave up on it.
+ * SENT is the time the fragment was sent, the low 32 bits of the sender's
+ * timebase in microseconds, most significant byte first. The board a
+ * message was sent to (not a broadcast) answers its last fragment with a
+ * LINK_FRAME_RECEIPT packet:
+ *   SENT (4 bytes) | RECEIVED (4 bytes) | REPLIED (4 bytes)
+ * the time the first fragment was sent, on the sender's clock, then the
+ * times it was received and the receipt sent, on the receiver's clock.
+ * With the time the receipt arrives the sender gets the round trip time,
+ * less the time the receiver held the message, and the offset of the
+ * receiver's clock, assuming both directions take the same time. The
+ * offset then gives the one-way time of the fragments received from that
+ * board, and orders the events of both boards on one clock.
+ */
+#define FRAG_HEADER_LENGTH 5U
+#define FRAG_MAX_DATA (NET_MAX_DATA - FRAG_HEADER_LENGTH)
+#define FRAG_RECEIPT_LENGTH 12U
+
+/* Boards whose messages may be received interleaved, the fragment numbers
+ * are followed for each of them */
+#define FRAG_SOURCE_COUNT 4U
+
+/* Fragment number of the first fragment of a message */
+#define FRAG_FIRST 0U
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Structure describing a received fragment.
+ *              - source : The address of the board that sent it.
+ *              - data   : The fragment data, valid until the next NetPoll() call.
+ *              - length : The number of data bytes, may be 0 for a last fragment.
+ *              - first  : The fragment starts a message.
+ *              - last   : The fragment ends the message.
+ *              - broken : The previous message was cut short, or fragments
+ *                         of this one are missing.
+ *              - sentUs     : The time it was sent, on the sender's clock.
+ *              - receivedUs : The time it was received, on this board's clock.
+ *              - timed      : The offset of the sender's clock is known, from
+ *                             the receipt of a message sent to it.
+ *              - oneWayUs   : The time it took, valid when timed.
+ */
+typedef struct
+{
+    uint8_t source;
+    const uint8_t *data;
+    uint8_t length;
+    bool first;
+    bool last;
+    bool broken;
+    uint32_t sentUs;
+    uint32_t receivedUs;
+    bool timed;
+    int32_t oneWayUs;
+} fragPiece_t;
+
+/*
+ * Description: Structure describing the timing of the messages sent to a
+ *              board, from their receipts.
+ *              - address  : The address of the board.
+ *              - receipts : The receipts received from it.
+ *              - rttUs    : The round trip time of the last receipt, less the
+ *                           time the board held the message.
+ *              - minRttUs, maxRttUs : The shortest and longest round trip times.
+ *              - offsetUs : Its clock minus this board's clock, from the last
+ *                           receipt, modulo 2^32.
+ */
+typedef struct
+{
+    uint8_t address;
+    uint32_t receipts;
+    uint32_t rttUs;
+    uint32_t minRttUs;
+    uint32_t maxRttUs;
+    uint32_t offsetUs;
+} fragTiming_t;
+
+/*
+ * Description: Structure holding the fragmentation counters.
+ *              - messagesSent      : Messages whose last fragment was sent.
+ *              - fragmentsSent     : Fragments handed to the reliable delivery layer.
+ *              - messagesReceived  : Messages whose last fragment was received.
+ *              - fragmentsReceived : Fragments received.
+ *              - brokenMessages    : Messages received cut short or with missing fragments.
+ *              - largestMessage    : Bytes of the longest message received.
+ *              - receiptsSent      : Receipts sent for the messages received.
+ *              - receiptsReceived  : Receipts received for the messages sent.
+ *              - receiptDrops      : Receipts not sent, the send window being full.
+ */
+typedef struct
+{
+    uint32_t messagesSent;
+    uint32_t fragmentsSent;
+    uint32_t messagesReceived;
+    uint32_t fragmentsReceived;
+    uint32_t brokenMessages;
+    uint32_t largestMessage;
+    uint32_t receiptsSent;
+    uint32_t receiptsReceived;
+    uint32_t receiptDrops;
+} fragStats_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function resets the fragment numbers and the counters.
+ * Parameters: None.
+ * Returns: None.
+ */
+void FragInit(void);
+
+/*
+ * Description :
+ * This function sends the next fragment of the current message, the
+ * fragment following a last one starts a new message.
+ * Parameters: destination -> A node address or NET_BROADCAST, the same for
+ *                            every fragment of a message.
+ *             data        -> The fragment data, may be NULL when length is 0.
+ *             length      -> The number of data bytes, up to FRAG_MAX_DATA.
+ *             last        -> The fragment ends the message.
+ * Returns: true if the fragment was accepted, false if no port is up or a
+ *          send window is full.
+ */
+bool FragSend(uint8_t destination, const uint8_t *data, uint8_t length, bool last);
+
+/*
+ * Description :
+ * This function takes a packet delivered by the network layer and
+ * describes the fragment it carries. It answers the last fragment of a
+ * message sent to this board with a receipt, and takes the receipts of
+ * the messages sent by this board.
+ * Parameters: packet -> The packet returned by NetPoll().
+ *             piece  -> A pointer to the structure where the fragment will be described.
+ * Returns: true if the packet carries a fragment, false for another type.
+ */
+bool FragReceive(const netPacket_t *packet, fragPiece_t *piece);
+
+/*
+ * Description :
+ * This function describes the timing of the messages sent to a board.
+ * Parameters: address -> The address of the board.
+ *             timing  -> A pointer to the structure where the timing will be stored.
+ * Returns: true if a receipt was received from the board.
+ */
+bool FragGetTiming(uint8_t address, fragTiming_t *timing);
+
+/*
+ * Description :
+ * This function copies the fragmentation counters.
+ * Parameters: stats -> A pointer to the structure where the counters will be stored.
+ * Returns: None.
+ */
+void FragGetStats(fragStats_t *stats);
+
+#endif /* FRAG_H_ */
@@ -0,0 +1,418 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   link.c                                                       *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the framed link layer used between           *
+ *                neighbouring boards over UART1 and UART3                     *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include "HAL/link.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* Encoded bytes gathered before being handed to UARTWrite() */
+#define LINK_TX_CHUNK_SIZE 32U
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Enumeration representing the frame receiver states.
+ *              - LINK_RX_HUNT      : Waiting for a FLAG.
+ *              - LINK_RX_LENGTH    : Waiting for the length byte.
+ *              - LINK_RX_TYPE      : Waiting for the type byte.
+ *              - LINK_RX_SEQ       : Waiting for the sequence byte.
+ *              - LINK_RX_ACK       : Waiting for the acknowledgement byte.
+ *              - LINK_RX_PAYLOAD   : Collecting the payload bytes.
+ *              - LINK_RX_CRC_HIGH  : Waiting for the upper CRC byte.
+ *              - LINK_RX_CRC_LOW   : Waiting for the lower CRC byte.
+ */
+typedef enum
+{
+    LINK_RX_HUNT = 0U,
+    LINK_RX_LENGTH,
+    LINK_RX_TYPE,
+    LINK_RX_SEQ,
+    LINK_RX_ACK,
+    LINK_RX_PAYLOAD,
+    LINK_RX_CRC_HIGH,
+    LINK_RX_CRC_LOW
+} linkRxState_t;
+
+/*
+ * Description: Structure holding the state of a link port.
+ *              - base          : The UART module of the port.
+ *              - rxFrame       : The frame being received.
+ *              - rxState       : The frame receiver state.
+ *              - rxEscaped     : The next byte follows an ESCAPE.
+ *              - rxIndex       : The payload bytes received so far.
+ *              - rxCrc         : The CRC of the bytes received so far.
+ *              - rxReceivedCrc : The CRC sent with the frame.
+ *              - txChunk       : Encoded bytes gathered before UARTWrite().
+ *              - txChunkLength : The number of bytes in txChunk.
+ *              - stats         : The link counters of the port.
+ */
+typedef struct
+{
+    uint32_t base;
+    linkFrame_t rxFrame;
+    linkRxState_t rxState;
+    bool rxEscaped;
+    uint16_t rxIndex;
+    uint16_t rxCrc;
+    uint16_t rxReceivedCrc;
+    uint8_t txChunk[LINK_TX_CHUNK_SIZE];
+    uint8_t txChunkLength;
+    linkStats_t stats;
+} linkPort_t;
+
+/*******************************************************************************
+ *                            Global Variables                                 *
+ *******************************************************************************/
+static linkPort_t linkPorts[LINK_PORT_COUNT] = {
+                { .base = (uint32_t)UART1_MODULE , .rxState = LINK_RX_HUNT }
+#if (UART3_LINK_MODE == 1U)
+                ,
+                { .base = (uint32_t)UART3_MODULE , .rxState = LINK_RX_HUNT }
+#endif
+};
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static const linkFrame_t* LinkRxByte(linkPort_t *link, uint8_t byte);
+static void LinkTxRaw(linkPort_t *link, uint8_t byte);
+static void LinkTxEscaped(linkPort_t *link, uint8_t byte);
+static void LinkTxFlush(linkPort_t *link);
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function runs the frame receiver of a port on one byte from the wire.
+ * Parameters: link -> The link port.
+ *             byte -> The byte received on its UART.
+ * Returns: A pointer to the received frame when this byte completes a
+ *          frame with a valid CRC, NULL otherwise.
+ */
+static const linkFrame_t* LinkRxByte(linkPort_t *link, uint8_t byte)
+{
+    const linkFrame_t *frame = NULL;
+
+    if (byte == LINK_FLAG)
+    {
+        /* A FLAG always starts a new frame, even in the middle of another one */
+        if ((link->rxState != LINK_RX_HUNT) && (link->rxState != LINK_RX_LENGTH))
+        {
+            link->stats.syncErrors++;
+        }
+
+        else
+        {
+
+        }
+
+        link->rxState = LINK_RX_LENGTH;
+        link->rxEscaped = false;
+        link->rxCrc = CRC16_INIT;
+    }
+
+    else if ((link->rxState == LINK_RX_HUNT) || (byte == LINK_ESCAPE))
+    {
+        /* Bytes outside a frame are noise, an ESCAPE modifies the next byte */
+        link->rxEscaped = (link->rxState != LINK_RX_HUNT);
+    }
+
+    else
+    {
+        if (link->rxEscaped)
+        {
+            byte ^= LINK_ESCAPE_XOR;
+            link->rxEscaped = false;
+        }
+
+        else
+        {
+
+        }
+
+        switch (link->rxState)
+        {
+        case LINK_RX_LENGTH :
+            link->rxFrame.length = byte;
+            link->rxCrc = CRC16UpdateByte(link->rxCrc, byte);
+            link->rxState = LINK_RX_TYPE;
+            break;
+        case LINK_RX_TYPE :
+            link->rxFrame.type = byte;
+            link->rxCrc = CRC16UpdateByte(link->rxCrc, byte);
+            link->rxState = LINK_RX_SEQ;
+            break;
+        case LINK_RX_SEQ :
+            link->rxFrame.seq = byte;
+            link->rxCrc = CRC16UpdateByte(link->rxCrc, byte);
+            link->rxState = LINK_RX_ACK;
+            break;
+        case LINK_RX_ACK :
+            link->rxFrame.ack = byte;
+            link->rxCrc = CRC16UpdateByte(link->rxCrc, byte);
+            link->rxIndex = 0U;
+            link->rxState = (link->rxFrame.length == 0U) ? LINK_RX_CRC_HIGH : LINK_RX_PAYLOAD;
+            break;
+        case LINK_RX_PAYLOAD :
+            link->rxFrame.payload[link->rxIndex] = byte;
+            link->rxIndex++;
+            link->rxCrc = CRC16UpdateByte(link->rxCrc, byte);
+            if (link->rxIndex == (uint16_t)link->rxFrame.length)
+            {
+                link->rxState = LINK_RX_CRC_HIGH;
+            }
+            break;
+        case LINK_RX_CRC_HIGH :
+            link->rxReceivedCrc = (uint16_t)((uint16_t)byte << 8);
+            link->rxState = LINK_RX_CRC_LOW;
+            break;
+        case LINK_RX_CRC_LOW :
+            link->rxReceivedCrc |= (uint16_t)byte;
+            if (link->rxReceivedCrc == link->rxCrc)
+            {
+                link->stats.framesReceived++;
+                frame = &link->rxFrame;
+            }
+            else
+            {
+                link->stats.crcErrors++;
+            }
+            link->rxState = LINK_RX_HUNT;
+            break;
+        default :
+            link->rxState = LINK_RX_HUNT;
+            break;
+        }
+    }
+
+    return frame;
+}
+
+/*
+ * Description :
+ * This function adds one byte to the encoded chunk of a port as it is.
+ * Parameters: link -> The link port.
+ *             byte -> The byte to be sent.
+ * Returns: None.
+ */
+static void LinkTxRaw(linkPort_t *link, uint8_t byte)
+{
+    if (link->txChunkLength == LINK_TX_CHUNK_SIZE)
+    {
+        LinkTxFlush(link);
+    }
+
+    else
+    {
+
+    }
+
+    link->txChunk[link->txChunkLength] = byte;
+    link->txChunkLength++;
+}
+
+/*
+ * Description :
+ * This function adds one byte to the encoded chunk of a port, escaping
+ * it if it could be mistaken for a FLAG or an ESCAPE.
+ * Parameters: link -> The link port.
+ *             byte -> The byte to be sent.
+ * Returns: None.
+ */
+static void LinkTxEscaped(linkPort_t *link, uint8_t byte)
+{
+    if ((byte == LINK_FLAG) || (byte == LINK_ESCAPE))
+    {
+        LinkTxRaw(link, LINK_ESCAPE);
+        LinkTxRaw(link, byte ^ LINK_ESCAPE_XOR);
+    }
+
+    else
+    {
+        LinkTxRaw(link, byte);
+    }
+}
+
+/*
+ * Description :
+ * This function queues the encoded chunk of a port on its UART.
+ * Parameters: link -> The link port.
+ * Returns: None.
+ */
+static void LinkTxFlush(linkPort_t *link)
+{
+    (void)UARTWrite(link->base, link->txChunk, (uint16_t)link->txChunkLength);
+    link->txChunkLength = 0U;
+}
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function resets the frame receivers and the link counters of
+ * every port.
+ * Parameters: None.
+ * Returns: None.
+ */
+void LinkInit(void)
+{
+    uint8_t port;
+
+    for (port = 0U; port < LINK_PORT_COUNT; port++)
+    {
+        linkPort_t *link = &linkPorts[port];
+
+        link->rxState = LINK_RX_HUNT;
+        link->rxEscaped = false;
+        link->txChunkLength = 0U;
+        (void)memset(&link->stats, 0, sizeof(link->stats));
+    }
+}
+
+/*
+ * Description :
+ * This function builds a frame and queues it on the UART of a port without
+ * blocking, the frame is either queued whole or not at all.
+ * Parameters: port    -> The link port (LINK_PORT_xxx).
+ *             type    -> The frame type (linkFrameType_t).
+ *             seq     -> The sequence number of the frame.
+ *             ack     -> The acknowledgement number of the frame.
+ *             payload -> The payload bytes, may be NULL when length is 0.
+ *             length  -> The number of payload bytes.
+ * Returns: true if the frame was queued, false if the UART had no room for it.
+ */
+bool LinkSend(uint8_t port, uint8_t type, uint8_t seq, uint8_t ack, const uint8_t *payload, uint8_t length)
+{
+    bool sent = false;
+
+    if ((port >= LINK_PORT_COUNT) || ((NULL == payload) && (length != 0U)))
+    {
+        /* Nothing to send */
+    }
+
+    /* Only start a frame that is sure to fit, so frames are never cut */
+    else if ((uint32_t)UARTTxFree(linkPorts[port].base) < LINK_MAX_WIRE_SIZE(length))
+    {
+        linkPorts[port].stats.txBackpressure++;
+    }
+
+    else
+    {
+        linkPort_t *link = &linkPorts[port];
+        uint16_t crc = CRC16_INIT;
+        uint16_t i;
+
+        crc = CRC16UpdateByte(crc, length);
+        crc = CRC16UpdateByte(crc, type);
+        crc = CRC16UpdateByte(crc, seq);
+        crc = CRC16UpdateByte(crc, ack);
+        crc = CRC16Update(crc, payload, (uint32_t)length);
+
+        LinkTxRaw(link, LINK_FLAG);
+        LinkTxEscaped(link, length);
+        LinkTxEscaped(link, type);
+        LinkTxEscaped(link, seq);
+        LinkTxEscaped(link, ack);
+
+        for (i = 0U; i < (uint16_t)length; i++)
+        {
+            LinkTxEscaped(link, payload[i]);
+        }
+
+        LinkTxEscaped(link, (uint8_t)(crc >> 8));
+        LinkTxEscaped(link, (uint8_t)crc);
+        LinkTxFlush(link);
+
+        link->stats.framesSent++;
+        sent = true;
+    }
+
+    return sent;
+}
+
+/*
+ * Description :
+ * This function feeds the bytes received on the UART of a port to its
+ * frame receiver until a complete frame with a valid CRC is found.
+ * Parameters: port -> The link port (LINK_PORT_xxx).
+ * Returns: A pointer to the received frame, valid until the next call
+ *          for the same port, or NULL if no complete frame is available yet.
+ */
+const linkFrame_t* LinkPoll(uint8_t port)
+{
+    const linkFrame_t *frame = NULL;
+    uint8_t byte;
+
+    while ((port < LINK_PORT_COUNT) && (NULL == frame) && UARTReceive(linkPorts[port].base, &byte))
+    {
+        frame = LinkRxByte(&linkPorts[port], byte);
+    }
+
+    return frame;
+}
+
+/*
+ * Description :
+ * This function copies the link layer counters of a port.
+ * Parameters: port  -> The link port (LINK_PORT_xxx).
+ *             stats -> A pointer to the structure where the counters will be stored.
+ * Returns: None.
+ */
+void LinkGetStats(uint8_t port, linkStats_t *stats)
+{
+    if ((port < LINK_PORT_COUNT) && (NULL != stats))
+    {
+        *stats = linkPorts[port].stats;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function sets the addresses of a port on an RS-485 bus, its
+ * frames are then only received by the board they are addressed to.
+ * Parameters: port    -> The link port (LINK_PORT_xxx).
+ *             address -> The address of this board on the bus.
+ *             peer    -> The address of the board the port talks to.
+ * Returns: true if the port is on a bus, false for a point-to-point port.
+ */
+bool LinkSetBusAddress(uint8_t port, uint8_t address, uint8_t peer)
+{
+    bool bus = false;
+
+    if (port < LINK_PORT_COUNT)
+    {
+        bus = UARTSetBusAddress(linkPorts[port].base, address, peer);
+    }
+
+    else
+    {
+
+    }
+
+    return bus;
+}
@@ -0,0 +1,214 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   link.h                                                       *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file for the framed link layer used between           *
+ *                neighbouring boards over UART1 and UART3                     *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef LINK_H_
+#define LINK_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "HAL/UART_API.h"
+#include "HAL/crc.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/*
+ * Frame layout on the wire:
+ *   FLAG | LENGTH | TYPE | SEQ | ACK | PAYLOAD (LENGTH bytes) | CRC high | CRC low
+ * The CRC-16 covers LENGTH up to the end of the payload. Every byte after
+ * FLAG that equals LINK_FLAG or LINK_ESCAPE is sent as LINK_ESCAPE followed
+ * by the byte XORed with LINK_ESCAPE_XOR, so a FLAG on the wire always
+ * starts a new frame and the payload may carry any byte value.
+ */
+#define LINK_FLAG       0x7EU
+#define LINK_ESCAPE     0x7DU
+#define LINK_ESCAPE_XOR 0x20U
+
+/* Link ports, each one a UART wired to a neighbouring board: UART1 to the
+ * other board of the pair, and UART3 to chain a further board when
+ * UART3_LINK_MODE is set (see net.h) */
+#define LINK_PORT_UART1 0U
+#if (UART3_LINK_MODE == 1U)
+#define LINK_PORT_UART3 1U
+#define LINK_PORT_COUNT 2U
+#else
+#define LINK_PORT_COUNT 1U
+#endif
+
+/* Set in the type of a data frame whose payload is compressed (see arq.h) */
+#define LINK_FRAME_COMPRESSED 0x40U
+
+/* Largest payload of one frame, the length field is a single byte */
+#define LINK_MAX_PAYLOAD 255U
+
+/* Bytes of a frame besides the payload: FLAG, LENGTH, TYPE, SEQ, ACK and the CRC */
+#define LINK_FRAME_OVERHEAD 7U
+
+/* Worst case wire size of a frame, when every byte but FLAG is escaped */
+#define LINK_MAX_WIRE_SIZE(length) (1U + (2U * ((LINK_FRAME_OVERHEAD - 1U) + (uint32_t)(length))))
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Enumeration representing the frame types.
+ *              - LINK_FRAME_ACK          : An acknowledgement without payload.
+ *              - LINK_FRAME_BENCH        : A benchmark message, all but its last frame.
+ *              - LINK_FRAME_BENCH_END    : The last frame of a benchmark message.
+ *              - LINK_FRAME_BENCH_REPLY  : The answer to a benchmark message, its
+ *                                          payload is the last byte of the message.
+ *              - LINK_FRAME_FRAGMENT     : A fragment of a chat message (see frag.h).
+ *              - LINK_FRAME_FRAGMENT_END : The last fragment of a chat message.
+ *              - LINK_FRAME_FILE         : A block of a file (see xfer.h).
+ *              - LINK_FRAME_FILE_END     : The end of a file, its length and CRC.
+ *              - LINK_FRAME_NET          : A network packet, carrying one of the
+ *                                          types above between any two boards (see net.h).
+ *              - LINK_FRAME_ANNOUNCE     : A board telling the others it is there, only
+ *                                          ever carried in a network packet.
+ *              - LINK_FRAME_RECEIPT      : The times a chat message was sent, received
+ *                                          and answered (see frag.h).
+ *              Types from LINK_FRAME_CONTROL up are control frames: they are
+ *              neither sequenced nor acknowledged by the reliable delivery layer.
+ *              - LINK_FRAME_BAUD_PROPOSE   : Asks to try a new UART1 baud rate.
+ *              - LINK_FRAME_BAUD_ACCEPT    : Agrees to try the proposed baud rate.
+ *              - LINK_FRAME_BAUD_PROBE     : Test pattern sent at the new baud rate.
+ *              - LINK_FRAME_BAUD_RESULT    : How many test patterns arrived intact.
+ *              - LINK_FRAME_BAUD_CONFIRM   : Keeps the new baud rate.
+ *              - LINK_FRAME_BAUD_STEP_DOWN : Moves to a lower baud rate at once.
+ *              - LINK_FRAME_PING_REQUEST   : A probe timing the link (see ping.h).
+ *              - LINK_FRAME_PING_REPLY     : The probe sent back unchanged.
+ *              - LINK_FRAME_ARQ_SYNC       : Starts a session of the reliable delivery
+ *                                            layer (see arq.h).
+ */
+typedef enum
+{
+    LINK_FRAME_ACK            = 2U,
+    LINK_FRAME_BENCH          = 3U,
+    LINK_FRAME_BENCH_END      = 4U,
+    LINK_FRAME_BENCH_REPLY    = 5U,
+    LINK_FRAME_FRAGMENT       = 6U,
+    LINK_FRAME_FRAGMENT_END   = 7U,
+    LINK_FRAME_FILE           = 8U,
+    LINK_FRAME_FILE_END       = 9U,
+    LINK_FRAME_NET            = 10U,
+    LINK_FRAME_ANNOUNCE       = 11U,
+    LINK_FRAME_RECEIPT        = 12U,
+    LINK_FRAME_CONTROL        = 0x80U,
+    LINK_FRAME_BAUD_PROPOSE   = 0x80U,
+    LINK_FRAME_BAUD_ACCEPT    = 0x81U,
+    LINK_FRAME_BAUD_PROBE     = 0x82U,
+    LINK_FRAME_BAUD_RESULT    = 0x83U,
+    LINK_FRAME_BAUD_CONFIRM   = 0x84U,
+    LINK_FRAME_BAUD_STEP_DOWN = 0x85U,
+    LINK_FRAME_PING_REQUEST   = 0x86U,
+    LINK_FRAME_PING_REPLY     = 0x87U,
+    LINK_FRAME_ARQ_SYNC       = 0x88U
+} linkFrameType_t;
+
+/*
+ * Description: Structure representing a received frame.
+ *              - type    : The frame type (linkFrameType_t).
+ *              - seq     : The sequence number given by the sender.
+ *              - ack     : The acknowledgement number given by the sender.
+ *              - length  : The number of payload bytes.
+ *              - payload : The payload bytes.
+ */
+typedef struct
+{
+    uint8_t type;
+    uint8_t seq;
+    uint8_t ack;
+    uint8_t length;
+    uint8_t payload[LINK_MAX_PAYLOAD];
+} linkFrame_t;
+
+/*
+ * Description: Structure holding the link layer counters.
+ *              - framesSent     : Frames queued on the UART.
+ *              - framesReceived : Frames received with a valid CRC.
+ *              - crcErrors      : Frames dropped because of a CRC mismatch.
+ *              - syncErrors     : Frames cut short by a new FLAG.
+ *              - txBackpressure : Frames refused because the UART had no room.
+ */
+typedef struct
+{
+    uint32_t framesSent;
+    uint32_t framesReceived;
+    uint32_t crcErrors;
+    uint32_t syncErrors;
+    uint32_t txBackpressure;
+} linkStats_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function resets the frame receivers and the link counters of
+ * every port.
+ * Parameters: None.
+ * Returns: None.
+ */
+void LinkInit(void);
+
+/*
+ * Description :
+ * This function builds a frame and queues it on the UART of a port without
+ * blocking, the frame is either queued whole or not at all.
+ * Parameters: port    -> The link port (LINK_PORT_xxx).
+ *             type    -> The frame type (linkFrameType_t).
+ *             seq     -> The sequence number of the frame.
+ *             ack     -> The acknowledgement number of the frame.
+ *             payload -> The payload bytes, may be NULL when length is 0.
+ *             length  -> The number of payload bytes.
+ * Returns: true if the frame was queued, false if the UART had no room for it.
+ */
+bool LinkSend(uint8_t port, uint8_t type, uint8_t seq, uint8_t ack, const uint8_t *payload, uint8_t length);
+
+/*
+ * Description :
+ * This function feeds the bytes received on the UART of a port to its
+ * frame receiver until a complete frame with a valid CRC is found.
+ * Parameters: port -> The link port (LINK_PORT_xxx).
+ * Returns: A pointer to the received frame, valid until the next call
+ *          for the same port, or NULL if no complete frame is available yet.
+ */
+const linkFrame_t* LinkPoll(uint8_t port);
+
+/*
+ * Description :
+ * This function copies the link layer counters of a port.
+ * Parameters: port  -> The link port (LINK_PORT_xxx).
+ *             stats -> A pointer to the structure where the counters will be stored.
+ * Returns: None.
+ */
+void LinkGetStats(uint8_t port, linkStats_t *stats);
+
+/*
+ * Description :
+ * This function sets the addresses of a port on an RS-485 bus, its
+ * frames are then only received by the board they are addressed to.
+ * Parameters: port    -> The link port (LINK_PORT_xxx).
+ *             address -> The address of this board on the bus.
+ *             peer    -> The address of the board the port talks to.
+ * Returns: true if the port is on a bus, false for a point-to-point port.
+ */
+bool LinkSetBusAddress(uint8_t port, uint8_t address, uint8_t peer);
+
+#endif /* LINK_H_ */
@@ -0,0 +1,277 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   log.c                                                        *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the log, writing the terminal messages as    *
+ *                text or as a message id and binary arguments                 *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include "HAL/log.h"
+#include "HAL/UART_API.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* Bytes of a LEB128 number of 32 bits at most */
+#define LOG_NUMBER_MAX_LENGTH 5U
+
+/*******************************************************************************
+ *                            Global Variables                                 *
+ *******************************************************************************/
+#if (LOG_MODE == 0U)
+/* The formats of the messages, in the order of their ids */
+static const char *const logFormats[LOG_COUNT] = {
+#define LOG_MESSAGE(id, format) format,
+#include "HAL/log_table.h"
+#undef LOG_MESSAGE
+};
+#endif
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+#if (LOG_MODE == 0U)
+static void LogText(const char *format, const uint32_t *args, uint8_t count);
+#else
+static uint8_t LogPutNumber(uint8_t *data, uint32_t value);
+#endif
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+#if (LOG_MODE == 0U)
+/*
+ * Description :
+ * This function writes a format on the terminal, its conversions filled
+ * in with the arguments, a missing argument reading 0.
+ * Parameters: format -> The format (see log_table.h).
+ *             args   -> The arguments.
+ *             count  -> The number of arguments.
+ * Returns: None.
+ */
+static void LogText(const char *format, const uint32_t *args, uint8_t count)
+{
+    const char *run = format;
+    uint8_t next = 0U;
+
+    while (*format != '\0')
+    {
+        if (*format == '%')
+        {
+            char conversion = format[1];
+            uint32_t value = (next < count) ? args[next] : 0U;
+
+            /* The text up to the conversion */
+            UARTWriteAll((uint32_t)UART0_MODULE, (const uint8_t *)run, (uint16_t)(format - run));
+
+            if (conversion == 'u')
+            {
+                UARTprintDecimal(value);
+                next++;
+            }
+
+            else if (conversion == 'd')
+            {
+                if ((int32_t)value < 0)
+                {
+                    UARTprint("-");
+                    value = (uint32_t)(-(int32_t)value);
+                }
+
+                else
+                {
+
+                }
+
+                UARTprintDecimal(value);
+                next++;
+            }
+
+            else if (conversion == 'h')
+            {
+                UARTprintDecimal(value / 100U);
+                UARTprint(((value % 100U) < 10U) ? ".0" : ".");
+                UARTprintDecimal(value % 100U);
+                next++;
+            }
+
+            /* %% and anything else is written as it stands */
+            else if (conversion != '\0')
+            {
+                UARTWriteAll((uint32_t)UART0_MODULE, (const uint8_t *)&format[1], 1U);
+            }
+
+            /* A lone % ends the format */
+            else
+            {
+
+            }
+
+            format += (conversion != '\0') ? 2 : 1;
+            run = format;
+        }
+
+        else
+        {
+            format++;
+        }
+    }
+
+    UARTWriteAll((uint32_t)UART0_MODULE, (const uint8_t *)run, (uint16_t)(format - run));
+}
+#else
+/*
+ * Description :
+ * This function stores a number in LEB128: 7 bits per byte, least
+ * significant first, the top bit set on every byte but the last.
+ * Parameters: data  -> Where the bytes are stored, LOG_NUMBER_MAX_LENGTH at most.
+ *             value -> The number.
+ * Returns: The number of bytes stored.
+ */
+static uint8_t LogPutNumber(uint8_t *data, uint32_t value)
+{
+    uint8_t length = 0U;
+
+    while (value >= 0x80U)
+    {
+        data[length] = (uint8_t)(value | 0x80U);
+        value >>= 7;
+        length++;
+    }
+
+    data[length] = (uint8_t)value;
+
+    return (uint8_t)(length + 1U);
+}
+#endif
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function starts the log, in binary mode it writes the number of
+ * messages of the table so the decoder can tell a table of another firmware.
+ * Parameters: None.
+ * Returns: None.
+ */
+void LogInit(void)
+{
+#if (LOG_MODE == 1U)
+    Log1(LOG_TABLE, (uint32_t)LOG_COUNT);
+#endif
+}
+
+/*
+ * Description :
+ * This function writes a message on UART0, waiting only while the
+ * transmit ring buffer is full.
+ * Parameters: id    -> The message (LOG_xxx).
+ *             args  -> Its arguments, in the order of its format.
+ *             count -> The number of arguments, up to LOG_MAX_ARGS.
+ * Returns: None.
+ */
+void LogWrite(logId_t id, const uint32_t *args, uint8_t count)
+{
+    if ((id < LOG_COUNT) && (count <= LOG_MAX_ARGS) && ((NULL != args) || (count == 0U)))
+    {
+#if (LOG_MODE == 0U)
+        LogText(logFormats[id], args, count);
+#else
+        uint8_t frame[2U + (LOG_MAX_ARGS * LOG_NUMBER_MAX_LENGTH)];
+        uint16_t length = 2U;
+        uint8_t i;
+
+        frame[0] = (uint8_t)LOG_FRAME_START;
+        frame[1] = (uint8_t)id;
+
+        for (i = 0U; i < count; i++)
+        {
+            length += LogPutNumber(&frame[length], args[i]);
+        }
+
+        UARTWriteAll((uint32_t)UART0_MODULE, frame, length);
+#endif
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function writes a message with no argument.
+ * Parameters: id -> The message (LOG_xxx).
+ * Returns: None.
+ */
+void Log0(logId_t id)
+{
+    LogWrite(id, NULL, 0U);
+}
+
+/*
+ * Description :
+ * This function writes a message with one argument.
+ * Parameters: id -> The message (LOG_xxx).
+ *             a  -> Its argument.
+ * Returns: None.
+ */
+void Log1(logId_t id, uint32_t a)
+{
+    LogWrite(id, &a, 1U);
+}
+
+/*
+ * Description :
+ * This function writes a message with two arguments.
+ * Parameters: id   -> The message (LOG_xxx).
+ *             a, b -> Its arguments, in the order of its format.
+ * Returns: None.
+ */
+void Log2(logId_t id, uint32_t a, uint32_t b)
+{
+    const uint32_t args[2] = { a , b };
+
+    LogWrite(id, args, 2U);
+}
+
+/*
+ * Description :
+ * This function writes a message with three arguments.
+ * Parameters: id      -> The message (LOG_xxx).
+ *             a, b, c -> Its arguments, in the order of its format.
+ * Returns: None.
+ */
+void Log3(logId_t id, uint32_t a, uint32_t b, uint32_t c)
+{
+    const uint32_t args[3] = { a , b , c };
+
+    LogWrite(id, args, 3U);
+}
+
+/*
+ * Description :
+ * This function writes a message with four arguments.
+ * Parameters: id         -> The message (LOG_xxx).
+ *             a, b, c, d -> Its arguments, in the order of its format.
+ * Returns: None.
+ */
+void Log4(logId_t id, uint32_t a, uint32_t b, uint32_t c, uint32_t d)
+{
+    const uint32_t args[4] = { a , b , c , d };
+
+    LogWrite(id, args, 4U);
+}
@@ -0,0 +1,132 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   log.h                                                        *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file for the log, writing the terminal messages as    *
+ *                text or as a message id and binary arguments                 *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef LOG_H_
+#define LOG_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* Log configuration:
+ * The fixed messages of the terminal (labels, reports, counters) are
+ * written with an id of the string table (log_table.h) and their numbers.
+ * LOG_MODE set to 0U writes them as text, the format filled in on the board.
+ * Set to 1U, the board only writes a frame on UART0:
+ *   LOG_FRAME_START | ID (1) | ARGUMENTS
+ * each argument as a LEB128 number (7 bits per byte, least significant
+ * first, the top bit set on every byte but the last), and the formats are
+ * left out of the firmware. tools/logdecode.py, reading the same table,
+ * turns the frames back into text and passes every other byte, the typed
+ * and received text, unchanged; a board built with 1U then needs it as its
+ * terminal. The host simulation build sets it from the command line. */
+#ifndef LOG_MODE
+#define LOG_MODE 0U
+#endif
+
+/* Starts a frame, the ASCII unit separator, which is not typed in a chat */
+#define LOG_FRAME_START 0x1FU
+
+/* Arguments a message takes at most */
+#define LOG_MAX_ARGS 8U
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Enum describing the messages, one per LOG_MESSAGE() of log_table.h.
+ */
+typedef enum
+{
+#define LOG_MESSAGE(id, format) id,
+#include "HAL/log_table.h"
+#undef LOG_MESSAGE
+    LOG_COUNT
+} logId_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function starts the log, in binary mode it writes the number of
+ * messages of the table so the decoder can tell a table of another firmware.
+ * Parameters: None.
+ * Returns: None.
+ */
+void LogInit(void);
+
+/*
+ * Description :
+ * This function writes a message on UART0, waiting only while the
+ * transmit ring buffer is full.
+ * Parameters: id    -> The message (LOG_xxx).
+ *             args  -> Its arguments, in the order of its format.
+ *             count -> The number of arguments, up to LOG_MAX_ARGS.
+ * Returns: None.
+ */
+void LogWrite(logId_t id, const uint32_t *args, uint8_t count);
+
+/*
+ * Description :
+ * This function writes a message with no argument.
+ * Parameters: id -> The message (LOG_xxx).
+ * Returns: None.
+ */
+void Log0(logId_t id);
+
+/*
+ * Description :
+ * This function writes a message with one argument.
+ * Parameters: id -> The message (LOG_xxx).
+ *             a  -> Its argument.
+ * Returns: None.
+ */
+void Log1(logId_t id, uint32_t a);
+
+/*
+ * Description :
+ * This function writes a message with two arguments.
+ * Parameters: id   -> The message (LOG_xxx).
+ *             a, b -> Its arguments, in the order of its format.
+ * Returns: None.
+ */
+void Log2(logId_t id, uint32_t a, uint32_t b);
+
+/*
+ * Description :
+ * This function writes a message with three arguments.
+ * Parameters: id      -> The message (LOG_xxx).
+ *             a, b, c -> Its arguments, in the order of its format.
+ * Returns: None.
+ */
+void Log3(logId_t id, uint32_t a, uint32_t b, uint32_t c);
+
+/*
+ * Description :
+ * This function writes a message with four arguments.
+ * Parameters: id         -> The message (LOG_xxx).
+ *             a, b, c, d -> Its arguments, in the order of its format.
+ * Returns: None.
+ */
+void Log4(logId_t id, uint32_t a, uint32_t b, uint32_t c, uint32_t d);
+
+#endif /* LOG_H_ */
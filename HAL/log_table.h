@@ -0,0 +1,54 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   log_table.h                                                  *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: string table of the log messages, read by log.h, log.c and   *
+ *                tools/logdecode.py                                           *
+ *                                                                             *
+ *******************************************************************************/
+
+/*
+ * One LOG_MESSAGE(id, format) per message, in the order of their ids. The
+ * file is read again for every definition of LOG_MESSAGE, so it has no
+ * include guard. A format holds text and conversions, each taking the next
+ * argument: %u an unsigned number, %d a signed one, %h a number in 1/100
+ * shown with two decimals (1205 as 12.05), and %% a percent sign.
+ * tools/logdecode.py reads this file to turn the binary log back into text:
+ * a message is only added at the end, so older captures still decode.
+ */
+LOG_MESSAGE(LOG_TABLE, "Log table of %u messages\n\r")
+LOG_MESSAGE(LOG_NODE, "Node %u\n\r")
+LOG_MESSAGE(LOG_TRACE_COST, "Trace %u cycles per event\n\r")
+LOG_MESSAGE(LOG_MESSAGE_RECEIVED, "Message Received from %u")
+LOG_MESSAGE(LOG_MESSEGE_RECEIVED, "Messege Received from %u")
+LOG_MESSAGE(LOG_RECEIVED_AT, " at %u us")
+LOG_MESSAGE(LOG_ONE_WAY, ", %d us one way")
+LOG_MESSAGE(LOG_LABEL_END, " : ")
+LOG_MESSAGE(LOG_LABEL_RESUMED, " : ...")
+LOG_MESSAGE(LOG_MESSAGE_SENT, "Message Sent : ")
+LOG_MESSAGE(LOG_MESSAGE_SENT_TO, "Message Sent to %u : ")
+LOG_MESSAGE(LOG_FILE_SENT, "\n\rFile Sent : %u bytes in %u ms, %u bytes/s, %h%% of UART1 (%u baud), %h%% of UART0 (%u baud), compressed to %h%%\n\r")
+LOG_MESSAGE(LOG_INPUT_LOST, "Input Lost : %u bytes\n\r")
+LOG_MESSAGE(LOG_PING_MODE, "Ping mode, s shows the counters, p the profile\n\r")
+LOG_MESSAGE(LOG_PING_REPLY, "Reply %u : %u us\n\r")
+LOG_MESSAGE(LOG_PING_LOST, "Probe %u : lost\n\r")
+LOG_MESSAGE(LOG_PING_SUMMARY, "Ping : %u sent, %u received, %u lost, %u late\n\r")
+LOG_MESSAGE(LOG_PING_RTT, "RTT min/avg/max/jitter (us) : %u/%u/%u/%u\n\r")
+LOG_MESSAGE(LOG_UART_BYTES, "UART%u rx/tx bytes : %u/%u\n\r")
+LOG_MESSAGE(LOG_UART_ERRORS, "  dropped/overrun/break/parity : %u/%u/%u/%u\n\r")
+LOG_MESSAGE(LOG_UART_FRAMING, "  framing : %u, rejected : %u\n\r")
+LOG_MESSAGE(LOG_LINK_FRAMES, "UART%u frames tx/rx/crc/sync : %u/%u/%u/%u\n\r")
+LOG_MESSAGE(LOG_ARQ_COUNTERS, "  retransmits/timeouts/duplicates/acks : %u/%u/%u/%u\n\r")
+LOG_MESSAGE(LOG_NET_PACKETS, "Packets tx/rx/forwarded/dropped : %u/%u/%u/%u\n\r")
+LOG_MESSAGE(LOG_CRC_COST, "CRC %h cycles per byte, %h%% of the CPU at %u baud\n\r")
+LOG_MESSAGE(LOG_ARQ_GOODPUT, "  goodput tx/rx bytes : %u/%u, session resets/frames dropped : %u/%u\n\r")
+LOG_MESSAGE(LOG_POWER_IDLE, "Idle : %u sleeps, %h%% of the time asleep\n\r")
+LOG_MESSAGE(LOG_POWER_WAKE, "  timer wakes : %u, wake-up min/avg/max (cycles) : %u/%u/%u\n\r")
+LOG_MESSAGE(LOG_FRAG_TIMING, "Messages to %u : %u receipts, RTT last/min/max (us) : %u/%u/%u, clock offset : %d us\n\r")
@@ -0,0 +1,388 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   lz.c                                                         *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the streaming LZ77 compressor used on the    *
+ *                link between the two boards                                  *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <string.h>
+#include "HAL/lz.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define LZ_WINDOW_MASK (LZ_WINDOW_SIZE - 1U)
+#define LZ_LENGTH_MASK ((1U << LZ_LENGTH_BITS) - 1U)
+
+/* Items described by one flag byte */
+#define LZ_GROUP_ITEMS 8U
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static void LzCopy(uint8_t *history, uint32_t position, const uint8_t *data, uint16_t length);
+static uint16_t LzHash(const lzEncoder_t *encoder, uint32_t position);
+static uint16_t LzMatchLength(const lzEncoder_t *encoder, uint32_t candidate, uint32_t position, uint16_t limit);
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function writes bytes into a history, wrapping around its end.
+ * Parameters: history  -> The history of an encoder or a decoder.
+ *             position -> The stream position of the first byte.
+ *             data     -> The bytes to be written.
+ *             length   -> The number of bytes, up to LZ_WINDOW_SIZE.
+ * Returns: None.
+ */
+static void LzCopy(uint8_t *history, uint32_t position, const uint8_t *data, uint16_t length)
+{
+    uint16_t index = (uint16_t)(position & LZ_WINDOW_MASK);
+    uint16_t first = (uint16_t)(LZ_WINDOW_SIZE - index);
+
+    if (first > length)
+    {
+        first = length;
+    }
+
+    else
+    {
+
+    }
+
+    (void)memcpy(&history[index], data, first);
+    (void)memcpy(history, &data[first], (size_t)(length - first));
+}
+
+/*
+ * Description :
+ * This function hashes the 3 bytes of the history at a position.
+ * Parameters: encoder  -> The encoder.
+ *             position -> The stream position, followed by 2 more bytes.
+ * Returns: The hash, below LZ_HASH_SIZE.
+ */
+static uint16_t LzHash(const lzEncoder_t *encoder, uint32_t position)
+{
+    uint32_t key = ((uint32_t)encoder->history[position & LZ_WINDOW_MASK] << 16) |
+                   ((uint32_t)encoder->history[(position + 1U) & LZ_WINDOW_MASK] << 8) |
+                   (uint32_t)encoder->history[(position + 2U) & LZ_WINDOW_MASK];
+
+    /* Multiplicative hashing, the top bits are the best mixed */
+    return (uint16_t)((key * 2654435761U) >> (32U - LZ_HASH_BITS));
+}
+
+/*
+ * Description :
+ * This function counts the bytes that match at two positions of the history.
+ * Parameters: encoder   -> The encoder.
+ *             candidate -> The earlier stream position.
+ *             position  -> The current stream position.
+ *             limit     -> The longest match wanted.
+ * Returns: The match length.
+ */
+static uint16_t LzMatchLength(const lzEncoder_t *encoder, uint32_t candidate, uint32_t position, uint16_t limit)
+{
+    uint16_t length = 0U;
+
+    while ((length < limit) &&
+           (encoder->history[(candidate + length) & LZ_WINDOW_MASK] == encoder->history[(position + length) & LZ_WINDOW_MASK]))
+    {
+        length++;
+    }
+
+    return length;
+}
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function starts a new stream on an encoder.
+ * Parameters: encoder -> The encoder.
+ * Returns: None.
+ */
+void LzEncoderInit(lzEncoder_t *encoder)
+{
+    (void)memset(encoder, 0, sizeof(*encoder));
+}
+
+/*
+ * Description :
+ * This function starts a new stream on a decoder.
+ * Parameters: decoder -> The decoder.
+ * Returns: None.
+ */
+void LzDecoderInit(lzDecoder_t *decoder)
+{
+    (void)memset(decoder, 0, sizeof(*decoder));
+}
+
+/*
+ * Description :
+ * This function compresses the next buffer of the stream. The buffer
+ * joins the history even when it does not compress, it must then be
+ * sent as it is and given to LzDecoderAppend() on the other side.
+ * Parameters: encoder  -> The encoder.
+ *             data     -> The bytes to be compressed.
+ *             length   -> The number of bytes, up to LZ_WINDOW_SIZE / 2.
+ *             output   -> The buffer receiving the compressed bytes.
+ *             capacity -> The size of the output buffer.
+ * Returns: The number of compressed bytes, 0 if they would not fit in capacity.
+ */
+uint16_t LzCompress(lzEncoder_t *encoder, const uint8_t *data, uint16_t length,
+                    uint8_t *output, uint16_t capacity)
+{
+    uint32_t position = encoder->position;
+    uint32_t end = position + length;
+    /* The buffer is put in the history first, so matches may run into it */
+    uint32_t oldest = (end > LZ_WINDOW_SIZE) ? (end - LZ_WINDOW_SIZE) : 0U;
+    uint16_t produced = 0U;
+    uint16_t flagIndex = 0U;
+    uint8_t item = LZ_GROUP_ITEMS;
+    bool fits = true;
+
+    LzEncoderAppend(encoder, data, length);
+
+    while (fits && (position < end))
+    {
+        uint16_t matchLength = 0U;
+        uint32_t distance = 0U;
+        uint16_t left = (uint16_t)(end - position);
+
+        if (left >= LZ_MIN_MATCH)
+        {
+            uint16_t hash = LzHash(encoder, position);
+            uint32_t candidate = position - (uint16_t)((uint16_t)position - encoder->head[hash]);
+
+            encoder->head[hash] = (uint16_t)position;
+
+            if ((candidate < position) && (candidate >= oldest))
+            {
+                matchLength = LzMatchLength(encoder, candidate, position,
+                                            (left > LZ_MAX_MATCH) ? (uint16_t)LZ_MAX_MATCH : left);
+                distance = position - candidate;
+            }
+
+            else
+            {
+
+            }
+        }
+
+        else
+        {
+
+        }
+
+        /* A flag byte opens every group of items */
+        if (item == LZ_GROUP_ITEMS)
+        {
+            fits = (produced < capacity);
+            flagIndex = produced;
+            item = 0U;
+
+            if (fits)
+            {
+                output[produced] = 0U;
+                produced++;
+            }
+
+            else
+            {
+
+            }
+        }
+
+        else
+        {
+
+        }
+
+        if (!fits)
+        {
+            /* The buffer is sent as it is */
+        }
+
+        else if (matchLength >= LZ_MIN_MATCH)
+        {
+            uint16_t token = (uint16_t)(((distance - 1U) << LZ_LENGTH_BITS) | (uint32_t)(matchLength - LZ_MIN_MATCH));
+            uint32_t next;
+
+            fits = ((uint32_t)produced + 2U) <= capacity;
+
+            if (fits)
+            {
+                output[flagIndex] |= (uint8_t)(1U << item);
+                output[produced] = (uint8_t)(token >> 8);
+                output[produced + 1U] = (uint8_t)token;
+                produced += 2U;
+
+                /* The positions inside the match are candidates for the next ones */
+                for (next = position + 1U; (next < (position + matchLength)) && ((end - next) >= LZ_MIN_MATCH); next++)
+                {
+                    encoder->head[LzHash(encoder, next)] = (uint16_t)next;
+                }
+
+                position += matchLength;
+            }
+
+            else
+            {
+
+            }
+        }
+
+        else
+        {
+            fits = (produced < capacity);
+
+            if (fits)
+            {
+                output[produced] = encoder->history[position & LZ_WINDOW_MASK];
+                produced++;
+                position++;
+            }
+
+            else
+            {
+
+            }
+        }
+
+        item++;
+    }
+
+    return fits ? produced : 0U;
+}
+
+/*
+ * Description :
+ * This function adds a buffer sent without compression to the history
+ * of an encoder.
+ * Parameters: encoder -> The encoder.
+ *             data    -> The bytes sent.
+ *             length  -> The number of bytes.
+ * Returns: None.
+ */
+void LzEncoderAppend(lzEncoder_t *encoder, const uint8_t *data, uint16_t length)
+{
+    LzCopy(encoder->history, encoder->position, data, length);
+    encoder->position += length;
+}
+
+/*
+ * Description :
+ * This function decompresses the next buffer of the stream.
+ * Parameters: decoder  -> The decoder.
+ *             data     -> The compressed bytes.
+ *             length   -> The number of compressed bytes.
+ *             output   -> The buffer receiving the original bytes.
+ *             capacity -> The size of the output buffer.
+ *             produced -> A pointer to where the number of original bytes will be stored.
+ * Returns: true if the buffer was decoded, false if it is malformed or
+ *          does not fit in capacity, the history is then out of step.
+ */
+bool LzDecompress(lzDecoder_t *decoder, const uint8_t *data, uint16_t length,
+                  uint8_t *output, uint16_t capacity, uint16_t *produced)
+{
+    uint16_t consumed = 0U;
+    uint16_t count = 0U;
+    bool valid = true;
+
+    while (valid && (consumed < length))
+    {
+        uint8_t flags = data[consumed];
+        uint8_t item;
+
+        consumed++;
+
+        for (item = 0U; valid && (item < LZ_GROUP_ITEMS) && (consumed < length); item++)
+        {
+            if ((flags & (uint8_t)(1U << item)) != 0U)
+            {
+                uint16_t token = 0U;
+                uint32_t distance = 0U;
+                uint16_t matchLength = 0U;
+
+                valid = ((uint32_t)consumed + 2U) <= length;
+
+                if (valid)
+                {
+                    token = (uint16_t)(((uint16_t)data[consumed] << 8) | (uint16_t)data[consumed + 1U]);
+                    consumed += 2U;
+                    distance = ((uint32_t)token >> LZ_LENGTH_BITS) + 1U;
+                    matchLength = (uint16_t)((token & LZ_LENGTH_MASK) + LZ_MIN_MATCH);
+                    valid = (distance <= decoder->position) && (((uint32_t)count + matchLength) <= capacity);
+                }
+
+                else
+                {
+
+                }
+
+                while (valid && (matchLength != 0U))
+                {
+                    uint8_t byte = decoder->history[(decoder->position - distance) & LZ_WINDOW_MASK];
+
+                    decoder->history[decoder->position & LZ_WINDOW_MASK] = byte;
+                    decoder->position++;
+                    output[count] = byte;
+                    count++;
+                    matchLength--;
+                }
+            }
+
+            else
+            {
+                valid = (count < capacity);
+
+                if (valid)
+                {
+                    decoder->history[decoder->position & LZ_WINDOW_MASK] = data[consumed];
+                    decoder->position++;
+                    output[count] = data[consumed];
+                    count++;
+                    consumed++;
+                }
+
+                else
+                {
+
+                }
+            }
+        }
+    }
+
+    *produced = count;
+
+    return valid;
+}
+
+/*
+ * Description :
+ * This function adds a buffer received without compression to the
+ * history of a decoder.
+ * Parameters: decoder -> The decoder.
+ *             data    -> The bytes received.
+ *             length  -> The number of bytes.
+ * Returns: None.
+ */
+void LzDecoderAppend(lzDecoder_t *decoder, const uint8_t *data, uint16_t length)
+{
+    LzCopy(decoder->history, decoder->position, data, length);
+    decoder->position += length;
+}
@@ -0,0 +1,152 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   lz.h                                                         *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file for the streaming LZ77 compressor used on the    *
+ *                link between the two boards                                  *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef LZ_H_
+#define LZ_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/*
+ * Compressed data is a sequence of groups: a flag byte, then up to eight
+ * items, bit 0 of the flag byte describing the first one:
+ *   0 -> a literal byte
+ *   1 -> a match, 16 bits sent most significant first:
+ *        (distance - 1) << LZ_LENGTH_BITS | (length - LZ_MIN_MATCH)
+ * A match copies length bytes starting distance bytes back in the history,
+ * it may overlap the bytes it produces. The history is the last
+ * LZ_WINDOW_SIZE bytes of the stream, it goes on from one buffer to the
+ * next, so a buffer may refer to the ones before it: the encoder and the
+ * decoder must see every buffer of the stream in the same order.
+ */
+#define LZ_WINDOW_BITS 10U
+#define LZ_WINDOW_SIZE (1U << LZ_WINDOW_BITS)
+#define LZ_LENGTH_BITS (16U - LZ_WINDOW_BITS)
+
+/* Shortest and longest match, shorter ones cost more than the literals */
+#define LZ_MIN_MATCH 3U
+#define LZ_MAX_MATCH (LZ_MIN_MATCH + (1U << LZ_LENGTH_BITS) - 1U)
+
+/* The match finder keeps the last position of every hash of 3 bytes */
+#define LZ_HASH_BITS 8U
+#define LZ_HASH_SIZE (1U << LZ_HASH_BITS)
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Structure holding the state of an encoder.
+ *              - history  : The last LZ_WINDOW_SIZE bytes of the stream.
+ *              - position : The number of bytes of the stream so far.
+ *              - head     : The low 16 bits of the last position of every
+ *                           hash, candidates are checked before use.
+ */
+typedef struct
+{
+    uint8_t history[LZ_WINDOW_SIZE];
+    uint32_t position;
+    uint16_t head[LZ_HASH_SIZE];
+} lzEncoder_t;
+
+/*
+ * Description: Structure holding the state of a decoder.
+ *              - history  : The last LZ_WINDOW_SIZE bytes of the stream.
+ *              - position : The number of bytes of the stream so far.
+ */
+typedef struct
+{
+    uint8_t history[LZ_WINDOW_SIZE];
+    uint32_t position;
+} lzDecoder_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function starts a new stream on an encoder.
+ * Parameters: encoder -> The encoder.
+ * Returns: None.
+ */
+void LzEncoderInit(lzEncoder_t *encoder);
+
+/*
+ * Description :
+ * This function starts a new stream on a decoder.
+ * Parameters: decoder -> The decoder.
+ * Returns: None.
+ */
+void LzDecoderInit(lzDecoder_t *decoder);
+
+/*
+ * Description :
+ * This function compresses the next buffer of the stream. The buffer
+ * joins the history even when it does not compress, it must then be
+ * sent as it is and given to LzDecoderAppend() on the other side.
+ * Parameters: encoder  -> The encoder.
+ *             data     -> The bytes to be compressed.
+ *             length   -> The number of bytes, up to LZ_WINDOW_SIZE / 2.
+ *             output   -> The buffer receiving the compressed bytes.
+ *             capacity -> The size of the output buffer.
+ * Returns: The number of compressed bytes, 0 if they would not fit in capacity.
+ */
+uint16_t LzCompress(lzEncoder_t *encoder, const uint8_t *data, uint16_t length,
+                    uint8_t *output, uint16_t capacity);
+
+/*
+ * Description :
+ * This function adds a buffer sent without compression to the history
+ * of an encoder.
+ * Parameters: encoder -> The encoder.
+ *             data    -> The bytes sent.
+ *             length  -> The number of bytes.
+ * Returns: None.
+ */
+void LzEncoderAppend(lzEncoder_t *encoder, const uint8_t *data, uint16_t length);
+
+/*
+ * Description :
+ * This function decompresses the next buffer of the stream.
+ * Parameters: decoder  -> The decoder.
+ *             data     -> The compressed bytes.
+ *             length   -> The number of compressed bytes.
+ *             output   -> The buffer receiving the original bytes.
+ *             capacity -> The size of the output buffer.
+ *             produced -> A pointer to where the number of original bytes will be stored.
+ * Returns: true if the buffer was decoded, false if it is malformed or
+ *          does not fit in capacity, the history is then out of step.
+ */
+bool LzDecompress(lzDecoder_t *decoder, const uint8_t *data, uint16_t length,
+                  uint8_t *output, uint16_t capacity, uint16_t *produced);
+
+/*
+ * Description :
+ * This function adds a buffer received without compression to the
+ * history of a decoder.
+ * Parameters: decoder -> The decoder.
+ *             data    -> The bytes received.
+ *             length  -> The number of bytes.
+ * Returns: None.
+ */
+void LzDecoderAppend(lzDecoder_t *decoder, const uint8_t *data, uint16_t length);
+
+#endif /* LZ_H_ */
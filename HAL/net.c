@@ -0,0 +1,904 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   net.c                                                        *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the network layer, addressing the boards     *
+ *                and routing packets across a chain of them                   *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <string.h>
+#include "HAL/net.h"
+#include "HAL/ring_buffer.h"
+#include "driverlib/flash.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* Offsets of the header fields in a LINK_FRAME_NET payload */
+#define NET_DESTINATION 0U
+#define NET_SOURCE 1U
+#define NET_HOPS 2U
+#define NET_TYPE 3U
+
+/* Bit of a link port in a set of ports */
+#define NET_PORT_BIT(port) ((uint8_t)(1U << (port)))
+#define NET_ALL_PORTS ((uint8_t)((1U << LINK_PORT_COUNT) - 1U))
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Structure representing an entry of the routing table.
+ *              - address : The address of the board, NET_NO_ADDRESS if free.
+ *              - port    : The link port it was last heard on.
+ *              - hops    : The hops its last packet took.
+ *              - heardAt : The time of its last packet in ms.
+ */
+typedef struct
+{
+    uint8_t address;
+    uint8_t port;
+    uint8_t hops;
+    uint32_t heardAt;
+} netRouteEntry_t;
+
+/*
+ * Description: Structure representing a packet waiting to be forwarded.
+ *              - ports   : The set of ports it still has to leave on.
+ *              - length  : The number of payload bytes, header included.
+ *              - payload : The LINK_FRAME_NET payload, HOPS already counted down.
+ */
+typedef struct
+{
+    uint8_t ports;
+    uint8_t length;
+    uint8_t payload[ARQ_MAX_PAYLOAD];
+} netForward_t;
+
+/*******************************************************************************
+ *                            Global Variables                                 *
+ *******************************************************************************/
+static uint8_t nodeAddress = NET_NODE_ADDRESS;
+
+static netRouteEntry_t routes[NET_ROUTE_COUNT];
+
+/* The time something was last received on every port, a port is up
+ * while it was heard within NET_ROUTE_TIMEOUT_MS */
+static bool portHeard[LINK_PORT_COUNT];
+static uint32_t portHeardAt[LINK_PORT_COUNT];
+
+/* Packets forwarded in the order they arrived, from forwardHead on */
+static netForward_t forwardQueue[NET_FORWARD_QUEUE_SIZE];
+static uint8_t forwardHead = 0U;
+static uint8_t forwardCount = 0U;
+
+/* The time of the last announcement */
+static bool announced = false;
+static uint32_t announcedAt = 0U;
+
+/* The port polled first, so that a busy port does not starve the others */
+static uint8_t pollPort = 0U;
+
+/* The header followed by the data, as handed to ArqSend() */
+static uint8_t txPayload[ARQ_MAX_PAYLOAD];
+
+static netPacket_t rxPacket;
+
+/* The function receiving the data frames of the other types */
+static netFrameHandler_t frameHandler = NULL;
+
+/* Packets for this board kept while holding, each one as its type,
+ * source, destination, hops, port and length followed by its data, and
+ * the data of the one given back last */
+static bool holding = false;
+static volatile uint8_t holdStorage[NET_HOLD_BUFFER_SIZE];
+static ringBuffer_t holdRing;
+static uint8_t heldData[NET_MAX_DATA];
+
+static netStats_t netStats;
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static uint32_t NetNow(void);
+static bool NetPortUp(uint8_t port, uint32_t now);
+static const netRouteEntry_t* NetFindRoute(uint8_t address, uint32_t now);
+static void NetLearn(uint8_t address, uint8_t port, uint8_t hops, uint32_t now);
+static uint8_t NetPorts(uint8_t destination, uint8_t inPort, uint32_t now);
+static bool NetWindowsFree(uint8_t ports);
+static void NetForward(const linkFrame_t *frame, uint8_t ports);
+static void NetForwardDrain(void);
+static void NetAnnounce(uint32_t now);
+static const netPacket_t* NetReceive(uint8_t port, const linkFrame_t *frame);
+static void NetKeep(const netPacket_t *packet);
+static const netPacket_t* NetUnhold(void);
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function returns the current time.
+ * Parameters: None.
+ * Returns: The time since the SysTick started in ms.
+ */
+static uint32_t NetNow(void)
+{
+    return SysticGetTicks() * SYSTICK_PERIOD_MS;
+}
+
+/*
+ * Description :
+ * This function tells whether a board was heard on a port lately.
+ * Parameters: port -> The link port (LINK_PORT_xxx).
+ *             now  -> The current time in ms.
+ * Returns: true if the port is up.
+ */
+static bool NetPortUp(uint8_t port, uint32_t now)
+{
+    return portHeard[port] && ((now - portHeardAt[port]) < NET_ROUTE_TIMEOUT_MS);
+}
+
+/*
+ * Description :
+ * This function looks up the route to a board.
+ * Parameters: address -> The address of the board.
+ *             now     -> The current time in ms.
+ * Returns: A pointer to the route, or NULL if there is none or it timed out.
+ */
+static const netRouteEntry_t* NetFindRoute(uint8_t address, uint32_t now)
+{
+    const netRouteEntry_t *route = NULL;
+    uint8_t i;
+
+    for (i = 0U; (i < NET_ROUTE_COUNT) && (NULL == route); i++)
+    {
+        if ((routes[i].address == address) && ((now - routes[i].heardAt) < NET_ROUTE_TIMEOUT_MS))
+        {
+            route = &routes[i];
+        }
+
+        else
+        {
+
+        }
+    }
+
+    return route;
+}
+
+/*
+ * Description :
+ * This function learns the route to the source of a received packet. A
+ * route is replaced by a shorter one, or by the news of its own port;
+ * a new board takes a free entry, else the entry heard the longest ago.
+ * Parameters: address -> The source of the packet.
+ *             port    -> The link port it came in on.
+ *             hops    -> The hops it took.
+ *             now     -> The current time in ms.
+ * Returns: None.
+ */
+static void NetLearn(uint8_t address, uint8_t port, uint8_t hops, uint32_t now)
+{
+    netRouteEntry_t *entry = NULL;
+    netRouteEntry_t *oldest = &routes[0];
+    uint8_t i;
+
+    for (i = 0U; (i < NET_ROUTE_COUNT) && (NULL == entry); i++)
+    {
+        if (routes[i].address == address)
+        {
+            entry = &routes[i];
+        }
+
+        else if ((oldest->address != NET_NO_ADDRESS) &&
+                 ((routes[i].address == NET_NO_ADDRESS) || ((now - routes[i].heardAt) > (now - oldest->heardAt))))
+        {
+            oldest = &routes[i];
+        }
+
+        else
+        {
+
+        }
+    }
+
+    if ((address == NET_NO_ADDRESS) || (address == NET_BROADCAST) || (address == nodeAddress))
+    {
+        /* Nothing to route to */
+    }
+
+    else if (NULL == entry)
+    {
+        oldest->address = address;
+        oldest->port = port;
+        oldest->hops = hops;
+        oldest->heardAt = now;
+    }
+
+    else if ((entry->port == port) || (hops <= entry->hops) || ((now - entry->heardAt) >= NET_ROUTE_TIMEOUT_MS))
+    {
+        entry->port = port;
+        entry->hops = hops;
+        entry->heardAt = now;
+    }
+
+    else
+    {
+        /* A longer way to a board reached by its route */
+    }
+}
+
+/*
+ * Description :
+ * This function chooses the ports a packet leaves on: the port of the
+ * route to its destination, else every port that is up, never the port
+ * it came in on.
+ * Parameters: destination -> A node address or NET_BROADCAST.
+ *             inPort      -> The port the packet came in on, LINK_PORT_COUNT
+ *                            for a packet sent by this board.
+ *             now         -> The current time in ms.
+ * Returns: The set of ports, 0 if the packet goes nowhere.
+ */
+static uint8_t NetPorts(uint8_t destination, uint8_t inPort, uint32_t now)
+{
+    const netRouteEntry_t *route = NULL;
+    uint8_t ports = 0U;
+    uint8_t port;
+
+    if (destination != NET_BROADCAST)
+    {
+        route = NetFindRoute(destination, now);
+    }
+
+    else
+    {
+
+    }
+
+    if (NULL != route)
+    {
+        ports = NET_PORT_BIT(route->port);
+    }
+
+    else
+    {
+        for (port = 0U; port < LINK_PORT_COUNT; port++)
+        {
+            if (NetPortUp(port, now))
+            {
+                ports |= NET_PORT_BIT(port);
+            }
+
+            else
+            {
+
+            }
+        }
+    }
+
+    if (inPort < LINK_PORT_COUNT)
+    {
+        ports &= (uint8_t)~NET_PORT_BIT(inPort);
+    }
+
+    else
+    {
+
+    }
+
+    return ports;
+}
+
+/*
+ * Description :
+ * This function tells whether every port of a set has room in its send window.
+ * Parameters: ports -> The set of ports.
+ * Returns: true if they all have room.
+ */
+static bool NetWindowsFree(uint8_t ports)
+{
+    bool free = true;
+    uint8_t port;
+
+    for (port = 0U; port < LINK_PORT_COUNT; port++)
+    {
+        if (((ports & NET_PORT_BIT(port)) != 0U) && (ArqWindowFree(port) == 0U))
+        {
+            free = false;
+        }
+
+        else
+        {
+
+        }
+    }
+
+    return free;
+}
+
+/*
+ * Description :
+ * This function queues a received packet to be forwarded, its HOPS
+ * counted down, and sends it on the ports that have room.
+ * Parameters: frame -> The LINK_FRAME_NET frame received.
+ *             ports -> The set of ports it leaves on.
+ * Returns: None.
+ */
+static void NetForward(const linkFrame_t *frame, uint8_t ports)
+{
+    if (forwardCount < NET_FORWARD_QUEUE_SIZE)
+    {
+        netForward_t *entry = &forwardQueue[(forwardHead + forwardCount) % NET_FORWARD_QUEUE_SIZE];
+
+        (void)memcpy(entry->payload, frame->payload, frame->length);
+        entry->payload[NET_HOPS]--;
+        entry->length = frame->length;
+        entry->ports = ports;
+        forwardCount++;
+        NetForwardDrain();
+    }
+
+    else
+    {
+        netStats.queueDrops++;
+    }
+}
+
+/*
+ * Description :
+ * This function sends the queued packets on the ports that have room,
+ * in the order they arrived.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void NetForwardDrain(void)
+{
+    bool blocked = false;
+
+    while ((forwardCount != 0U) && !blocked)
+    {
+        netForward_t *entry = &forwardQueue[forwardHead];
+        uint8_t port;
+
+        for (port = 0U; port < LINK_PORT_COUNT; port++)
+        {
+            if (((entry->ports & NET_PORT_BIT(port)) != 0U) &&
+                ArqSend(port, (uint8_t)LINK_FRAME_NET, entry->payload, entry->length))
+            {
+                entry->ports &= (uint8_t)~NET_PORT_BIT(port);
+                netStats.forwarded++;
+            }
+
+            else
+            {
+
+            }
+        }
+
+        if (entry->ports == 0U)
+        {
+            forwardHead = (uint8_t)((forwardHead + 1U) % NET_FORWARD_QUEUE_SIZE);
+            forwardCount--;
+        }
+
+        else
+        {
+            /* The later packets wait, so that they stay in order */
+            blocked = true;
+        }
+    }
+}
+
+/*
+ * Description :
+ * This function broadcasts the announcement of this board every
+ * NET_ANNOUNCE_MS on every port with room, whether it is up or not, so
+ * that the boards on the other end learn the port and the route.
+ * Parameters: now -> The current time in ms.
+ * Returns: None.
+ */
+static void NetAnnounce(uint32_t now)
+{
+    uint8_t header[NET_HEADER_LENGTH];
+    uint8_t port;
+
+    if (!announced || ((now - announcedAt) >= NET_ANNOUNCE_MS))
+    {
+        header[NET_DESTINATION] = NET_BROADCAST;
+        header[NET_SOURCE] = nodeAddress;
+        header[NET_HOPS] = NET_MAX_HOPS;
+        header[NET_TYPE] = (uint8_t)LINK_FRAME_ANNOUNCE;
+
+        for (port = 0U; port < LINK_PORT_COUNT; port++)
+        {
+            /* A port nobody listens on fills its window, then is skipped */
+            (void)ArqSend(port, (uint8_t)LINK_FRAME_NET, header, NET_HEADER_LENGTH);
+        }
+
+        announced = true;
+        announcedAt = now;
+        netStats.announcesSent++;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function handles a frame received on a port: it learns the route
+ * to its source, forwards it and delivers it when it is for this board.
+ * Parameters: port  -> The link port it came in on.
+ *             frame -> The data frame returned by ArqPoll().
+ * Returns: A pointer to the packet for this board, or NULL.
+ */
+static const netPacket_t* NetReceive(uint8_t port, const linkFrame_t *frame)
+{
+    const netPacket_t *delivered = NULL;
+    uint32_t now = NetNow();
+
+    if ((frame->type == (uint8_t)LINK_FRAME_NET) && (frame->length >= NET_HEADER_LENGTH) &&
+        (frame->payload[NET_HOPS] != 0U) && (frame->payload[NET_HOPS] <= NET_MAX_HOPS))
+    {
+        uint8_t destination = frame->payload[NET_DESTINATION];
+        uint8_t hops = frame->payload[NET_HOPS];
+        uint8_t ports = 0U;
+
+        portHeard[port] = true;
+        portHeardAt[port] = now;
+        NetLearn(frame->payload[NET_SOURCE], port, (uint8_t)(NET_MAX_HOPS - hops + 1U), now);
+
+        if (destination != nodeAddress)
+        {
+            ports = NetPorts(destination, port, now);
+        }
+
+        else
+        {
+
+        }
+
+        if (ports == 0U)
+        {
+            /* Goes nowhere else */
+        }
+
+        else if (hops <= 1U)
+        {
+            netStats.hopLimitDrops++;
+        }
+
+        else
+        {
+            if ((destination != NET_BROADCAST) && (NULL == NetFindRoute(destination, now)))
+            {
+                netStats.floods++;
+            }
+
+            else
+            {
+
+            }
+
+            NetForward(frame, ports);
+        }
+
+        if (((destination == nodeAddress) || (destination == NET_BROADCAST)) &&
+            (frame->payload[NET_TYPE] != (uint8_t)LINK_FRAME_ANNOUNCE))
+        {
+            rxPacket.type = frame->payload[NET_TYPE];
+            rxPacket.source = frame->payload[NET_SOURCE];
+            rxPacket.destination = destination;
+            rxPacket.hops = (uint8_t)(NET_MAX_HOPS - hops + 1U);
+            rxPacket.port = port;
+            rxPacket.length = (uint8_t)(frame->length - NET_HEADER_LENGTH);
+            rxPacket.data = &frame->payload[NET_HEADER_LENGTH];
+            netStats.packetsReceived++;
+            delivered = &rxPacket;
+        }
+
+        else
+        {
+
+        }
+    }
+
+    else if ((frame->type != (uint8_t)LINK_FRAME_NET) && (NULL != frameHandler))
+    {
+        /* Not a network packet, it goes to its own layer */
+        frameHandler(frame);
+    }
+
+    else
+    {
+        /* A packet out of hops, or a frame no layer takes */
+    }
+
+    return delivered;
+}
+
+/*
+ * Description :
+ * This function keeps a packet for this board while holding, copying
+ * it out of the frame buffer of the link. NetPoll() only takes a frame
+ * when the largest packet fits.
+ * Parameters: packet -> The packet returned by NetReceive().
+ * Returns: None.
+ */
+static void NetKeep(const netPacket_t *packet)
+{
+    uint8_t i;
+
+    (void)RingBufferPut(&holdRing, packet->type);
+    (void)RingBufferPut(&holdRing, packet->source);
+    (void)RingBufferPut(&holdRing, packet->destination);
+    (void)RingBufferPut(&holdRing, packet->hops);
+    (void)RingBufferPut(&holdRing, packet->port);
+    (void)RingBufferPut(&holdRing, packet->length);
+
+    for (i = 0U; i < packet->length; i++)
+    {
+        (void)RingBufferPut(&holdRing, packet->data[i]);
+    }
+
+    netStats.packetsHeld++;
+}
+
+/*
+ * Description :
+ * This function takes the oldest packet kept while holding.
+ * Parameters: None.
+ * Returns: A pointer to the packet, valid until the next call of NetPoll().
+ */
+static const netPacket_t* NetUnhold(void)
+{
+    uint8_t i;
+
+    (void)RingBufferGet(&holdRing, &rxPacket.type);
+    (void)RingBufferGet(&holdRing, &rxPacket.source);
+    (void)RingBufferGet(&holdRing, &rxPacket.destination);
+    (void)RingBufferGet(&holdRing, &rxPacket.hops);
+    (void)RingBufferGet(&holdRing, &rxPacket.port);
+    (void)RingBufferGet(&holdRing, &rxPacket.length);
+
+    for (i = 0U; i < rxPacket.length; i++)
+    {
+        (void)RingBufferGet(&holdRing, &heldData[i]);
+    }
+
+    rxPacket.data = heldData;
+
+    return &rxPacket;
+}
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function reads the node address, gives the bus addresses to a
+ * port on an RS-485 bus, empties the routing table and the forward
+ * queue and resets the counters.
+ * Parameters: None.
+ * Returns: None.
+ */
+void NetInit(void)
+{
+    uint32_t user0 = 0U;
+    uint32_t user1 = 0U;
+    uint8_t port;
+
+    (void)FlashUserGet(&user0, &user1);
+
+    /* An erased register reads 0xFFFFFFFF */
+    if (((user0 & 0xFFU) != NET_NO_ADDRESS) && ((user0 & 0xFFU) != NET_BROADCAST))
+    {
+        nodeAddress = (uint8_t)(user0 & 0xFFU);
+    }
+
+    else
+    {
+        nodeAddress = NET_NODE_ADDRESS;
+    }
+
+#if (UART3_MULTIDROP_MODE == 1U)
+    {
+        uint8_t peer = (uint8_t)(user0 >> 8);
+
+        if ((peer == NET_NO_ADDRESS) || (peer == NET_BROADCAST))
+        {
+            peer = NET_BUS_PEER_ADDRESS;
+        }
+
+        else
+        {
+
+        }
+
+        (void)LinkSetBusAddress(LINK_PORT_UART3, nodeAddress, peer);
+    }
+#endif
+
+    (void)memset(routes, 0, sizeof(routes));
+
+    for (port = 0U; port < LINK_PORT_COUNT; port++)
+    {
+        portHeard[port] = false;
+        portHeardAt[port] = 0U;
+    }
+
+    forwardHead = 0U;
+    forwardCount = 0U;
+    holding = false;
+    RingBufferInit(&holdRing, holdStorage, (uint16_t)NET_HOLD_BUFFER_SIZE);
+    announced = false;
+    announcedAt = 0U;
+    pollPort = 0U;
+    (void)memset(&netStats, 0, sizeof(netStats));
+}
+
+/*
+ * Description :
+ * This function returns the address of this board.
+ * Parameters: None.
+ * Returns: The node address.
+ */
+uint8_t NetGetAddress(void)
+{
+    return nodeAddress;
+}
+
+/*
+ * Description :
+ * This function tells whether NetSend() would accept a packet for a
+ * destination now.
+ * Parameters: destination -> A node address or NET_BROADCAST.
+ * Returns: true if a port leads towards the destination and every port
+ *          the packet leaves on has room in its send window.
+ */
+bool NetCanSend(uint8_t destination)
+{
+    uint8_t ports = NetPorts(destination, LINK_PORT_COUNT, NetNow());
+
+    return (ports != 0U) && NetWindowsFree(ports);
+}
+
+/*
+ * Description :
+ * This function sends a packet from this board to another one, or to
+ * every board, on the ports leading to it.
+ * Parameters: destination -> A node address or NET_BROADCAST.
+ *             type        -> The frame type of the data (linkFrameType_t).
+ *             data        -> The data bytes, may be NULL when length is 0.
+ *             length      -> The number of data bytes, up to NET_MAX_DATA.
+ * Returns: true if the packet was accepted, false if no port is up or a
+ *          send window is full.
+ */
+bool NetSend(uint8_t destination, uint8_t type, const uint8_t *data, uint8_t length)
+{
+    bool accepted = false;
+    uint32_t now = NetNow();
+    uint8_t ports = NetPorts(destination, LINK_PORT_COUNT, now);
+    uint8_t port;
+
+    if ((length > NET_MAX_DATA) || ((NULL == data) && (length != 0U)) ||
+        (destination == NET_NO_ADDRESS) || (ports == 0U) || !NetWindowsFree(ports))
+    {
+        /* Nothing sent */
+    }
+
+    else
+    {
+        txPayload[NET_DESTINATION] = destination;
+        txPayload[NET_SOURCE] = nodeAddress;
+        txPayload[NET_HOPS] = NET_MAX_HOPS;
+        txPayload[NET_TYPE] = type;
+
+        if (length != 0U)
+        {
+            (void)memcpy(&txPayload[NET_HEADER_LENGTH], data, length);
+        }
+
+        else
+        {
+
+        }
+
+        for (port = 0U; port < LINK_PORT_COUNT; port++)
+        {
+            if ((ports & NET_PORT_BIT(port)) != 0U)
+            {
+                (void)ArqSend(port, (uint8_t)LINK_FRAME_NET, txPayload, (uint8_t)(length + NET_HEADER_LENGTH));
+            }
+
+            else
+            {
+
+            }
+        }
+
+        if ((destination != NET_BROADCAST) && (NULL == NetFindRoute(destination, now)))
+        {
+            netStats.floods++;
+        }
+
+        else
+        {
+
+        }
+
+        netStats.packetsSent++;
+        accepted = true;
+    }
+
+    return accepted;
+}
+
+/*
+ * Description :
+ * This function serves every link port: it forwards the packets passing
+ * through, learns the routes, sends the announcements, hands the other
+ * data frames to the frame handler and returns the packets for this
+ * board, or keeps them while NetHold() is set. It must be called often
+ * from the main loop.
+ * Parameters: None.
+ * Returns: A pointer to the next packet for this board, valid until the
+ *          next call, or NULL if there is none yet or they are held.
+ */
+const netPacket_t* NetPoll(void)
+{
+    const netPacket_t *delivered = NULL;
+    uint8_t i;
+
+    NetAnnounce(NetNow());
+    NetForwardDrain();
+
+    /* The packets kept meanwhile come first, in the order they arrived */
+    if (!holding && (RingBufferCount(&holdRing) != 0U))
+    {
+        delivered = NetUnhold();
+    }
+
+    else
+    {
+
+    }
+
+    for (i = 0U; (i < LINK_PORT_COUNT) && (NULL == delivered); i++)
+    {
+        uint8_t port = (uint8_t)((pollPort + i) % LINK_PORT_COUNT);
+        const linkFrame_t *frame;
+
+        /* ArqPoll() only returns NULL once the link has no frame left,
+         * a frame taken here is followed by the next one */
+        do
+        {
+            /* Without room for the largest packet, the data frames wait */
+            ArqSetHold(port, holding &&
+                       (RingBufferFree(&holdRing) < (uint16_t)(NET_HOLD_HEADER_LENGTH + NET_MAX_DATA)));
+            frame = ArqPoll(port);
+
+            if (NULL != frame)
+            {
+                delivered = NetReceive(port, frame);
+            }
+
+            else
+            {
+
+            }
+
+            if ((NULL != delivered) && holding)
+            {
+                NetKeep(delivered);
+                delivered = NULL;
+            }
+
+            else if (NULL != delivered)
+            {
+                pollPort = (uint8_t)((port + 1U) % LINK_PORT_COUNT);
+            }
+
+            else
+            {
+
+            }
+        } while ((NULL != frame) && (NULL == delivered));
+    }
+
+    return delivered;
+}
+
+/*
+ * Description :
+ * This function sets the function called by NetPoll() for every data
+ * frame of another type than LINK_FRAME_NET.
+ * Parameters: handler -> The frame handler, NULL to drop them.
+ * Returns: None.
+ */
+void NetSetFrameHandler(netFrameHandler_t handler)
+{
+    frameHandler = handler;
+}
+
+/*
+ * Description :
+ * This function keeps the packets for this board in NetPoll(), while the
+ * state running does not show them; they are returned once it is cleared.
+ * Parameters: hold -> true to keep the packets, false to return them.
+ * Returns: None.
+ */
+void NetHold(bool hold)
+{
+    uint8_t port;
+
+    holding = hold;
+
+    for (port = 0U; port < LINK_PORT_COUNT; port++)
+    {
+        ArqSetHold(port, false);
+    }
+}
+
+/*
+ * Description :
+ * This function describes a route of the routing table.
+ * Parameters: index -> The route number, from 0 up to NET_ROUTE_COUNT - 1.
+ *             route -> A pointer to the structure where the route will be stored.
+ * Returns: true if the route is in use, false otherwise.
+ */
+bool NetGetRoute(uint8_t index, netRoute_t *route)
+{
+    bool used = false;
+    uint32_t now = NetNow();
+
+    if ((index < NET_ROUTE_COUNT) && (NULL != route) && (routes[index].address != NET_NO_ADDRESS) &&
+        ((now - routes[index].heardAt) < NET_ROUTE_TIMEOUT_MS))
+    {
+        route->address = routes[index].address;
+        route->port = routes[index].port;
+        route->hops = routes[index].hops;
+        route->ageMs = now - routes[index].heardAt;
+        used = true;
+    }
+
+    else
+    {
+
+    }
+
+    return used;
+}
+
+/*
+ * Description :
+ * This function copies the network layer counters.
+ * Parameters: stats -> A pointer to the structure where the counters will be stored.
+ * Returns: None.
+ */
+void NetGetStats(netStats_t *stats)
+{
+    if (NULL != stats)
+    {
+        *stats = netStats;
+    }
+
+    else
+    {
+
+    }
+}
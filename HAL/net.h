@@ -0,0 +1,262 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   net.h                                                        *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file for the network layer, addressing the boards     *
+ *                and routing packets across a chain of them                   *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef NET_H_
+#define NET_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "HAL/arq.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/*
+ * A packet goes from board to board in LINK_FRAME_NET frames, every hop
+ * delivered by the reliable delivery layer of a link port:
+ *   DESTINATION | SOURCE | HOPS | TYPE | DATA (up to NET_MAX_DATA bytes)
+ * DESTINATION is a node address or NET_BROADCAST, HOPS the number of hops
+ * the packet may still take and TYPE the frame type of the data
+ * (linkFrameType_t). A board delivers the packets sent to its address and
+ * the broadcasts, and stores and forwards the others while HOPS allows:
+ * on the port of the route to their destination, or on every other port
+ * that is up for a broadcast or a destination without a route.
+ * Routes are learned from the packets received: the port a source was
+ * heard on and the hops its packet took. Every board broadcasts a
+ * LINK_FRAME_ANNOUNCE packet every NET_ANNOUNCE_MS, so that silent boards
+ * are reached too, and a route or a port is dropped when nothing was heard
+ * through it for NET_ROUTE_TIMEOUT_MS. A packet never leaves on the port
+ * it came in on, so the boards must be wired as a chain or a tree, on a
+ * loop only the hop limit ends the copies.
+ */
+#define NET_HEADER_LENGTH 4U
+#define NET_MAX_DATA (ARQ_MAX_PAYLOAD - NET_HEADER_LENGTH)
+
+/* Destination of a packet for every board */
+#define NET_BROADCAST 0xFFU
+
+/* Not a node address, marks a free route */
+#define NET_NO_ADDRESS 0x00U
+
+/* Node address configuration:
+ * The address of a board is the low byte of the USER_REG0 flash register
+ * (FlashUserGet()) when it is programmed with 1 to 254, so that the same
+ * firmware runs on every board, and NET_NODE_ADDRESS otherwise. Boards
+ * sharing an address still reach each other by broadcast.
+ * The host simulation build may set it from the command line. */
+#ifndef NET_NODE_ADDRESS
+#define NET_NODE_ADDRESS 1U
+#endif
+
+/* Bus peer configuration:
+ * A link port on an RS-485 bus (UART3_MULTIDROP_MODE) talks to one other
+ * board of the bus, so that several pairs of boards share it. The address
+ * of that board is the second byte of USER_REG0 (bits 15:8) when it is
+ * programmed with 1 to 254, NET_BUS_PEER_ADDRESS otherwise. */
+#ifndef NET_BUS_PEER_ADDRESS
+#define NET_BUS_PEER_ADDRESS 2U
+#endif
+
+/* Hops a packet may take, so a packet caught in a loop dies out */
+#define NET_MAX_HOPS 8U
+
+/* Boards the routing table keeps a route to */
+#define NET_ROUTE_COUNT 16U
+
+/* Period of the announcements, and silence after which a route or a port
+ * is considered gone */
+#define NET_ANNOUNCE_MS 2000U
+#define NET_ROUTE_TIMEOUT_MS (3U * NET_ANNOUNCE_MS)
+
+/* Packets waiting for room in the send window of the port they are
+ * forwarded on, further ones are dropped */
+#define NET_FORWARD_QUEUE_SIZE 4U
+
+/* Bytes keeping the packets for this board while NetHold() is set, the
+ * state running not showing them: NET_HOLD_HEADER_LENGTH bytes plus the
+ * data each. Once a full packet no longer fits, the ports leave their
+ * data frames with the other boards (ArqSetHold()) until it is cleared.
+ * Must be a power of two */
+#define NET_HOLD_BUFFER_SIZE 1024U
+#define NET_HOLD_HEADER_LENGTH 6U
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Pointer to the function receiving the data frames of
+ *              another type than LINK_FRAME_NET, sent to a neighbouring
+ *              board only (file transfer).
+ */
+typedef void (*netFrameHandler_t)(const linkFrame_t *frame);
+
+/*
+ * Description: Structure describing a packet delivered to this board.
+ *              - type        : The frame type of the data (linkFrameType_t).
+ *              - source      : The address of the board that sent it.
+ *              - destination : This board's address or NET_BROADCAST.
+ *              - hops        : The hops it took, 1 from a neighbouring board.
+ *              - port        : The link port it came in on (LINK_PORT_xxx).
+ *              - length      : The number of data bytes.
+ *              - data        : The data bytes, valid until the next NetPoll() call.
+ */
+typedef struct
+{
+    uint8_t type;
+    uint8_t source;
+    uint8_t destination;
+    uint8_t hops;
+    uint8_t port;
+    uint8_t length;
+    const uint8_t *data;
+} netPacket_t;
+
+/*
+ * Description: Structure describing a route of the routing table.
+ *              - address : The address of the board.
+ *              - port    : The link port leading to it (LINK_PORT_xxx).
+ *              - hops    : The hops its last packet took.
+ *              - ageMs   : The time since its last packet.
+ */
+typedef struct
+{
+    uint8_t address;
+    uint8_t port;
+    uint8_t hops;
+    uint32_t ageMs;
+} netRoute_t;
+
+/*
+ * Description: Structure holding the network layer counters.
+ *              - packetsSent     : Packets sent by this board.
+ *              - packetsReceived : Packets delivered to this board.
+ *              - forwarded       : Packets forwarded, once per port they left on.
+ *              - floods          : Packets sent or forwarded on every port, their
+ *                                  destination having no route.
+ *              - hopLimitDrops   : Packets not forwarded, their hops used up.
+ *              - queueDrops      : Packets not forwarded, the forward queue being full.
+ *              - announcesSent   : Announcements sent.
+ *              - packetsHeld     : Packets for this board kept by NetHold() until
+ *                                  the state running took them.
+ */
+typedef struct
+{
+    uint32_t packetsSent;
+    uint32_t packetsReceived;
+    uint32_t forwarded;
+    uint32_t floods;
+    uint32_t hopLimitDrops;
+    uint32_t queueDrops;
+    uint32_t announcesSent;
+    uint32_t packetsHeld;
+} netStats_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function reads the node address, gives the bus addresses to a
+ * port on an RS-485 bus, empties the routing table and the forward
+ * queue and resets the counters.
+ * Parameters: None.
+ * Returns: None.
+ */
+void NetInit(void);
+
+/*
+ * Description :
+ * This function returns the address of this board.
+ * Parameters: None.
+ * Returns: The node address.
+ */
+uint8_t NetGetAddress(void);
+
+/*
+ * Description :
+ * This function tells whether NetSend() would accept a packet for a
+ * destination now.
+ * Parameters: destination -> A node address or NET_BROADCAST.
+ * Returns: true if a port leads towards the destination and every port
+ *          the packet leaves on has room in its send window.
+ */
+bool NetCanSend(uint8_t destination);
+
+/*
+ * Description :
+ * This function sends a packet from this board to another one, or to
+ * every board, on the ports leading to it.
+ * Parameters: destination -> A node address or NET_BROADCAST.
+ *             type        -> The frame type of the data (linkFrameType_t).
+ *             data        -> The data bytes, may be NULL when length is 0.
+ *             length      -> The number of data bytes, up to NET_MAX_DATA.
+ * Returns: true if the packet was accepted, false if no port is up or a
+ *          send window is full.
+ */
+bool NetSend(uint8_t destination, uint8_t type, const uint8_t *data, uint8_t length);
+
+/*
+ * Description :
+ * This function serves every link port: it forwards the packets passing
+ * through, learns the routes, sends the announcements, hands the other
+ * data frames to the frame handler and returns the packets for this
+ * board, or keeps them while NetHold() is set. It must be called often
+ * from the main loop.
+ * Parameters: None.
+ * Returns: A pointer to the next packet for this board, valid until the
+ *          next call, or NULL if there is none yet or they are held.
+ */
+const netPacket_t* NetPoll(void);
+
+/*
+ * Description :
+ * This function sets the function called by NetPoll() for every data
+ * frame of another type than LINK_FRAME_NET.
+ * Parameters: handler -> The frame handler, NULL to drop them.
+ * Returns: None.
+ */
+void NetSetFrameHandler(netFrameHandler_t handler);
+
+/*
+ * Description :
+ * This function keeps the packets for this board in NetPoll(), while the
+ * state running does not show them; they are returned once it is cleared.
+ * Parameters: hold -> true to keep the packets, false to return them.
+ * Returns: None.
+ */
+void NetHold(bool hold);
+
+/*
+ * Description :
+ * This function describes a route of the routing table.
+ * Parameters: index -> The route number, from 0 up to NET_ROUTE_COUNT - 1.
+ *             route -> A pointer to the structure where the route will be stored.
+ * Returns: true if the route is in use, false otherwise.
+ */
+bool NetGetRoute(uint8_t index, netRoute_t *route);
+
+/*
+ * Description :
+ * This function copies the network layer counters.
+ * Parameters: stats -> A pointer to the structure where the counters will be stored.
+ * Returns: None.
+ */
+void NetGetStats(netStats_t *stats);
+
+#endif /* NET_H_ */
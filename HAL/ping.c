@@ -0,0 +1,524 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   ping.c                                                       *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the ping state, timing the UART1 link with   *
+ *                probe frames and showing the link counters                   *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <string.h>
+#include "HAL/ping.h"
+#include "HAL/UART_API.h"
+#include "HAL/arq.h"
+#include "HAL/net.h"
+#include "HAL/frag.h"
+#include "HAL/baud.h"
+#include "HAL/timebase.h"
+#include "HAL/power.h"
+#include "HAL/profile.h"
+#include "HAL/log.h"
+
+/*******************************************************************************
+ *                            Global Variables                                 *
+ *******************************************************************************/
+/* The probe in flight, and when the next one is due */
+static bool pingActive = false;
+static bool pingWaiting = false;
+static uint16_t pingNumber = 0U;
+static uint32_t pingSentUs = 0U;
+static uint32_t pingDueUs = 0U;
+
+/* The sum of the round trip times for the average, and the previous
+ * round trip time for the jitter, kept x16 to round it well */
+static uint64_t pingSumUs = 0U;
+static uint32_t pingLastUs = 0U;
+static uint32_t pingJitterX16 = 0U;
+
+static pingStats_t pingStats;
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static uint32_t PingNow(void);
+static bool PingTimeCame(uint32_t now, uint32_t due);
+static void PingPut32(uint8_t *data, uint32_t value);
+static uint32_t PingGet32(const uint8_t *data);
+static bool PingSendProbe(void);
+static void PingCheckLost(void);
+static void PingTakeReply(const linkFrame_t *frame);
+static void PingReadTerminal(void);
+static void PingShowSummary(void);
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function gives the time in us, the low 32 bits of the timebase.
+ * Parameters: None.
+ * Returns: The time in us, wrapping every 71 minutes.
+ */
+static uint32_t PingNow(void)
+{
+    return (uint32_t)TimebaseGetUs();
+}
+
+/*
+ * Description :
+ * This function tells whether a time came.
+ * Parameters: now -> The current time in us.
+ *             due -> The time in us.
+ * Returns: true if now is at or after due.
+ */
+static bool PingTimeCame(uint32_t now, uint32_t due)
+{
+    /* The difference is read signed so the time may wrap */
+    return ((int32_t)(now - due) >= 0);
+}
+
+/*
+ * Description :
+ * This function stores a 32 bit number, most significant byte first.
+ * Parameters: data  -> Where the 4 bytes are stored.
+ *             value -> The number.
+ * Returns: None.
+ */
+static void PingPut32(uint8_t *data, uint32_t value)
+{
+    data[0] = (uint8_t)(value >> 24);
+    data[1] = (uint8_t)(value >> 16);
+    data[2] = (uint8_t)(value >> 8);
+    data[3] = (uint8_t)value;
+}
+
+/*
+ * Description :
+ * This function reads a 32 bit number stored most significant byte first.
+ * Parameters: data -> The 4 bytes.
+ * Returns: The number.
+ */
+static uint32_t PingGet32(const uint8_t *data)
+{
+    return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | (uint32_t)data[3];
+}
+
+/*
+ * Description :
+ * This function sends the next probe once the previous one was answered
+ * or lost and PING_PERIOD_MS passed since it was sent.
+ * Parameters: None.
+ * Returns: true if a probe was sent.
+ */
+static bool PingSendProbe(void)
+{
+    uint32_t now = PingNow();
+    bool sent = false;
+
+    if (!pingWaiting && PingTimeCame(now, pingDueUs))
+    {
+        uint8_t payload[PING_PAYLOAD_LENGTH];
+
+        pingNumber++;
+        payload[0] = (uint8_t)(pingNumber >> 8);
+        payload[1] = (uint8_t)pingNumber;
+        PingPut32(&payload[2], now);
+
+        /* A probe the UART has no room for is tried again on the next run */
+        if (LinkSend(LINK_PORT_UART1, (uint8_t)LINK_FRAME_PING_REQUEST, 0U, 0U, payload, (uint8_t)PING_PAYLOAD_LENGTH))
+        {
+            pingSentUs = now;
+            pingDueUs = now + (PING_PERIOD_MS * 1000U);
+            pingWaiting = true;
+            pingStats.sent++;
+            sent = true;
+        }
+
+        else
+        {
+            pingNumber--;
+        }
+    }
+
+    else
+    {
+
+    }
+
+    return sent;
+}
+
+/*
+ * Description :
+ * This function counts the probe in flight lost once PING_TIMEOUT_MS
+ * passed without its reply.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void PingCheckLost(void)
+{
+    uint32_t now = PingNow();
+
+    if (pingWaiting && PingTimeCame(now, pingSentUs + (PING_TIMEOUT_MS * 1000U)))
+    {
+        pingWaiting = false;
+        pingStats.lost++;
+
+        Log1(LOG_PING_LOST, pingNumber);
+
+        if ((pingStats.sent % PING_SUMMARY_COUNT) == 0U)
+        {
+            PingShowSummary();
+        }
+
+        else
+        {
+
+        }
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function takes the reply to a probe: the round trip time goes into
+ * the minimum, maximum, average and jitter. A reply to an older probe,
+ * already counted lost, is counted late.
+ * Parameters: frame -> The LINK_FRAME_PING_REPLY frame.
+ * Returns: None.
+ */
+static void PingTakeReply(const linkFrame_t *frame)
+{
+    uint32_t now = PingNow();
+
+    if (!pingActive || (frame->length != PING_PAYLOAD_LENGTH))
+    {
+        /* Not ours, or a reply after leaving the state */
+    }
+
+    else if (!pingWaiting || (((uint16_t)((uint16_t)frame->payload[0] << 8) | frame->payload[1]) != pingNumber) ||
+             (PingGet32(&frame->payload[2]) != pingSentUs))
+    {
+        pingStats.late++;
+    }
+
+    else
+    {
+        uint32_t rtt = now - pingSentUs;
+
+        pingWaiting = false;
+        pingStats.received++;
+        pingSumUs += rtt;
+        pingStats.minUs = ((pingStats.received == 1U) || (rtt < pingStats.minUs)) ? rtt : pingStats.minUs;
+        pingStats.maxUs = (rtt > pingStats.maxUs) ? rtt : pingStats.maxUs;
+        pingStats.avgUs = (uint32_t)(pingSumUs / pingStats.received);
+
+        /* J = J + (|D| - J) / 16, D the difference with the previous one */
+        if (pingStats.received > 1U)
+        {
+            uint32_t d = (rtt > pingLastUs) ? (rtt - pingLastUs) : (pingLastUs - rtt);
+
+            pingJitterX16 = pingJitterX16 + d - (pingJitterX16 >> 4);
+            pingStats.jitterUs = pingJitterX16 >> 4;
+        }
+
+        else
+        {
+
+        }
+
+        pingLastUs = rtt;
+
+        Log2(LOG_PING_REPLY, pingNumber, rtt);
+
+        if ((pingStats.sent % PING_SUMMARY_COUNT) == 0U)
+        {
+            PingShowSummary();
+        }
+
+        else
+        {
+
+        }
+    }
+}
+
+/*
+ * Description :
+ * This function reads the keys typed on the terminal, s shows the counters
+ * and p the table of the profiling probes.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void PingReadTerminal(void)
+{
+    uint8_t data;
+
+    while (UARTReceive((uint32_t)UART0_MODULE, &data))
+    {
+        if ((data == (uint8_t)'s') || (data == (uint8_t)'S'))
+        {
+            PingShowStats();
+            PingShowSummary();
+        }
+
+        else if ((data == (uint8_t)'p') || (data == (uint8_t)'P'))
+        {
+            ProfileDump();
+        }
+
+        else
+        {
+
+        }
+    }
+}
+
+/*
+ * Description :
+ * This function shows the probes sent, received and lost and the round
+ * trip times.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void PingShowSummary(void)
+{
+    Log4(LOG_PING_SUMMARY, pingStats.sent, pingStats.received, pingStats.lost, pingStats.late);
+    Log4(LOG_PING_RTT, pingStats.minUs, pingStats.avgUs, pingStats.maxUs, pingStats.jitterUs);
+}
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function takes the control frames of UART1, the ping frames are
+ * handled here and the others handed to BaudHandleFrame(). It must be
+ * called after BaudInit().
+ * Parameters: None.
+ * Returns: None.
+ */
+void PingInit(void)
+{
+    pingActive = false;
+    pingWaiting = false;
+    (void)memset(&pingStats, 0, sizeof(pingStats));
+
+    ArqSetControlHandler(LINK_PORT_UART1, &PingHandleFrame);
+}
+
+/*
+ * Description :
+ * This function enters the ping state: it enables the links, resets the
+ * ping counters and shows the link counters.
+ * Parameters: None.
+ * Returns: None.
+ */
+void PingRun(void)
+{
+    UARTListen();
+    NetHold(true);
+
+    (void)memset(&pingStats, 0, sizeof(pingStats));
+    pingSumUs = 0U;
+    pingLastUs = 0U;
+    pingJitterX16 = 0U;
+    pingWaiting = false;
+    pingDueUs = PingNow();
+    pingActive = true;
+
+    Log0(LOG_PING_MODE);
+    PingShowStats();
+}
+
+/*
+ * Description :
+ * This function runs the ping state once: it serves the links, sends the
+ * next probe when it is due and shows the replies.
+ * Parameters: None.
+ * Returns: true if it must run again without waiting for an event.
+ */
+bool PingStep(void)
+{
+    bool busy = false;
+
+    PingReadTerminal();
+
+    /* The replies come through the control handler, the messages of the
+     * other boards are held for the chat states */
+    (void)NetPoll();
+
+    PingCheckLost();
+
+    if (PingSendProbe())
+    {
+        busy = true;
+    }
+
+    else
+    {
+
+    }
+
+    return busy || UARTLinkPolling();
+}
+
+/*
+ * Description :
+ * This function leaves the ping state, showing the summary.
+ * Parameters: None.
+ * Returns: None.
+ */
+void PingLeave(void)
+{
+    pingActive = false;
+    pingWaiting = false;
+    NetHold(false);
+
+    PingShowSummary();
+}
+
+/*
+ * Description :
+ * This function handles a control frame received on UART1.
+ * Parameters: frame -> The received control frame.
+ * Returns: None.
+ */
+void PingHandleFrame(const linkFrame_t *frame)
+{
+    if (NULL == frame)
+    {
+        /* Nothing to handle */
+    }
+
+    /* Send the probe back as it came, in any state serving UART1 */
+    else if (frame->type == (uint8_t)LINK_FRAME_PING_REQUEST)
+    {
+        (void)LinkSend(LINK_PORT_UART1, (uint8_t)LINK_FRAME_PING_REPLY, 0U, 0U, frame->payload, frame->length);
+    }
+
+    else if (frame->type == (uint8_t)LINK_FRAME_PING_REPLY)
+    {
+        PingTakeReply(frame);
+    }
+
+    else
+    {
+        BaudHandleFrame(frame);
+    }
+}
+
+/*
+ * Description :
+ * This function shows the counters of the UARTs, the links, the reliable
+ * delivery layer, the network layer and the idle path, and the timing of
+ * the messages sent to each board, on the terminal.
+ * Parameters: None.
+ * Returns: None.
+ */
+void PingShowStats(void)
+{
+    static const uint32_t bases[] = { (uint32_t)UART0_MODULE , (uint32_t)UART1_MODULE
+#if (UART3_LINK_MODE == 1U)
+                                      , (uint32_t)UART3_MODULE
+#endif
+    };
+    /* The number of each UART, UART1 and UART3 being the link ports in turn */
+    static const uint8_t numbers[] = { 0U , 1U , 3U };
+    netStats_t net;
+    powerStats_t power;
+    uint8_t i;
+    uint8_t address;
+
+    for (i = 0U; i < (uint8_t)(sizeof(bases) / sizeof(bases[0])); i++)
+    {
+        uartStats_t uart;
+
+        UARTGetStats(bases[i], &uart);
+        Log3(LOG_UART_BYTES, numbers[i], uart.rxBytes, uart.txBytes);
+        Log4(LOG_UART_ERRORS, uart.rxDropped, uart.rxOverrun, uart.rxBreak, uart.rxParity);
+        Log2(LOG_UART_FRAMING, uart.rxFraming, uart.txRejected);
+    }
+
+    for (i = 0U; i < LINK_PORT_COUNT; i++)
+    {
+        linkStats_t link;
+        arqStats_t arq;
+        uint32_t args[5];
+
+        LinkGetStats(i, &link);
+        ArqGetStats(i, &arq);
+        args[0] = numbers[i + 1U];
+        args[1] = link.framesSent;
+        args[2] = link.framesReceived;
+        args[3] = link.crcErrors;
+        args[4] = link.syncErrors;
+        LogWrite(LOG_LINK_FRAMES, args, 5U);
+        Log4(LOG_ARQ_COUNTERS, arq.retransmits, arq.timeouts, arq.duplicates, arq.acksSent);
+        Log4(LOG_ARQ_GOODPUT, arq.txGoodputBytes, arq.rxGoodputBytes, arq.sessionResets, arq.framesDropped);
+    }
+
+    NetGetStats(&net);
+    Log4(LOG_NET_PACKETS, net.packetsSent, net.packetsReceived, net.forwarded, net.hopLimitDrops + net.queueDrops);
+
+    /* The boards a receipt came from, the others have no timing */
+    for (address = NET_NO_ADDRESS + 1U; address < NET_BROADCAST; address++)
+    {
+        fragTiming_t timing;
+
+        if (FragGetTiming(address, &timing))
+        {
+            uint32_t args[6];
+
+            args[0] = timing.address;
+            args[1] = timing.receipts;
+            args[2] = timing.rttUs;
+            args[3] = timing.minRttUs;
+            args[4] = timing.maxRttUs;
+            args[5] = timing.offsetUs;
+            LogWrite(LOG_FRAG_TIMING, args, 6U);
+        }
+
+        else
+        {
+
+        }
+    }
+
+    PowerGetStats(&power);
+    Log2(LOG_POWER_IDLE, power.sleeps, power.idlePercentX100);
+    Log4(LOG_POWER_WAKE, power.timerWakes, power.wakeLatencyMin, power.wakeLatencyAvg, power.wakeLatencyMax);
+}
+
+/*
+ * Description :
+ * This function copies the ping counters.
+ * Parameters: stats -> A pointer to the structure where the counters will be stored.
+ * Returns: None.
+ */
+void PingGetStats(pingStats_t *stats)
+{
+    if (NULL != stats)
+    {
+        *stats = pingStats;
+    }
+
+    else
+    {
+
+    }
+}
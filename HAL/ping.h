@@ -0,0 +1,145 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   ping.h                                                       *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file for the ping state, timing the UART1 link with   *
+ *                probe frames and showing the link counters                   *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef PING_H_
+#define PING_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "HAL/link.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/*
+ * In the ping state the board sends a LINK_FRAME_PING_REQUEST control frame
+ * on UART1 every PING_PERIOD_MS:
+ *   NUMBER (2 bytes) | SENT (4 bytes)
+ * both most significant byte first, SENT being the low 32 bits of the
+ * timebase in microseconds. The other board, in any state serving UART1,
+ * sends it back at once as a LINK_FRAME_PING_REPLY. Control frames are
+ * neither sequenced nor retransmitted, so the round trip time is the one
+ * of the link and a probe lost on the wires stays lost. One probe is in
+ * flight at a time: it is lost without a reply within PING_TIMEOUT_MS, and
+ * a reply coming later is counted late.
+ * Every reply is shown with its round trip time, and the summary (probes
+ * sent, received, lost, and the minimum, average and maximum round trip
+ * times and the jitter, the mean deviation between consecutive ones as in
+ * RFC 3550) every PING_SUMMARY_COUNT probes and when leaving the state.
+ * Typing s on the terminal shows the counters of the UARTs, the links, the
+ * reliable delivery layer and the network layer, and p the table of the
+ * profiling probes (see profile.h).
+ */
+#define PING_PAYLOAD_LENGTH 6U
+
+#define PING_PERIOD_MS 500U
+#define PING_TIMEOUT_MS 1000U
+#define PING_SUMMARY_COUNT 20U
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Structure holding the ping counters, since entering the state.
+ *              - sent     : Probes sent.
+ *              - received : Replies received in time.
+ *              - lost     : Probes without a reply within PING_TIMEOUT_MS.
+ *              - late     : Replies received after their probe was counted lost.
+ *              - minUs, maxUs : The shortest and longest round trip times.
+ *              - avgUs    : The average round trip time.
+ *              - jitterUs : The mean deviation between consecutive round trip times.
+ */
+typedef struct
+{
+    uint32_t sent;
+    uint32_t received;
+    uint32_t lost;
+    uint32_t late;
+    uint32_t minUs;
+    uint32_t maxUs;
+    uint32_t avgUs;
+    uint32_t jitterUs;
+} pingStats_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function takes the control frames of UART1, the ping frames are
+ * handled here and the others handed to BaudHandleFrame(). It must be
+ * called after BaudInit().
+ * Parameters: None.
+ * Returns: None.
+ */
+void PingInit(void);
+
+/*
+ * Description :
+ * This function enters the ping state: it enables the links, resets the
+ * ping counters and shows the link counters.
+ * Parameters: None.
+ * Returns: None.
+ */
+void PingRun(void);
+
+/*
+ * Description :
+ * This function runs the ping state once: it serves the links, sends the
+ * next probe when it is due and shows the replies.
+ * Parameters: None.
+ * Returns: true if it must run again without waiting for an event.
+ */
+bool PingStep(void);
+
+/*
+ * Description :
+ * This function leaves the ping state, showing the summary.
+ * Parameters: None.
+ * Returns: None.
+ */
+void PingLeave(void);
+
+/*
+ * Description :
+ * This function handles a control frame received on UART1.
+ * Parameters: frame -> The received control frame.
+ * Returns: None.
+ */
+void PingHandleFrame(const linkFrame_t *frame);
+
+/*
+ * Description :
+ * This function shows the counters of the UARTs, the links, the reliable
+ * delivery layer, the network layer and the idle path, and the timing of
+ * the messages sent to each board, on the terminal.
+ * Parameters: None.
+ * Returns: None.
+ */
+void PingShowStats(void);
+
+/*
+ * Description :
+ * This function copies the ping counters.
+ * Parameters: stats -> A pointer to the structure where the counters will be stored.
+ * Returns: None.
+ */
+void PingGetStats(pingStats_t *stats);
+
+#endif /* PING_H_ */
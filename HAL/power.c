@@ -0,0 +1,198 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   power.c                                                      *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the idle path putting the core to sleep      *
+ *                while no work is pending                                     *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <string.h>
+#include "HAL/power.h"
+#include "HAL/timebase.h"
+#include "inc/hw_types.h"
+#include "inc/hw_nvic.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/systick.h"
+#include "driverlib/interrupt.h"
+
+/*******************************************************************************
+ *                            Global Variables                                 *
+ *******************************************************************************/
+/* Cycles since the last reset and cycles spent asleep, updated at every
+ * call from the timebase, which keeps counting while the core sleeps */
+static uint64_t totalCycles = 0U;
+static uint64_t sleepCycles = 0U;
+static uint64_t lastCycles = 0U;
+
+static uint64_t wakeLatencySum = 0U;
+static powerStats_t powerStats;
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static void PowerAccount(void);
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function adds the cycles elapsed since the previous call
+ * to the total time.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void PowerAccount(void)
+{
+    uint64_t now = TimebaseGetCycles();
+
+    totalCycles += now - lastCycles;
+    lastCycles = now;
+}
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function clears the idle measurements, taken with the
+ * timebase. It must be called after TimebaseInit().
+ * Parameters: None.
+ * Returns: None.
+ */
+void PowerInit(void)
+{
+    PowerResetStats();
+}
+
+/*
+ * Description :
+ * This function puts the core to sleep until the next interrupt, unless
+ * work is pending. The check is made with the interrupts masked, so an
+ * interrupt arriving just before WFI still wakes the core at once.
+ * Parameters: workPending -> The function telling whether work is pending.
+ * Returns: None.
+ */
+void PowerIdle(powerWorkPending_t workPending)
+{
+#if (POWER_IDLE_SLEEP == 1U)
+    /* WFI also ends on an interrupt masked by PRIMASK, the interrupt is
+     * then taken as soon as the mask is removed */
+    bool masked = IntMasterDisable();
+
+    PowerAccount();
+
+    if ((NULL != workPending) && !workPending())
+    {
+        uint64_t before = lastCycles;
+
+        SysCtlSleep();
+
+        PowerAccount();
+        sleepCycles += lastCycles - before;
+        powerStats.sleeps++;
+
+        /* The SysTick counter tells how long ago its interrupt was raised */
+        if ((HWREG(NVIC_INT_CTRL) & (uint32_t)NVIC_INT_CTRL_PEND_SYST) != 0U)
+        {
+            uint32_t latency = SysTickPeriodGet() - SysTickValueGet();
+
+            if ((powerStats.timerWakes == 0U) || (latency < powerStats.wakeLatencyMin))
+            {
+                powerStats.wakeLatencyMin = latency;
+            }
+
+            else
+            {
+
+            }
+
+            if (latency > powerStats.wakeLatencyMax)
+            {
+                powerStats.wakeLatencyMax = latency;
+            }
+
+            else
+            {
+
+            }
+
+            wakeLatencySum += (uint64_t)latency;
+            powerStats.timerWakes++;
+        }
+
+        else
+        {
+
+        }
+    }
+
+    else
+    {
+
+    }
+
+    if (!masked)
+    {
+        IntMasterEnable();
+    }
+
+    else
+    {
+
+    }
+#else
+    /* Busy polling, only the elapsed time is accounted */
+    (void)workPending;
+    PowerAccount();
+#endif
+}
+
+/*
+ * Description :
+ * This function copies the idle measurements since the last reset.
+ * Parameters: stats -> A pointer to the structure where the measurements will be stored.
+ * Returns: None.
+ */
+void PowerGetStats(powerStats_t *stats)
+{
+    if (NULL != stats)
+    {
+        PowerAccount();
+
+        *stats = powerStats;
+        stats->idlePercentX100 = (totalCycles != 0U) ? (uint32_t)((sleepCycles * 10000U) / totalCycles) : 0U;
+        stats->wakeLatencyAvg = (powerStats.timerWakes != 0U) ? (uint32_t)(wakeLatencySum / powerStats.timerWakes) : 0U;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function clears the idle measurements.
+ * Parameters: None.
+ * Returns: None.
+ */
+void PowerResetStats(void)
+{
+    lastCycles = TimebaseGetCycles();
+    totalCycles = 0U;
+    sleepCycles = 0U;
+    wakeLatencySum = 0U;
+    (void)memset(&powerStats, 0, sizeof(powerStats));
+}
@@ -0,0 +1,107 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   power.h                                                      *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file for the idle path putting the core to sleep      *
+ *                while no work is pending                                     *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef POWER_H_
+#define POWER_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* Idle configuration:
+ * POWER_IDLE_SLEEP stops the core clock with WFI (sleep mode) while no work
+ * is pending when 1U, or keeps polling when 0U, to compare both. Sleep mode
+ * keeps every peripheral clocked at the run mode frequency, so the UARTs,
+ * the uDMA controller, the GPIOs and SysTick go on working and any of their
+ * interrupts wakes the core within the usual exception entry time. Deep
+ * sleep is not used: it moves the peripherals to another clock, which
+ * would change the UART baud rates. */
+#define POWER_IDLE_SLEEP 1U
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Pointer to the function telling whether work is pending,
+ *              it is called with the interrupts masked.
+ */
+typedef bool (*powerWorkPending_t)(void);
+
+/*
+ * Description: Structure holding the idle measurements.
+ *              - sleeps              : Times the core went to sleep.
+ *              - idlePercentX100     : Share of the time spent asleep, in 1/100 %.
+ *              - timerWakes          : Wake-ups caused by SysTick, the only ones
+ *                                      whose interrupt time is known.
+ *              - wakeLatencyMin      : Fastest SysTick wake-up, in CPU cycles from
+ *                                      the SysTick event to the end of WFI.
+ *              - wakeLatencyMax      : Slowest SysTick wake-up, in CPU cycles.
+ *              - wakeLatencyAvg      : Average SysTick wake-up, in CPU cycles.
+ */
+typedef struct
+{
+    uint32_t sleeps;
+    uint32_t idlePercentX100;
+    uint32_t timerWakes;
+    uint32_t wakeLatencyMin;
+    uint32_t wakeLatencyMax;
+    uint32_t wakeLatencyAvg;
+} powerStats_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function clears the idle measurements, taken with the
+ * timebase. It must be called after TimebaseInit().
+ * Parameters: None.
+ * Returns: None.
+ */
+void PowerInit(void);
+
+/*
+ * Description :
+ * This function puts the core to sleep until the next interrupt, unless
+ * work is pending. The check is made with the interrupts masked, so an
+ * interrupt arriving just before WFI still wakes the core at once.
+ * Parameters: workPending -> The function telling whether work is pending.
+ * Returns: None.
+ */
+void PowerIdle(powerWorkPending_t workPending);
+
+/*
+ * Description :
+ * This function copies the idle measurements since the last reset.
+ * Parameters: stats -> A pointer to the structure where the measurements will be stored.
+ * Returns: None.
+ */
+void PowerGetStats(powerStats_t *stats);
+
+/*
+ * Description :
+ * This function clears the idle measurements.
+ * Parameters: None.
+ * Returns: None.
+ */
+void PowerResetStats(void);
+
+#endif /* POWER_H_ */
@@ -0,0 +1,278 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   profile.c                                                    *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the profiler, counting the CPU cycles of     *
+ *                the hot paths with the DWT cycle counter                     *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <string.h>
+#include "HAL/profile.h"
+#include "HAL/UART_API.h"
+#include "HAL/clock.h"
+#include "driverlib/interrupt.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* Empty probes run to measure the cost of the two cycle counter reads */
+#define PROFILE_CALIBRATION_RUNS 8U
+
+/*******************************************************************************
+ *                            Global Variables                                 *
+ *******************************************************************************/
+#if (PROFILE_MODE == 1U)
+/* The counters of every probe, each one written by a single ISR or by
+ * the main loop only */
+static profileStats_t profileStats[PROFILE_PROBE_COUNT];
+
+/* The cycles an empty probe counts, taken off every run */
+static uint32_t profileOverhead = 0U;
+
+/* The names of the probes, in the order of profileProbe_t */
+static const char *const profileNames[PROFILE_PROBE_COUNT] = {
+                "SendReceive" ,
+                "UARTprint" ,
+                "SysticISR" ,
+                "ButtonISR" ,
+                "UART0ISR" ,
+                "UART1ISR" ,
+                "UART3ISR"
+};
+#endif
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+#if (PROFILE_MODE == 1U)
+static void ProfilePrintRow(const char *name, const profileStats_t *stats);
+#endif
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+#if (PROFILE_MODE == 1U)
+/*
+ * Description :
+ * This function prints the line of a probe: its name, the runs, the
+ * minimum, mean and maximum cycles, then the runs in every histogram bin.
+ * Parameters: name  -> The name of the probe.
+ *             stats -> The counters of the probe.
+ * Returns: None.
+ */
+static void ProfilePrintRow(const char *name, const profileStats_t *stats)
+{
+    uint8_t i;
+
+    UARTprint(name);
+    UARTprint("\t");
+    UARTprintDecimal(stats->count);
+    UARTprint("\t");
+    UARTprintDecimal(stats->minCycles);
+    UARTprint("\t");
+    UARTprintDecimal((stats->count != 0U) ? (uint32_t)(stats->totalCycles / stats->count) : 0U);
+    UARTprint("\t");
+    UARTprintDecimal(stats->maxCycles);
+
+    for (i = 0U; i < PROFILE_HISTOGRAM_BINS; i++)
+    {
+        UARTprint((i == 0U) ? "\t" : "/");
+        UARTprintDecimal(stats->histogram[i]);
+    }
+
+    UARTprint("\n\r");
+}
+#endif
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function starts the cycle counter, measures the cost of a probe
+ * and clears the counters of every probe.
+ * Parameters: None.
+ * Returns: None.
+ */
+void ProfileInit(void)
+{
+    CycleCounterInit();
+
+#if (PROFILE_MODE == 1U)
+    {
+        uint8_t i;
+
+        /* The cheapest of a few empty probes, an interrupt may lengthen one */
+        profileOverhead = UINT32_MAX;
+
+        for (i = 0U; i < PROFILE_CALIBRATION_RUNS; i++)
+        {
+            uint32_t start = CYCLE_COUNTER_GET();
+            uint32_t cycles = CYCLE_COUNTER_GET() - start;
+
+            profileOverhead = (cycles < profileOverhead) ? cycles : profileOverhead;
+        }
+    }
+#endif
+
+    ProfileReset();
+}
+
+/*
+ * Description :
+ * This function counts a run in a probe, it may be called from an ISR.
+ * Parameters: probe  -> The probe (PROFILE_PROBE_xxx).
+ *             cycles -> The CPU cycles of the run, with the cost of the probe.
+ * Returns: None.
+ */
+void ProfileRecord(profileProbe_t probe, uint32_t cycles)
+{
+#if (PROFILE_MODE == 1U)
+    if (probe < PROFILE_PROBE_COUNT)
+    {
+        profileStats_t *stats = &profileStats[probe];
+        uint32_t limit = PROFILE_HISTOGRAM_FIRST;
+        uint8_t bin = 0U;
+
+        cycles = (cycles > profileOverhead) ? (cycles - profileOverhead) : 0U;
+
+        while ((bin < (PROFILE_HISTOGRAM_BINS - 1U)) && (cycles >= limit))
+        {
+            limit <<= PROFILE_HISTOGRAM_SHIFT;
+            bin++;
+        }
+
+        stats->minCycles = ((stats->count == 0U) || (cycles < stats->minCycles)) ? cycles : stats->minCycles;
+        stats->maxCycles = (cycles > stats->maxCycles) ? cycles : stats->maxCycles;
+        stats->totalCycles += cycles;
+        stats->histogram[bin]++;
+        stats->count++;
+    }
+
+    else
+    {
+
+    }
+#else
+    (void)probe;
+    (void)cycles;
+#endif
+}
+
+/*
+ * Description :
+ * This function clears the counters of every probe.
+ * Parameters: None.
+ * Returns: None.
+ */
+void ProfileReset(void)
+{
+#if (PROFILE_MODE == 1U)
+    bool masked = IntMasterDisable();
+
+    (void)memset(profileStats, 0, sizeof(profileStats));
+
+    if (!masked)
+    {
+        IntMasterEnable();
+    }
+
+    else
+    {
+
+    }
+#endif
+}
+
+/*
+ * Description :
+ * This function copies the counters of a probe.
+ * Parameters: probe -> The probe (PROFILE_PROBE_xxx).
+ *             stats -> A pointer to the structure where the counters will be stored.
+ * Returns: true if the probe exists and PROFILE_MODE is set, false otherwise.
+ */
+bool ProfileGetStats(profileProbe_t probe, profileStats_t *stats)
+{
+    bool copied = false;
+
+#if (PROFILE_MODE == 1U)
+    if ((probe < PROFILE_PROBE_COUNT) && (NULL != stats))
+    {
+        /* An ISR must not count a run halfway through the copy */
+        bool masked = IntMasterDisable();
+
+        *stats = profileStats[probe];
+
+        if (!masked)
+        {
+            IntMasterEnable();
+        }
+
+        else
+        {
+
+        }
+
+        copied = true;
+    }
+
+    else
+    {
+
+    }
+#else
+    (void)probe;
+    (void)stats;
+#endif
+
+    return copied;
+}
+
+/*
+ * Description :
+ * This function prints the table of the probes on the terminal: the runs,
+ * the minimum, mean and maximum cycles and the histogram of each one.
+ * Parameters: None.
+ * Returns: None.
+ */
+void ProfileDump(void)
+{
+#if (PROFILE_MODE == 1U)
+    uint32_t limit = PROFILE_HISTOGRAM_FIRST;
+    uint8_t i;
+
+    UARTprint("Profile, CPU cycles at ");
+    UARTprintDecimal(ClockGetHz());
+    UARTprint(" Hz, histogram bins below ");
+
+    for (i = 0U; i < (PROFILE_HISTOGRAM_BINS - 1U); i++)
+    {
+        UARTprintDecimal(limit);
+        UARTprint((i < (PROFILE_HISTOGRAM_BINS - 2U)) ? "/" : " and above\n\r");
+        limit <<= PROFILE_HISTOGRAM_SHIFT;
+    }
+
+    UARTprint("Probe\tRuns\tMin\tMean\tMax\tHistogram\n\r");
+
+    for (i = 0U; i < (uint8_t)PROFILE_PROBE_COUNT; i++)
+    {
+        profileStats_t stats;
+
+        (void)ProfileGetStats((profileProbe_t)i, &stats);
+        ProfilePrintRow(profileNames[i], &stats);
+    }
+#else
+    UARTprint("Profile : build with PROFILE_MODE set to 1U\n\r");
+#endif
+}
@@ -0,0 +1,152 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   profile.h                                                    *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file for the profiler, counting the CPU cycles of     *
+ *                the hot paths with the DWT cycle counter                     *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "HAL/cycle_counter.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* Profiler configuration:
+ * PROFILE_MODE keeps the probes in the code when 1U. Each probe is a
+ * PROFILE_START() / PROFILE_STOP() pair around the code measured: the
+ * cycle counter is read at both ends and the difference, less the cost of
+ * the two reads, goes into the counters of the probe. The time includes
+ * the functions called and the interrupts taken in between, so the probe
+ * of an ISR preempted by another one, or of the main loop, may show it in
+ * its maximum. When 0U the probes expand to nothing and the profiler
+ * takes no RAM. The host simulation build sets it from the command line. */
+#ifndef PROFILE_MODE
+#define PROFILE_MODE 0U
+#endif
+
+/* Histogram of every probe: the first bin counts the runs shorter than
+ * PROFILE_HISTOGRAM_FIRST cycles, each next bin 2^PROFILE_HISTOGRAM_SHIFT
+ * times longer ones, and the last one every longer run */
+#define PROFILE_HISTOGRAM_BINS 8U
+#define PROFILE_HISTOGRAM_FIRST 64U
+#define PROFILE_HISTOGRAM_SHIFT 2U
+
+/*
+ * PROFILE_START(start) declares the variable start holding the cycle count
+ * the probe starts at, after the other declarations of the block.
+ * PROFILE_STOP(probe, start) counts the cycles since then in the probe.
+ */
+#if (PROFILE_MODE == 1U)
+#define PROFILE_START(start) uint32_t start = CYCLE_COUNTER_GET()
+#define PROFILE_STOP(probe, start) ProfileRecord((probe), CYCLE_COUNTER_GET() - (start))
+#else
+#define PROFILE_START(start)
+#define PROFILE_STOP(probe, start)
+#endif
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Enum describing the probes, their names are in profile.c.
+ *              - PROFILE_PROBE_SEND_RECEIVE : A run of the send and receive state.
+ *              - PROFILE_PROBE_PRINT        : UARTprint().
+ *              - PROFILE_PROBE_SYSTICK_ISR  : SysticISR().
+ *              - PROFILE_PROBE_BUTTON_ISR   : The GPIO ISR of the buttons.
+ *              - PROFILE_PROBE_UART0_ISR    : UART0ISR().
+ *              - PROFILE_PROBE_UART1_ISR    : UART1ISR().
+ *              - PROFILE_PROBE_UART3_ISR    : UART3ISR().
+ */
+typedef enum
+{
+    PROFILE_PROBE_SEND_RECEIVE,
+    PROFILE_PROBE_PRINT,
+    PROFILE_PROBE_SYSTICK_ISR,
+    PROFILE_PROBE_BUTTON_ISR,
+    PROFILE_PROBE_UART0_ISR,
+    PROFILE_PROBE_UART1_ISR,
+    PROFILE_PROBE_UART3_ISR,
+    PROFILE_PROBE_COUNT
+} profileProbe_t;
+
+/*
+ * Description: Structure holding the counters of a probe.
+ *              - count       : Runs measured.
+ *              - minCycles   : Shortest run, in CPU cycles.
+ *              - maxCycles   : Longest run, in CPU cycles.
+ *              - totalCycles : Cycles of every run, the mean being totalCycles / count.
+ *              - histogram   : Runs per length (see PROFILE_HISTOGRAM_FIRST).
+ */
+typedef struct
+{
+    uint32_t count;
+    uint32_t minCycles;
+    uint32_t maxCycles;
+    uint64_t totalCycles;
+    uint32_t histogram[PROFILE_HISTOGRAM_BINS];
+} profileStats_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function starts the cycle counter, measures the cost of a probe
+ * and clears the counters of every probe.
+ * Parameters: None.
+ * Returns: None.
+ */
+void ProfileInit(void);
+
+/*
+ * Description :
+ * This function counts a run in a probe, it may be called from an ISR.
+ * Parameters: probe  -> The probe (PROFILE_PROBE_xxx).
+ *             cycles -> The CPU cycles of the run, with the cost of the probe.
+ * Returns: None.
+ */
+void ProfileRecord(profileProbe_t probe, uint32_t cycles);
+
+/*
+ * Description :
+ * This function clears the counters of every probe.
+ * Parameters: None.
+ * Returns: None.
+ */
+void ProfileReset(void);
+
+/*
+ * Description :
+ * This function copies the counters of a probe.
+ * Parameters: probe -> The probe (PROFILE_PROBE_xxx).
+ *             stats -> A pointer to the structure where the counters will be stored.
+ * Returns: true if the probe exists and PROFILE_MODE is set, false otherwise.
+ */
+bool ProfileGetStats(profileProbe_t probe, profileStats_t *stats);
+
+/*
+ * Description :
+ * This function prints the table of the probes on the terminal: the runs,
+ * the minimum, mean and maximum cycles and the histogram of each one.
+ * Parameters: None.
+ * Returns: None.
+ */
+void ProfileDump(void);
+
+#endif /* PROFILE_H_ */
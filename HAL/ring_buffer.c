@@ -0,0 +1,175 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   ring_buffer.c                                                *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        16/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the single-producer/single-consumer          *
+ *                byte ring buffer shared between ISRs and the main loop       *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include "HAL/ring_buffer.h"
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function attaches a storage array to the ring buffer and empties it.
+ * Parameters: rb      -> A pointer to the ring buffer to be initialized.
+ *             storage -> The storage array used by the ring buffer.
+ *             size    -> The storage size in bytes, must be a power of two
+ *                        and not greater than 32768.
+ * Returns: None.
+ */
+void RingBufferInit(ringBuffer_t *rb, volatile uint8_t *storage, uint16_t size)
+{
+    rb->buffer = storage;
+    rb->mask = (uint16_t)(size - 1U);
+    rb->head = 0U;
+    rb->tail = 0U;
+}
+
+/*
+ * Description :
+ * This function stores one byte in the ring buffer (producer side).
+ * Parameters: rb   -> A pointer to the ring buffer.
+ *             data -> The byte to be stored.
+ * Returns: true if the byte was stored, false if the ring buffer is full.
+ */
+bool RingBufferPut(ringBuffer_t *rb, uint8_t data)
+{
+    bool stored = false;
+    uint16_t head = rb->head;
+
+    if ((uint16_t)(head - rb->tail) <= rb->mask)
+    {
+        /* Write the data before publishing the new head to the consumer */
+        rb->buffer[head & rb->mask] = data;
+        rb->head = (uint16_t)(head + 1U);
+        stored = true;
+    }
+
+    else
+    {
+
+    }
+
+    return stored;
+}
+
+/*
+ * Description :
+ * This function removes the oldest byte from the ring buffer (consumer side).
+ * Parameters: rb   -> A pointer to the ring buffer.
+ *             data -> A pointer to the variable where the byte will be stored.
+ * Returns: true if a byte was read, false if the ring buffer is empty.
+ */
+bool RingBufferGet(ringBuffer_t *rb, uint8_t *data)
+{
+    bool read = false;
+    uint16_t tail = rb->tail;
+
+    if (tail != rb->head)
+    {
+        /* Read the data before releasing the slot to the producer */
+        *data = rb->buffer[tail & rb->mask];
+        rb->tail = (uint16_t)(tail + 1U);
+        read = true;
+    }
+
+    else
+    {
+
+    }
+
+    return read;
+}
+
+/*
+ * Description :
+ * This function returns the number of bytes stored in the ring buffer.
+ * Parameters: rb -> A pointer to the ring buffer.
+ * Returns: The number of stored bytes.
+ */
+uint16_t RingBufferCount(const ringBuffer_t *rb)
+{
+    return (uint16_t)(rb->head - rb->tail);
+}
+
+/*
+ * Description :
+ * This function returns the number of free bytes in the ring buffer.
+ * Parameters: rb -> A pointer to the ring buffer.
+ * Returns: The number of free bytes.
+ */
+uint16_t RingBufferFree(const ringBuffer_t *rb)
+{
+    return (uint16_t)((rb->mask + 1U) - RingBufferCount(rb));
+}
+
+/*
+ * Description :
+ * This function gives direct access to the oldest stored bytes that are
+ * contiguous in memory (consumer side), so a DMA channel can read them
+ * in place. The bytes stay stored until released with RingBufferSkip().
+ * Parameters: rb   -> A pointer to the ring buffer.
+ *             data -> A pointer to the variable where the address of the
+ *                     oldest byte will be stored.
+ * Returns: The number of contiguous bytes starting at that address.
+ */
+uint16_t RingBufferPeekContiguous(const ringBuffer_t *rb, volatile uint8_t **data)
+{
+    uint16_t index = (uint16_t)(rb->tail & rb->mask);
+    uint16_t count = RingBufferCount(rb);
+    uint16_t untilEnd = (uint16_t)((rb->mask + 1U) - index);
+
+    /* Stop at the end of the storage array, the rest starts over at index 0 */
+    if (count > untilEnd)
+    {
+        count = untilEnd;
+    }
+
+    else
+    {
+
+    }
+
+    *data = &rb->buffer[index];
+
+    return count;
+}
+
+/*
+ * Description :
+ * This function releases the oldest stored bytes (consumer side).
+ * Parameters: rb    -> A pointer to the ring buffer.
+ *             count -> The number of bytes to be released, it must not be
+ *                      greater than the number of stored bytes.
+ * Returns: None.
+ */
+void RingBufferSkip(ringBuffer_t *rb, uint16_t count)
+{
+    rb->tail = (uint16_t)(rb->tail + count);
+}
+
+/*
+ * Description :
+ * This function empties the ring buffer, it must only be called while
+ * neither the producer nor the consumer is running.
+ * Parameters: rb -> A pointer to the ring buffer.
+ * Returns: None.
+ */
+void RingBufferFlush(ringBuffer_t *rb)
+{
+    rb->tail = rb->head;
+}
@@ -0,0 +1,125 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   ring_buffer.h                                                *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        16/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file for the single-producer/single-consumer          *
+ *                byte ring buffer shared between ISRs and the main loop       *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef RING_BUFFER_H_
+#define RING_BUFFER_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Structure representing a lock-free SPSC byte ring buffer.
+ *              - buffer : The storage array, its size must be a power of two.
+ *              - mask   : The storage size minus one, used to wrap the indices.
+ *              - head   : Free running write index, modified by the producer only.
+ *              - tail   : Free running read index, modified by the consumer only.
+ *              The number of stored bytes is always (head - tail), so no lock
+ *              is needed as long as there is exactly one producer and one consumer.
+ */
+typedef struct
+{
+    volatile uint8_t *buffer;
+    uint16_t mask;
+    volatile uint16_t head;
+    volatile uint16_t tail;
+} ringBuffer_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function attaches a storage array to the ring buffer and empties it.
+ * Parameters: rb      -> A pointer to the ring buffer to be initialized.
+ *             storage -> The storage array used by the ring buffer.
+ *             size    -> The storage size in bytes, must be a power of two
+ *                        and not greater than 32768.
+ * Returns: None.
+ */
+void RingBufferInit(ringBuffer_t *rb, volatile uint8_t *storage, uint16_t size);
+
+/*
+ * Description :
+ * This function stores one byte in the ring buffer (producer side).
+ * Parameters: rb   -> A pointer to the ring buffer.
+ *             data -> The byte to be stored.
+ * Returns: true if the byte was stored, false if the ring buffer is full.
+ */
+bool RingBufferPut(ringBuffer_t *rb, uint8_t data);
+
+/*
+ * Description :
+ * This function removes the oldest byte from the ring buffer (consumer side).
+ * Parameters: rb   -> A pointer to the ring buffer.
+ *             data -> A pointer to the variable where the byte will be stored.
+ * Returns: true if a byte was read, false if the ring buffer is empty.
+ */
+bool RingBufferGet(ringBuffer_t *rb, uint8_t *data);
+
+/*
+ * Description :
+ * This function returns the number of bytes stored in the ring buffer.
+ * Parameters: rb -> A pointer to the ring buffer.
+ * Returns: The number of stored bytes.
+ */
+uint16_t RingBufferCount(const ringBuffer_t *rb);
+
+/*
+ * Description :
+ * This function returns the number of free bytes in the ring buffer.
+ * Parameters: rb -> A pointer to the ring buffer.
+ * Returns: The number of free bytes.
+ */
+uint16_t RingBufferFree(const ringBuffer_t *rb);
+
+/*
+ * Description :
+ * This function gives direct access to the oldest stored bytes that are
+ * contiguous in memory (consumer side), so a DMA channel can read them
+ * in place. The bytes stay stored until released with RingBufferSkip().
+ * Parameters: rb   -> A pointer to the ring buffer.
+ *             data -> A pointer to the variable where the address of the
+ *                     oldest byte will be stored.
+ * Returns: The number of contiguous bytes starting at that address.
+ */
+uint16_t RingBufferPeekContiguous(const ringBuffer_t *rb, volatile uint8_t **data);
+
+/*
+ * Description :
+ * This function releases the oldest stored bytes (consumer side).
+ * Parameters: rb    -> A pointer to the ring buffer.
+ *             count -> The number of bytes to be released, it must not be
+ *                      greater than the number of stored bytes.
+ * Returns: None.
+ */
+void RingBufferSkip(ringBuffer_t *rb, uint16_t count);
+
+/*
+ * Description :
+ * This function empties the ring buffer, it must only be called while
+ * neither the producer nor the consumer is running.
+ * Parameters: rb -> A pointer to the ring buffer.
+ * Returns: None.
+ */
+void RingBufferFlush(ringBuffer_t *rb);
+
+#endif /* RING_BUFFER_H_ */
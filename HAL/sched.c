@@ -0,0 +1,399 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   sched.c                                                      *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the event scheduler, running the handlers    *
+ *                of the events posted by the ISRs to completion by priority   *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <string.h>
+#include "HAL/sched.h"
+#include "HAL/switch.h"
+#include "HAL/power.h"
+#include "HAL/cycle_counter.h"
+#include "HAL/trace.h"
+#include "driverlib/interrupt.h"
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Structure representing a timer.
+ *              - active      : The timer runs.
+ *              - periodic    : The timer starts again once it posted its event.
+ *              - event       : The event it posts.
+ *              - periodTicks : Its delay in SysTick periods.
+ *              - dueTick     : The SysTick count it posts its event at.
+ */
+typedef struct
+{
+    bool active;
+    bool periodic;
+    schedEvent_t event;
+    uint32_t periodTicks;
+    uint32_t dueTick;
+} schedTimer_t;
+
+/*******************************************************************************
+ *                            Global Variables                                 *
+ *******************************************************************************/
+/* One bit per pending event, set by the ISRs, and the cycle count
+ * each one was posted at */
+static volatile uint32_t pendingEvents = 0U;
+static volatile uint32_t postedAt[SCHED_EVENT_COUNT];
+
+static schedHandler_t handlers[SCHED_EVENT_COUNT];
+
+static schedTimer_t timers[SCHED_TIMER_COUNT];
+
+static schedStats_t schedStats;
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static bool SchedTimerDue(const schedTimer_t *timer, uint32_t now);
+static void SchedTimersPoll(void);
+static bool SchedWorkPending(void);
+static bool SchedTake(schedEvent_t *event, uint32_t *waitCycles);
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function tells whether a timer must post its event.
+ * Parameters: timer -> The timer.
+ *             now   -> The current SysTick count.
+ * Returns: true if the timer runs and its time came.
+ */
+static bool SchedTimerDue(const schedTimer_t *timer, uint32_t now)
+{
+    /* The difference is read signed so the SysTick count may wrap */
+    return timer->active && ((int32_t)(now - timer->dueTick) >= 0);
+}
+
+/*
+ * Description :
+ * This function posts the events of the timers whose time came. A
+ * periodic timer late by more than its period skips the missed posts.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void SchedTimersPoll(void)
+{
+    uint32_t now = SysticGetTicks();
+    uint8_t i;
+
+    for (i = 0U; i < SCHED_TIMER_COUNT; i++)
+    {
+        schedTimer_t *timer = &timers[i];
+
+        if (SchedTimerDue(timer, now))
+        {
+            SchedPost(timer->event);
+            timer->active = timer->periodic;
+            timer->dueTick += timer->periodTicks;
+
+            if (SchedTimerDue(timer, now))
+            {
+                timer->dueTick = now + timer->periodTicks;
+            }
+
+            else
+            {
+
+            }
+        }
+
+        else
+        {
+
+        }
+    }
+}
+
+/*
+ * Description :
+ * This function tells the idle path whether an event is pending or a
+ * timer is due, the SysTick count only moves in an interrupt waking the core.
+ * Parameters: None.
+ * Returns: true if work is pending.
+ */
+static bool SchedWorkPending(void)
+{
+    uint32_t now = SysticGetTicks();
+    bool pending = (pendingEvents != 0U);
+    uint8_t i;
+
+    for (i = 0U; (i < SCHED_TIMER_COUNT) && !pending; i++)
+    {
+        pending = SchedTimerDue(&timers[i], now);
+    }
+
+    return pending;
+}
+
+/*
+ * Description :
+ * This function takes the pending event of highest priority out of the
+ * pending events, with the interrupts masked.
+ * Parameters: event      -> Where the event is stored.
+ *             waitCycles -> Where the time since it was posted is stored.
+ * Returns: true if an event was pending.
+ */
+static bool SchedTake(schedEvent_t *event, uint32_t *waitCycles)
+{
+    bool masked = IntMasterDisable();
+    uint32_t pending = pendingEvents;
+    bool taken = false;
+    uint32_t i;
+
+    for (i = 0U; (i < (uint32_t)SCHED_EVENT_COUNT) && !taken; i++)
+    {
+        if ((pending & (1UL << i)) != 0U)
+        {
+            pendingEvents = pending & ~(1UL << i);
+            *event = (schedEvent_t)i;
+            *waitCycles = CYCLE_COUNTER_GET() - postedAt[i];
+            taken = true;
+        }
+
+        else
+        {
+
+        }
+    }
+
+    if (!masked)
+    {
+        IntMasterEnable();
+    }
+
+    else
+    {
+
+    }
+
+    return taken;
+}
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function clears the pending events, the handlers, the timers
+ * and the counters.
+ * Parameters: None.
+ * Returns: None.
+ */
+void SchedInit(void)
+{
+    bool masked = IntMasterDisable();
+
+    pendingEvents = 0U;
+
+    if (!masked)
+    {
+        IntMasterEnable();
+    }
+
+    else
+    {
+
+    }
+
+    (void)memset(handlers, 0, sizeof(handlers));
+    (void)memset(timers, 0, sizeof(timers));
+    (void)memset(&schedStats, 0, sizeof(schedStats));
+
+    /* The cycle counter stamps the events */
+    CycleCounterInit();
+}
+
+/*
+ * Description :
+ * This function sets the handler of an event, a handler may serve several events.
+ * Parameters: event   -> The event (SCHED_EVENT_xxx).
+ *             handler -> The function to run, NULL to ignore the event.
+ * Returns: None.
+ */
+void SchedSubscribe(schedEvent_t event, schedHandler_t handler)
+{
+    if (event < SCHED_EVENT_COUNT)
+    {
+        handlers[event] = handler;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function marks an event pending, it may be called from an ISR.
+ * Parameters: event -> The event (SCHED_EVENT_xxx).
+ * Returns: None.
+ */
+void SchedPost(schedEvent_t event)
+{
+    if (event < SCHED_EVENT_COUNT)
+    {
+        bool masked = IntMasterDisable();
+
+        /* The wait is counted from the first post */
+        if ((pendingEvents & (1UL << (uint32_t)event)) == 0U)
+        {
+            postedAt[event] = CYCLE_COUNTER_GET();
+            pendingEvents |= (1UL << (uint32_t)event);
+            TRACE_INSTANT(TRACE_EVENT_POST, event);
+        }
+
+        else
+        {
+
+        }
+
+        if (!masked)
+        {
+            IntMasterEnable();
+        }
+
+        else
+        {
+
+        }
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function starts a timer posting an event.
+ * Parameters: timer    -> The timer, from 0 up to SCHED_TIMER_COUNT - 1.
+ *             event    -> The event to post (SCHED_EVENT_xxx).
+ *             delayMs  -> The delay, rounded up to whole SysTick periods.
+ *             periodic -> Post the event again every delayMs when true, once when false.
+ * Returns: None.
+ */
+void SchedTimerStart(uint8_t timer, schedEvent_t event, uint32_t delayMs, bool periodic)
+{
+    if ((timer < SCHED_TIMER_COUNT) && (event < SCHED_EVENT_COUNT))
+    {
+        uint32_t ticks = (delayMs + SYSTICK_PERIOD_MS - 1U) / SYSTICK_PERIOD_MS;
+
+        timers[timer].event = event;
+        timers[timer].periodic = periodic;
+        timers[timer].periodTicks = (ticks != 0U) ? ticks : 1U;
+        timers[timer].dueTick = SysticGetTicks() + timers[timer].periodTicks;
+        timers[timer].active = true;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function stops a timer.
+ * Parameters: timer -> The timer, from 0 up to SCHED_TIMER_COUNT - 1.
+ * Returns: None.
+ */
+void SchedTimerStop(uint8_t timer)
+{
+    if (timer < SCHED_TIMER_COUNT)
+    {
+        timers[timer].active = false;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function runs the handlers of the pending events by priority,
+ * and sleeps while no event is pending. It never returns.
+ * Parameters: None.
+ * Returns: None.
+ */
+void SchedRun(void)
+{
+    while (1)
+    {
+        schedEvent_t event = SCHED_EVENT_BUTTON;
+        uint32_t waitCycles = 0U;
+
+        SchedTimersPoll();
+
+        if (SchedTake(&event, &waitCycles))
+        {
+            uint32_t start = CYCLE_COUNTER_GET();
+            uint32_t runCycles;
+
+            TRACE_BEGIN(TRACE_EVENT_HANDLER, event);
+
+            if (NULL != handlers[event])
+            {
+                handlers[event]();
+            }
+
+            else
+            {
+
+            }
+
+            TRACE_END(TRACE_EVENT_HANDLER, event);
+            runCycles = CYCLE_COUNTER_GET() - start;
+            schedStats.dispatched[event]++;
+            schedStats.maxWaitCycles = (waitCycles > schedStats.maxWaitCycles) ? waitCycles : schedStats.maxWaitCycles;
+            schedStats.maxRunCycles = (runCycles > schedStats.maxRunCycles) ? runCycles : schedStats.maxRunCycles;
+        }
+
+        /* Sleep until the next interrupt posts an event or a timer is due */
+        else
+        {
+            PowerIdle(&SchedWorkPending);
+        }
+    }
+}
+
+/*
+ * Description :
+ * This function copies the scheduler counters.
+ * Parameters: stats -> A pointer to the structure where the counters will be stored.
+ * Returns: None.
+ */
+void SchedGetStats(schedStats_t *stats)
+{
+    if (NULL != stats)
+    {
+        *stats = schedStats;
+    }
+
+    else
+    {
+
+    }
+}
@@ -0,0 +1,148 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   sched.h                                                      *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file for the event scheduler, running the handlers    *
+ *                of the events posted by the ISRs to completion by priority   *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef SCHED_H_
+#define SCHED_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/*
+ * An event is posted by an ISR or a handler and stays pending until its
+ * handler runs, posting it again meanwhile does not queue it twice. The
+ * main loop (SchedRun()) runs the handler of the pending event of highest
+ * priority to completion, then looks again, and sleeps (PowerIdle()) when
+ * nothing is pending. A handler with more work than it should do at once
+ * posts SCHED_EVENT_WORK, so events of higher priority are served in
+ * between: the wait of an event is bounded by the longest handler run.
+ * The timers post an event after a delay, once or periodically, with the
+ * SysTick resolution (SYSTICK_PERIOD_MS).
+ */
+/* Timers available to SchedTimerStart() */
+#define SCHED_TIMER_COUNT 4U
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Enum describing the events, from the highest priority.
+ *              - SCHED_EVENT_BUTTON   : The button selected another state (SysTick ISR).
+ *              - SCHED_EVENT_LINK     : Bytes arrived from another board (UART1, UART3 ISRs).
+ *              - SCHED_EVENT_TERMINAL : Bytes arrived from the PC terminal (UART0 ISR).
+ *              - SCHED_EVENT_TICK     : The timers of the protocols are due (a scheduler timer).
+ *              - SCHED_EVENT_WORK     : A handler has more work to do.
+ */
+typedef enum
+{
+    SCHED_EVENT_BUTTON,
+    SCHED_EVENT_LINK,
+    SCHED_EVENT_TERMINAL,
+    SCHED_EVENT_TICK,
+    SCHED_EVENT_WORK,
+    SCHED_EVENT_COUNT
+} schedEvent_t;
+
+/*
+ * Description: Pointer to the function handling an event, it runs to completion.
+ */
+typedef void (*schedHandler_t)(void);
+
+/*
+ * Description: Structure holding the scheduler counters.
+ *              - dispatched    : Handler runs, per event.
+ *              - maxWaitCycles : Longest time an event waited for its handler, in
+ *                                CPU cycles from its posting.
+ *              - maxRunCycles  : Longest handler run, in CPU cycles.
+ */
+typedef struct
+{
+    uint32_t dispatched[SCHED_EVENT_COUNT];
+    uint32_t maxWaitCycles;
+    uint32_t maxRunCycles;
+} schedStats_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function clears the pending events, the handlers, the timers
+ * and the counters.
+ * Parameters: None.
+ * Returns: None.
+ */
+void SchedInit(void);
+
+/*
+ * Description :
+ * This function sets the handler of an event, a handler may serve several events.
+ * Parameters: event   -> The event (SCHED_EVENT_xxx).
+ *             handler -> The function to run, NULL to ignore the event.
+ * Returns: None.
+ */
+void SchedSubscribe(schedEvent_t event, schedHandler_t handler);
+
+/*
+ * Description :
+ * This function marks an event pending, it may be called from an ISR.
+ * Parameters: event -> The event (SCHED_EVENT_xxx).
+ * Returns: None.
+ */
+void SchedPost(schedEvent_t event);
+
+/*
+ * Description :
+ * This function starts a timer posting an event.
+ * Parameters: timer    -> The timer, from 0 up to SCHED_TIMER_COUNT - 1.
+ *             event    -> The event to post (SCHED_EVENT_xxx).
+ *             delayMs  -> The delay, rounded up to whole SysTick periods.
+ *             periodic -> Post the event again every delayMs when true, once when false.
+ * Returns: None.
+ */
+void SchedTimerStart(uint8_t timer, schedEvent_t event, uint32_t delayMs, bool periodic);
+
+/*
+ * Description :
+ * This function stops a timer.
+ * Parameters: timer -> The timer, from 0 up to SCHED_TIMER_COUNT - 1.
+ * Returns: None.
+ */
+void SchedTimerStop(uint8_t timer);
+
+/*
+ * Description :
+ * This function runs the handlers of the pending events by priority,
+ * and sleeps while no event is pending. It never returns.
+ * Parameters: None.
+ * Returns: None.
+ */
+void SchedRun(void);
+
+/*
+ * Description :
+ * This function copies the scheduler counters.
+ * Parameters: stats -> A pointer to the structure where the counters will be stored.
+ * Returns: None.
+ */
+void SchedGetStats(schedStats_t *stats);
+
+#endif /* SCHED_H_ */
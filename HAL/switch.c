@@ -17,8 +17,30 @@
  *                                 Includes                                    *
  *******************************************************************************/
 #include "HAL/switch.h"
+#include "HAL/profile.h"
+#include "HAL/trace.h"
+#include "driverlib/interrupt.h"
 
-buttonState_t Button_lastState = RELEASED;
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* Button times in SysTick periods, a timer started between two SysTick
+ * interrupts runs for one more period so that it never ends early */
+#define BUTTON_TICKS(ms) ((((ms) + SYSTICK_PERIOD_MS - 1U) / SYSTICK_PERIOD_MS) + 1U)
+#define BUTTON_DEBOUNCE_TICKS     BUTTON_TICKS(BUTTON_DEBOUNCE_MS)
+#define BUTTON_LONG_PRESS_TICKS   BUTTON_TICKS(BUTTON_LONG_PRESS_MS)
+#define BUTTON_DOUBLE_PRESS_TICKS BUTTON_TICKS(BUTTON_DOUBLE_PRESS_MS)
+
+/*******************************************************************************
+ *                            Global Variables                                 *
+ *******************************************************************************/
+/* Number of SysTick interrupts since reset */
+static volatile uint32_t systickTicks = 0U;
+
+/* The buttons taken by buttonInit(), and how many of their timers run */
+static button_t *buttons[BUTTON_MAX_COUNT];
+static uint8_t buttonCount = 0U;
+static volatile uint8_t buttonTimers = 0U;
 
 /*
  * Description: An instance of the button_t structure representing a specific button.
@@ -35,46 +57,229 @@ button_t sw1 = {
 };
 
 /*******************************************************************************
- *                      Functions Definitions                                  *
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static bool buttonTimerDue(uint32_t due, uint32_t now);
+static void buttonNotify(button_t *btn, buttonEvent_t event);
+static void buttonChange(button_t *btn, buttonState_t state, uint32_t now);
+static void buttonTick(button_t *btn, uint32_t now);
+static void ButtonGpioISR(void);
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
  *******************************************************************************/
 /*
  * Description :
- * Interrupt Service Routine for the SysTick timer.
- * This handler is responsible for monitoring the state of
- * a button (SW1) and handling state transitions. When the
- * button is pressed, it increments a flag_state variable, which
- * is used to select a specific function from a states_map array.
- * The handler also sets a flag_interrupt to indicate a state change.
- * Parameters: None.
+ * This function tells whether a button timer ended.
+ * Parameters: due -> The SysTick count the timer ends at.
+ *             now -> The current SysTick count.
+ * Returns: true if the timer ended.
+ */
+static bool buttonTimerDue(uint32_t due, uint32_t now)
+{
+    /* The difference is read signed so the SysTick count may wrap */
+    return ((int32_t)(now - due) >= 0);
+}
+
+/*
+ * Description :
+ * This function tells the callback of a button about an event.
+ * Parameters: btn   -> The button.
+ *             event -> The event.
  * Returns: None.
  */
-void SysticISR(void)
+static void buttonNotify(button_t *btn, buttonEvent_t event)
+{
+    if (NULL != btn->callback)
+    {
+        btn->callback(btn, event);
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function records the new state of a button, gives its events and
+ * starts or stops its long press timer.
+ * Parameters: btn   -> The button.
+ *             state -> Its debounced state.
+ *             now   -> The current SysTick count.
+ * Returns: None.
+ */
+static void buttonChange(button_t *btn, buttonState_t state, uint32_t now)
+{
+    if (state == btn->btn_state)
+    {
+        /* The contacts came back before the pin was read again */
+    }
+
+    else if (state == PRESSED)
+    {
+        bool doublePress = btn->doubleArmed && ((now - btn->pressTick) < BUTTON_DOUBLE_PRESS_TICKS);
+
+        btn->btn_state = PRESSED;
+        btn->pressTick = now;
+        btn->longDue = now + BUTTON_LONG_PRESS_TICKS;
+        btn->longPending = true;
+        buttonTimers++;
+
+        /* The press after a double press starts a new pair */
+        btn->doubleArmed = !doublePress;
+
+        buttonNotify(btn, BUTTON_EVENT_PRESS);
+
+        if (doublePress)
+        {
+            buttonNotify(btn, BUTTON_EVENT_DOUBLE_PRESS);
+        }
+
+        else
+        {
+
+        }
+    }
+
+    else
+    {
+        btn->btn_state = RELEASED;
+
+        if (btn->longPending)
+        {
+            btn->longPending = false;
+            buttonTimers--;
+        }
+
+        /* A long press does not start a double press */
+        else
+        {
+            btn->doubleArmed = false;
+        }
+
+        buttonNotify(btn, BUTTON_EVENT_RELEASE);
+    }
+}
+
+/*
+ * Description :
+ * This function ends the timers of a button that are due: at the end of
+ * the debounce it reads the pin again and turns its interrupt back on.
+ * Parameters: btn -> The button.
+ *             now -> The current SysTick count.
+ * Returns: None.
+ */
+static void buttonTick(button_t *btn, uint32_t now)
 {
-    SysTickPeriodSet(3U*160000U - 1U);
-    buttonState_t Button_currentState = RELEASED;
-    buttonGetState(&sw1, &Button_currentState);
+    if (btn->debouncing && buttonTimerDue(btn->debounceDue, now))
+    {
+        buttonState_t state = btn->btn_state;
+
+        btn->debouncing = false;
+        buttonTimers--;
 
-   /* when both current and last are equal do nothing */
-   if((Button_currentState == PRESSED) && (Button_lastState == RELEASED))
+        /* Clear the edges seen while the interrupt was off before reading
+         * the pin, an edge after the read raises the interrupt again */
+        GPIOIntClear(btn->btnPort, (uint32_t)btn->btnPin);
+        buttonGetState(btn, &state);
+        GPIOIntEnable(btn->btnPort, (uint32_t)btn->btnPin);
+        buttonChange(btn, state, now);
+    }
+
+    else
     {
-        /* we are in pre-pressed state */
-        /* make the last stated = pressed */
-        flag_state++;
-        flag_state %=3;
-        Button_lastState = Button_currentState;
-        flag_interrupt = 1U;
 
     }
 
-    /* Button_currentState == RELEASED && Button_lastState == PRESSED */
+    if (btn->longPending && buttonTimerDue(btn->longDue, now))
+    {
+        btn->longPending = false;
+        buttonTimers--;
+        buttonNotify(btn, BUTTON_EVENT_LONG_PRESS);
+    }
+
     else
     {
-        /*then we are in the pre-release state,
-          make the last stated = pressed */
-        Button_lastState = Button_currentState;
+
     }
 }
 
+/*
+ * Description :
+ * Interrupt Service Routine of the GPIO ports of the buttons.
+ * It takes the first edge of a button at once, then turns the interrupt
+ * of its pin off for BUTTON_DEBOUNCE_MS while the contacts bounce.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void ButtonGpioISR(void)
+{
+    uint32_t now = systickTicks;
+    uint8_t i;
+    PROFILE_START(profileStart);
+
+    TRACE_BEGIN(TRACE_EVENT_BUTTON_ISR, 0U);
+
+    for (i = 0U; i < buttonCount; i++)
+    {
+        button_t *btn = buttons[i];
+
+        if ((GPIOIntStatus(btn->btnPort, true) & (uint32_t)btn->btnPin) != 0U)
+        {
+            buttonState_t state = btn->btn_state;
+
+            GPIOIntDisable(btn->btnPort, (uint32_t)btn->btnPin);
+            GPIOIntClear(btn->btnPort, (uint32_t)btn->btnPin);
+            btn->debouncing = true;
+            btn->debounceDue = now + BUTTON_DEBOUNCE_TICKS;
+            buttonTimers++;
+
+            buttonGetState(btn, &state);
+            buttonChange(btn, state, now);
+        }
+
+        else
+        {
+
+        }
+    }
+
+    TRACE_END(TRACE_EVENT_BUTTON_ISR, 0U);
+    PROFILE_STOP(PROFILE_PROBE_BUTTON_ISR, profileStart);
+}
+
+/*******************************************************************************
+ *                      Functions Definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * Interrupt Service Routine for the SysTick timer.
+ * This handler counts the SysTick periods, the timebase of the
+ * timers, and ends the debounce and long press timers of the
+ * buttons, returning at once when none is running.
+ * Parameters: None.
+ * Returns: None.
+ */
+void SysticISR(void)
+{
+    uint32_t now = systickTicks + 1U;
+    uint8_t i;
+    PROFILE_START(profileStart);
+
+    TRACE_BEGIN(TRACE_EVENT_SYSTICK_ISR, now);
+    systickTicks = now;
+
+    for (i = 0U; (i < buttonCount) && (buttonTimers != 0U); i++)
+    {
+        buttonTick(buttons[i], now);
+    }
+
+    TRACE_END(TRACE_EVENT_SYSTICK_ISR, now);
+    PROFILE_STOP(PROFILE_PROBE_SYSTICK_ISR, profileStart);
+}
+
 /*
  * Description :
  * This function initializes the SysTick timer for periodic interrupts,
@@ -88,57 +293,125 @@ void SysticInit(void)
     SysTickDisable();
     SysTickIntDisable();
     SysTickIntRegister(&SysticISR);
-    SysTickPeriodSet(5U*160000U - 1U);
+    SysTickPeriodSet(SYSTICK_RELOAD(SYSTICK_PERIOD_MS));
     SysTickIntEnable();
     SysTickEnable();
 }
 
 /*
  * Description :
- * This function initializes the switch, and enables the GPIO
- * peripheral for Port F, initializes the SysTick timer for
- * button state monitoring, and initializes the button (SW1)
- * using the buttonInit function.
+ * This function returns the number of SysTick interrupts since reset,
+ * one every SYSTICK_PERIOD_MS milliseconds.
  * Parameters: None.
+ * Returns: The number of SysTick interrupts.
+ */
+uint32_t SysticGetTicks(void)
+{
+    return systickTicks;
+}
+
+/*
+ * Description :
+ * This function initializes the switch, and enables the GPIO
+ * peripheral for Port F, initializes the SysTick timer, and
+ * initializes the button (SW1) using the buttonInit function,
+ * its events going to a callback.
+ * Parameters: callback -> The function told about the events of SW1, may be NULL.
  * Returns: None.
  */
-void SwitchInit(void)
+void SwitchInit(buttonCallback_t callback)
 {
     /* Enable the GPIO peripheral for Port F */
     SysCtlPeripheralEnable((uint32_t)SYSCTL_PERIPH_GPIOF);
 
-    /* Initialize the SysTick timer for button state monitoring */
+    /* Initialize the SysTick timer, the timebase of the button timers */
     SysticInit();
 
     /* Initialize the button (SW1) using the buttonInit function */
-    buttonInit(&sw1);
+    buttonSetCallback(&sw1, callback);
+    (void)buttonInit(&sw1);
 }
 
 /*
  * Description :
  * This function initializes a button's GPIO pin and configuration,
  * takes a pointer to a button_t structure and configures the associated
- * GPIO pin as an input with a pull-up resistor. It ensures that
- * the button is ready for use.
+ * GPIO pin as an input with a pull-up or pull-down resistor, and an
+ * interrupt on both edges. It ensures that the button is ready for use.
+ * The GPIO peripheral of the port must be enabled.
  * Parameters: btn -> A pointer to the button_t structure representing
- * the button to be initialized.
- * Returns: None.
+ * the button to be initialized, it must stay valid.
+ * Returns: true if the button was taken, false if BUTTON_MAX_COUNT
+ *          buttons are already taken.
  */
-void buttonInit(button_t *btn)
+bool buttonInit(button_t *btn)
 {
-    /* Check if the button pointer is NULL */
-    if(NULL == btn)
+    /* Check if the button pointer is NULL or every button is taken */
+    if((NULL == btn) || (buttonCount >= BUTTON_MAX_COUNT))
     {
         /* Exit the function if NULL */
-        return;
+        return false;
     }
 
-    /* Unlock the GPIO pin, set it as an input, and configure with pull-up resistor */
+    /* Unlock the GPIO pin, set it as an input, configure its resistor
+     * and raise its interrupt on both edges */
     else
     {
+        uint32_t pad = (btn->btn_conn == PULL_UP) ? (uint32_t)GPIO_PIN_TYPE_STD_WPU : (uint32_t)GPIO_PIN_TYPE_STD_WPD;
+        bool masked;
+
         GPIOUnlockPin(btn->btnPort,  btn->btnPin);
         GPIOPinTypeGPIOInput(btn->btnPort , btn->btnPin);
-        GPIOPadConfigSet(btn->btnPort , btn->btnPin , (uint32_t)GPIO_STRENGTH_2MA, (uint32_t)GPIO_PIN_TYPE_STD_WPU);
+        GPIOPadConfigSet(btn->btnPort , btn->btnPin , (uint32_t)GPIO_STRENGTH_2MA, pad);
+        GPIOIntDisable(btn->btnPort, (uint32_t)btn->btnPin);
+        GPIOIntTypeSet(btn->btnPort, btn->btnPin, (uint32_t)GPIO_BOTH_EDGES);
+
+        btn->btn_state = RELEASED;
+        btn->debouncing = false;
+        btn->longPending = false;
+        btn->doubleArmed = false;
+        buttonGetState(btn, &btn->btn_state);
+
+        /* Take the button before its interrupt may run */
+        masked = IntMasterDisable();
+        buttons[buttonCount] = btn;
+        buttonCount++;
+
+        if (!masked)
+        {
+            IntMasterEnable();
+        }
+
+        else
+        {
+
+        }
+
+        GPIOIntClear(btn->btnPort, (uint32_t)btn->btnPin);
+        GPIOIntRegister(btn->btnPort, &ButtonGpioISR);
+        GPIOIntEnable(btn->btnPort, (uint32_t)btn->btnPin);
+
+        return true;
+    }
+}
+
+/*
+ * Description :
+ * This function sets the function told about the events of a button.
+ * Parameters: btn      -> A pointer to the button_t structure representing the button.
+ *             callback -> The function to call from the ISRs, NULL for none.
+ * Returns: None.
+ */
+void buttonSetCallback(button_t *btn, buttonCallback_t callback)
+{
+    if (NULL != btn)
+    {
+        btn->callback = callback;
+    }
+
+    else
+    {
+
     }
 }
 
@@ -173,29 +446,26 @@ void buttonGetState(button_t *btn, buttonState_t *btn_state1)
         switch(btn-> btn_conn)
         {
         case PULL_UP :
-            switch(state & btn->btnPin)
+            /* GPIOPinRead() returns the pin bit itself, not HIGH */
+            if ((state & btn->btnPin) != 0U)
             {
-            case LOW :
-                *btn_state1 = PRESSED ;
-                break;
-            case HIGH :
                 *btn_state1 = RELEASED ;
-                break;
-            default :
-                break;
+            }
+
+            else
+            {
+                *btn_state1 = PRESSED ;
             }
             break;
             case PULL_DOWN :
-                switch(state & btn->btnPin)
+                if ((state & btn->btnPin) != 0U)
                 {
-                case LOW :
-                    *btn_state1 = RELEASED ;
-                    break;
-                case HIGH :
                     *btn_state1 = PRESSED ;
-                    break;
-                default :
-                    break;
+                }
+
+                else
+                {
+                    *btn_state1 = RELEASED ;
                 }
                 break;
                 default:
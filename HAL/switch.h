@@ -31,6 +31,7 @@
 #include "driverlib/timer.h"
 #include "driverlib/systick.h"
 #include "HAL/UART_API.h"
+#include "HAL/clock.h"
 
 /*******************************************************************************
  *                                Definitions                                  *
@@ -38,11 +39,36 @@
 #define HIGH 1U
 #define LOW  0U
 
+/* Period of the SysTick interrupt, the timebase of the timers */
+#define SYSTICK_PERIOD_MS 30U
+
+/* SysTick reload value for a period in ms, derived from the system clock */
+#define SYSTICK_RELOAD(ms) (((ms) * (ClockGetHz() / 1000U)) - 1U)
+
+/* Number of states the button cycles through, the size of states_map in main.c */
+#define STATES_NUMBER 5U
+
+/*
+ * A button raises a GPIO interrupt on both edges, so nothing runs while it
+ * is left alone. The first edge is taken at once, then the interrupt of
+ * the pin stays off for BUTTON_DEBOUNCE_MS while the contacts bounce, and
+ * the pin is read again at its end to catch a change made meanwhile.
+ * A press held for BUTTON_LONG_PRESS_MS also gives a long press, and a
+ * press coming within BUTTON_DOUBLE_PRESS_MS of the previous press a
+ * double press. The times are counted in SysTick periods, rounded up.
+ */
+#define BUTTON_DEBOUNCE_MS     20U
+#define BUTTON_LONG_PRESS_MS   1000U
+#define BUTTON_DOUBLE_PRESS_MS 400U
+
+/* Buttons buttonInit() can take */
+#define BUTTON_MAX_COUNT 4U
+
 /*******************************************************************************
  *                                  Externs                                    *
  *******************************************************************************/
-extern int8_t flag_state;
-extern uint8_t flag_interrupt;
+extern volatile int8_t flag_state;
+extern volatile uint8_t flag_interrupt;
 
 /*******************************************************************************
  *                               Types Declaration                             *
@@ -69,20 +95,58 @@ typedef enum
     PRESSED  = 1U
 } buttonState_t;
 
+/*
+ * Description: Enumeration representing the button events.
+ *              - BUTTON_EVENT_PRESS        : The button was pressed.
+ *              - BUTTON_EVENT_RELEASE      : The button was released.
+ *              - BUTTON_EVENT_LONG_PRESS   : The button is held for BUTTON_LONG_PRESS_MS.
+ *              - BUTTON_EVENT_DOUBLE_PRESS : The button was pressed within
+ *                                            BUTTON_DOUBLE_PRESS_MS of the previous press,
+ *                                            it follows the BUTTON_EVENT_PRESS.
+ */
+typedef enum
+{
+    BUTTON_EVENT_PRESS,
+    BUTTON_EVENT_RELEASE,
+    BUTTON_EVENT_LONG_PRESS,
+    BUTTON_EVENT_DOUBLE_PRESS
+} buttonEvent_t;
+
+typedef struct button_s button_t;
+
+/*
+ * Description: Pointer to the function told about the events of a button,
+ *              it runs in the GPIO or SysTick ISR.
+ */
+typedef void (*buttonCallback_t)(button_t *btn, buttonEvent_t event);
+
 /*
  * Description: Structure representing a button with its properties.
- *              - btnPort   : The GPIO port to which the button is connected.
- *              - btnPin    : The specific GPIO pin used for the button.
- *              - btn_conn  : The type of button connection (PULL_DOWN or PULL_UP).
- *              - btn_state : The current state of the button (RELEASED or PRESSED).
+ *              - btnPort     : The GPIO port to which the button is connected.
+ *              - btnPin      : The specific GPIO pin used for the button.
+ *              - btn_conn    : The type of button connection (PULL_DOWN or PULL_UP).
+ *              - btn_state   : The current state of the button (RELEASED or PRESSED).
+ *              - callback    : The function told about its events, may be NULL.
+ *              - debouncing  : Its interrupt is off until debounceDue.
+ *              - longPending : A long press is given at longDue unless it is released.
+ *              - debounceDue, longDue : SysTick counts of the ends of the timers.
+ *              - pressTick   : SysTick count of its last press.
+ *              - doubleArmed : Its next press may be a double press.
  */
-typedef struct
+struct button_s
 {
     uint32_t btnPort;
     uint8_t  btnPin;
     buttonConnection_t btn_conn;
     buttonState_t btn_state;
-} button_t;
+    buttonCallback_t callback;
+    bool debouncing;
+    bool longPending;
+    bool doubleArmed;
+    uint32_t debounceDue;
+    uint32_t longDue;
+    uint32_t pressTick;
+};
 
 /*******************************************************************************
  *                      Functions Prototypes                                   *
@@ -90,11 +154,9 @@ typedef struct
 /*
  * Description :
  * Interrupt Service Routine for the SysTick timer.
- * This handler is responsible for monitoring the state of
- * a button (SW1) and handling state transitions. When the
- * button is pressed, it increments a flag_state variable, which
- * is used to select a specific function from a states_map array.
- * The handler also sets a flag_interrupt to indicate a state change.
+ * This handler counts the SysTick periods, the timebase of the
+ * timers, and ends the debounce and long press timers of the
+ * buttons, returning at once when none is running.
  * Parameters: None.
  * Returns: None.
  */
@@ -112,26 +174,46 @@ void SysticInit(void);
 
 /*
  * Description :
- * This function initializes the switch, and enables the GPIO
- * peripheral for Port F, initializes the SysTick timer for
- * button state monitoring, and initializes the button (SW1)
- * using the buttonInit function.
+ * This function returns the number of SysTick interrupts since reset,
+ * one every SYSTICK_PERIOD_MS milliseconds.
  * Parameters: None.
+ * Returns: The number of SysTick interrupts.
+ */
+uint32_t SysticGetTicks(void);
+
+/*
+ * Description :
+ * This function initializes the switch, and enables the GPIO
+ * peripheral for Port F, initializes the SysTick timer, and
+ * initializes the button (SW1) using the buttonInit function,
+ * its events going to a callback.
+ * Parameters: callback -> The function told about the events of SW1, may be NULL.
  * Returns: None.
  */
-void SwitchInit(void);
+void SwitchInit(buttonCallback_t callback);
 
 /*
  * Description :
  * This function initializes a button's GPIO pin and configuration,
  * takes a pointer to a button_t structure and configures the associated
- * GPIO pin as an input with a pull-up resistor. It ensures that
- * the button is ready for use.
+ * GPIO pin as an input with a pull-up or pull-down resistor, and an
+ * interrupt on both edges. It ensures that the button is ready for use.
+ * The GPIO peripheral of the port must be enabled.
  * Parameters: btn -> A pointer to the button_t structure representing
- * the button to be initialized..
+ * the button to be initialized, it must stay valid.
+ * Returns: true if the button was taken, false if BUTTON_MAX_COUNT
+ *          buttons are already taken.
+ */
+bool buttonInit(button_t *btn);
+
+/*
+ * Description :
+ * This function sets the function told about the events of a button.
+ * Parameters: btn      -> A pointer to the button_t structure representing the button.
+ *             callback -> The function to call from the ISRs, NULL for none.
  * Returns: None.
  */
-void buttonInit(button_t *btn);
+void buttonSetCallback(button_t *btn, buttonCallback_t callback);
 
 /*
  * Description :
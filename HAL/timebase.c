@@ -0,0 +1,88 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   timebase.c                                                   *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the monotonic timebase, the WTIMER0 64-bit   *
+ *                counter                                                      *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include "HAL/timebase.h"
+#include "HAL/clock.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/timer.h"
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function starts WTIMER0 and sets the time to 0.
+ * Parameters: None.
+ * Returns: None.
+ */
+void TimebaseInit(void)
+{
+    SysCtlPeripheralEnable((uint32_t)SYSCTL_PERIPH_WTIMER0);
+
+    while (!SysCtlPeripheralReady((uint32_t)SYSCTL_PERIPH_WTIMER0))
+    {
+
+    }
+
+    /* Keep it clocked in sleep mode, should the clock gating be enabled */
+    SysCtlPeripheralSleepEnable((uint32_t)SYSCTL_PERIPH_WTIMER0);
+
+    /* One 64-bit counter counting up from 0, it never reaches its load */
+    TimerConfigure((uint32_t)WTIMER0_BASE, (uint32_t)TIMER_CFG_PERIODIC_UP);
+    TimerLoadSet64((uint32_t)WTIMER0_BASE, UINT64_MAX);
+    TimerEnable((uint32_t)WTIMER0_BASE, (uint32_t)TIMER_A);
+}
+
+/*
+ * Description :
+ * This function returns the CPU cycles since TimebaseInit(), it may be
+ * called from an ISR.
+ * Parameters: None.
+ * Returns: The 64-bit cycle count.
+ */
+uint64_t TimebaseGetCycles(void)
+{
+    /* TimerValueGet64() reads the upper half again until it did not change
+     * meanwhile, so no lock is needed */
+    return TimerValueGet64((uint32_t)WTIMER0_BASE);
+}
+
+/*
+ * Description :
+ * This function returns the microseconds since TimebaseInit(), it may be
+ * called from an ISR.
+ * Parameters: None.
+ * Returns: The 64-bit time in microseconds.
+ */
+uint64_t TimebaseGetUs(void)
+{
+    return TimebaseCyclesToUs(TimebaseGetCycles());
+}
+
+/*
+ * Description :
+ * This function converts CPU cycles to microseconds.
+ * Parameters: cycles -> The number of cycles.
+ * Returns: The number of whole microseconds.
+ */
+uint64_t TimebaseCyclesToUs(uint64_t cycles)
+{
+    return cycles / (uint64_t)(ClockGetHz() / 1000000U);
+}
@@ -0,0 +1,76 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   timebase.h                                                   *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file for the monotonic timebase, the WTIMER0 64-bit   *
+ *                counter                                                      *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef TIMEBASE_H_
+#define TIMEBASE_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/*
+ * The timebase counts the CPU cycles since TimebaseInit() on 64 bits with
+ * the wide timer WTIMER0, its two 32-bit halves concatenated into one
+ * counter counting up at the system clock (2^64 cycles, thousands of years
+ * at 80 MHz). Unlike the DWT cycle counter, which stops with the core
+ * clock, it keeps counting while the core sleeps in PowerIdle(), so the
+ * time asleep is measured too. The time never goes back, and has the
+ * resolution of a CPU cycle (12.5 ns at 80 MHz).
+ */
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function starts WTIMER0 and sets the time to 0.
+ * Parameters: None.
+ * Returns: None.
+ */
+void TimebaseInit(void);
+
+/*
+ * Description :
+ * This function returns the CPU cycles since TimebaseInit(), it may be
+ * called from an ISR.
+ * Parameters: None.
+ * Returns: The 64-bit cycle count.
+ */
+uint64_t TimebaseGetCycles(void);
+
+/*
+ * Description :
+ * This function returns the microseconds since TimebaseInit(), it may be
+ * called from an ISR.
+ * Parameters: None.
+ * Returns: The 64-bit time in microseconds.
+ */
+uint64_t TimebaseGetUs(void);
+
+/*
+ * Description :
+ * This function converts CPU cycles to microseconds.
+ * Parameters: cycles -> The number of cycles.
+ * Returns: The number of whole microseconds.
+ */
+uint64_t TimebaseCyclesToUs(uint64_t cycles);
+
+#endif /* TIMEBASE_H_ */
@@ -0,0 +1,343 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   trace.c                                                      *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the event trace, recording timestamped       *
+ *                events of the ISRs and the main loop in a lock-free ring     *
+ *                and streaming them on UART0                                  *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <string.h>
+#include "HAL/trace.h"
+#include "HAL/cycle_counter.h"
+#include "HAL/timebase.h"
+#include "HAL/UART_API.h"
+#include "HAL/clock.h"
+#include "HAL/crc.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* Trace points run to measure their cost */
+#define TRACE_CALIBRATION_RUNS 8U
+
+/* The number a slot holds while a trace point writes it */
+#define TRACE_SEQ_BUSY 0xFFFFFFFFU
+
+/* The largest burst */
+#define TRACE_BURST_LENGTH (TRACE_BURST_HEADER_LENGTH + (TRACE_BURST_RECORDS * TRACE_RECORD_LENGTH) + TRACE_BURST_CRC_LENGTH)
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Structure representing a slot of the ring.
+ *              - seq    : The number of the record in the slot, written last.
+ *              - cycles : The low 32 bits of the timebase when it was recorded.
+ *              - arg    : The argument of the event.
+ *              - type   : The phase and the event.
+ */
+typedef struct
+{
+    uint32_t seq;
+    uint32_t cycles;
+    uint16_t arg;
+    uint8_t type;
+} traceSlot_t;
+
+#if (TRACE_MODE == 1U)
+/*******************************************************************************
+ *                            Global Variables                                 *
+ *******************************************************************************/
+/* The ring, the slot of record n being n % TRACE_BUFFER_SIZE */
+static volatile traceSlot_t traceRing[TRACE_BUFFER_SIZE];
+
+/* The number of the next record to be stored, claimed by the trace
+ * points, and of the next one to be sent, only used by the main loop */
+static volatile uint32_t traceHead = 0U;
+static uint32_t traceTail = 0U;
+
+/* The records lost since the previous burst */
+static uint32_t traceLostPending = 0U;
+
+static traceStats_t traceStats;
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static uint32_t TraceClaim(void);
+static void TraceReset(void);
+static uint16_t TraceTake(uint8_t *data, uint8_t space);
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function claims the number of the next record. The increment
+ * starts again when an interrupt stored a record in between (LDREX /
+ * STREX), so an ISR never waits for the code it interrupted.
+ * Parameters: None.
+ * Returns: The number of the record.
+ */
+static uint32_t TraceClaim(void)
+{
+#if defined(ccs)
+    uint32_t index;
+
+    do
+    {
+        index = __ldrex((void *)&traceHead);
+    } while (__strex(index + 1U, (void *)&traceHead) != 0);
+
+    return index;
+#else
+    return __atomic_fetch_add(&traceHead, 1U, __ATOMIC_RELAXED);
+#endif
+}
+
+/*
+ * Description :
+ * This function empties the ring, every slot holding a record of the lap before.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void TraceReset(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < TRACE_BUFFER_SIZE; i++)
+    {
+        traceRing[i].seq = i - TRACE_BUFFER_SIZE;
+    }
+
+    traceHead = 0U;
+    traceTail = 0U;
+    traceLostPending = 0U;
+    (void)memset(&traceStats, 0, sizeof(traceStats));
+}
+
+/*
+ * Description :
+ * This function moves the next records of the ring into a burst. A slot
+ * already overwritten, before or while it was copied, makes the records
+ * older than the ring is long lost.
+ * Parameters: data  -> Where the records are stored.
+ *             space -> The records the burst has room for.
+ * Returns: The number of records stored.
+ */
+static uint16_t TraceTake(uint8_t *data, uint8_t space)
+{
+    uint16_t count = 0U;
+    bool ready = true;
+
+    while (ready && (count < space) && (traceTail != traceHead))
+    {
+        volatile traceSlot_t *slot = &traceRing[traceTail & (TRACE_BUFFER_SIZE - 1U)];
+        uint32_t seq = slot->seq;
+        uint32_t cycles = slot->cycles;
+        uint16_t arg = slot->arg;
+        uint8_t type = slot->type;
+
+        /* Written, and not written again while it was copied */
+        if ((seq == traceTail) && (slot->seq == seq))
+        {
+            uint8_t *record = &data[count * TRACE_RECORD_LENGTH];
+
+            record[0] = type;
+            record[1] = (uint8_t)(arg >> 8);
+            record[2] = (uint8_t)arg;
+            record[3] = (uint8_t)(cycles >> 24);
+            record[4] = (uint8_t)(cycles >> 16);
+            record[5] = (uint8_t)(cycles >> 8);
+            record[6] = (uint8_t)cycles;
+            count++;
+            traceTail++;
+        }
+
+        /* Claimed but not written yet, which only a trace point
+         * interrupted by the caller leaves behind */
+        else if ((seq != traceTail) && ((int32_t)(seq - traceTail) < 0))
+        {
+            ready = false;
+        }
+
+        /* Overwritten, go on from the oldest record still in the ring */
+        else
+        {
+            uint32_t oldest = traceHead - TRACE_BUFFER_SIZE;
+
+            if ((int32_t)(oldest - traceTail) > 0)
+            {
+                traceLostPending += oldest - traceTail;
+                traceStats.lost += oldest - traceTail;
+                traceTail = oldest;
+            }
+
+            else
+            {
+                ready = false;
+            }
+        }
+    }
+
+    return count;
+}
+#endif
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function starts the cycle counter, measures the cost of a trace
+ * point and empties the ring.
+ * Parameters: None.
+ * Returns: None.
+ */
+void TraceInit(void)
+{
+    CycleCounterInit();
+
+#if (TRACE_MODE == 1U)
+    {
+        uint32_t start;
+        uint32_t cycles;
+        uint8_t i;
+
+        TraceReset();
+
+        start = CYCLE_COUNTER_GET();
+
+        for (i = 0U; i < TRACE_CALIBRATION_RUNS; i++)
+        {
+            TraceRecord(TRACE_PHASE_INSTANT, TRACE_EVENT_COUNT, 0U);
+        }
+
+        cycles = CYCLE_COUNTER_GET() - start;
+
+        TraceReset();
+        traceStats.overheadCycles = cycles / TRACE_CALIBRATION_RUNS;
+    }
+#endif
+}
+
+/*
+ * Description :
+ * This function stores a record in the ring, it may be called from an
+ * ISR or from the main loop.
+ * Parameters: phase -> The phase (TRACE_PHASE_xxx).
+ *             event -> The event (TRACE_EVENT_xxx).
+ *             arg   -> The argument of the event.
+ * Returns: None.
+ */
+void TraceRecord(tracePhase_t phase, traceEvent_t event, uint16_t arg)
+{
+#if (TRACE_MODE == 1U)
+    uint32_t cycles = (uint32_t)TimebaseGetCycles();
+    uint32_t index = TraceClaim();
+    volatile traceSlot_t *slot = &traceRing[index & (TRACE_BUFFER_SIZE - 1U)];
+
+    /* The main loop sees a slot being rewritten under it */
+    slot->seq = TRACE_SEQ_BUSY;
+    slot->cycles = cycles;
+    slot->arg = arg;
+    slot->type = (uint8_t)(((uint32_t)phase << 6) | (uint32_t)event);
+    slot->seq = index;
+#else
+    (void)phase;
+    (void)event;
+    (void)arg;
+#endif
+}
+
+/*
+ * Description :
+ * This function sends the records of the ring on UART0 in bursts, as
+ * many as the UART0 transmit ring buffer has room for, without waiting.
+ * It must be called from the main loop.
+ * Parameters: None.
+ * Returns: true if records are left in the ring.
+ */
+bool TraceFlush(void)
+{
+#if (TRACE_MODE == 1U)
+    uint8_t burst[TRACE_BURST_LENGTH];
+    uint32_t hz = ClockGetHz();
+    bool sending = true;
+
+    while (sending && (traceTail != traceHead) && (UARTTxFree((uint32_t)UART0_MODULE) >= (uint16_t)TRACE_BURST_LENGTH))
+    {
+        uint16_t count = TraceTake(&burst[TRACE_BURST_HEADER_LENGTH], (uint8_t)TRACE_BURST_RECORDS);
+        uint16_t length = (uint16_t)(TRACE_BURST_HEADER_LENGTH + (count * TRACE_RECORD_LENGTH));
+        uint16_t lost = (traceLostPending > 0xFFFFU) ? 0xFFFFU : (uint16_t)traceLostPending;
+        uint16_t crc;
+
+        if (count != 0U)
+        {
+            (void)memcpy(burst, TRACE_BURST_MAGIC, 4U);
+            burst[4] = (uint8_t)(hz >> 24);
+            burst[5] = (uint8_t)(hz >> 16);
+            burst[6] = (uint8_t)(hz >> 8);
+            burst[7] = (uint8_t)hz;
+            burst[8] = (uint8_t)(lost >> 8);
+            burst[9] = (uint8_t)lost;
+            burst[10] = (uint8_t)count;
+
+            crc = CRC16Update(CRC16_INIT, burst, length);
+            burst[length] = (uint8_t)(crc >> 8);
+            burst[length + 1U] = (uint8_t)crc;
+            length += (uint16_t)TRACE_BURST_CRC_LENGTH;
+
+            (void)UARTWrite((uint32_t)UART0_MODULE, burst, length);
+            traceLostPending = 0U;
+            traceStats.sent += count;
+            traceStats.bursts++;
+        }
+
+        else
+        {
+            sending = false;
+        }
+    }
+
+    return (traceTail != traceHead);
+#else
+    return false;
+#endif
+}
+
+/*
+ * Description :
+ * This function copies the trace counters.
+ * Parameters: stats -> A pointer to the structure where the counters will be stored.
+ * Returns: None.
+ */
+void TraceGetStats(traceStats_t *stats)
+{
+    if (NULL != stats)
+    {
+#if (TRACE_MODE == 1U)
+        *stats = traceStats;
+        stats->recorded = traceHead;
+#else
+        (void)memset(stats, 0, sizeof(*stats));
+#endif
+    }
+
+    else
+    {
+
+    }
+}
@@ -0,0 +1,184 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   trace.h                                                      *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file for the event trace, recording timestamped       *
+ *                events of the ISRs and the main loop in a lock-free ring     *
+ *                and streaming them on UART0                                  *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* Trace configuration:
+ * TRACE_MODE keeps the trace points in the code when 1U. A trace point
+ * stores an event, a 16 bit argument and the timebase in the next
+ * slot of a ring of TRACE_BUFFER_SIZE records, from an ISR or from the
+ * main loop alike: the slot is claimed with an atomic increment, so no
+ * interrupt is masked. The main loop streams the records on UART0 on every
+ * timer tick, in bursts of up to TRACE_BURST_RECORDS, as much as the UART0
+ * transmit ring buffer takes without waiting. Records overwritten before
+ * they were sent are counted lost. tools/trace2json.py turns the bursts
+ * found in a capture of UART0 into a Chrome / Perfetto trace. When 0U the
+ * trace points expand to nothing and the trace takes no RAM. The host
+ * simulation build sets it from the command line. */
+#ifndef TRACE_MODE
+#define TRACE_MODE 0U
+#endif
+
+/* Records of the ring, a power of 2 */
+#define TRACE_BUFFER_SIZE 128U
+
+/* Records sent at most in a burst */
+#define TRACE_BURST_RECORDS 16U
+
+/*
+ * A burst on UART0, the numbers most significant byte first:
+ *   'T' 'R' 'C' '1' | CLOCK (4) | LOST (2) | COUNT (1) | records | CRC (2)
+ * CLOCK is the system clock in Hz, LOST the records lost since the previous
+ * burst (saturated), and the CRC-16 (crc.h) covers everything before it.
+ * A record is
+ *   PHASE << 6 | EVENT (1) | ARGUMENT (2) | CYCLES (4)
+ * CYCLES being the low 32 bits of TimebaseGetCycles(), which counts on
+ * while the core sleeps.
+ */
+#define TRACE_BURST_MAGIC "TRC1"
+#define TRACE_BURST_HEADER_LENGTH 11U
+#define TRACE_RECORD_LENGTH 7U
+#define TRACE_BURST_CRC_LENGTH 2U
+
+/*
+ * TRACE_BEGIN() and TRACE_END() bracket a span of time, TRACE_INSTANT()
+ * marks a moment. The spans of an event must nest, each ISR has its own.
+ */
+#if (TRACE_MODE == 1U)
+#define TRACE_BEGIN(event, arg) TraceRecord(TRACE_PHASE_BEGIN, (event), (uint16_t)(arg))
+#define TRACE_END(event, arg) TraceRecord(TRACE_PHASE_END, (event), (uint16_t)(arg))
+#define TRACE_INSTANT(event, arg) TraceRecord(TRACE_PHASE_INSTANT, (event), (uint16_t)(arg))
+#else
+#define TRACE_BEGIN(event, arg)
+#define TRACE_END(event, arg)
+#define TRACE_INSTANT(event, arg)
+#endif
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Enum describing the phase of a record.
+ *              - TRACE_PHASE_INSTANT : A moment.
+ *              - TRACE_PHASE_BEGIN   : The start of a span.
+ *              - TRACE_PHASE_END     : The end of a span.
+ */
+typedef enum
+{
+    TRACE_PHASE_INSTANT,
+    TRACE_PHASE_BEGIN,
+    TRACE_PHASE_END
+} tracePhase_t;
+
+/*
+ * Description: Enum describing the events, tools/trace2json.py names them
+ *              in the same order, with the argument of each.
+ *              - TRACE_EVENT_SYSTICK_ISR : SysticISR(), the SysTick count.
+ *              - TRACE_EVENT_BUTTON_ISR  : The GPIO ISR of the buttons.
+ *              - TRACE_EVENT_UART1_ISR   : UART1ISR().
+ *              - TRACE_EVENT_UART3_ISR   : UART3ISR().
+ *              - TRACE_EVENT_BUTTON      : A button event (buttonEvent_t), the
+ *                                          state selected in the high byte.
+ *              - TRACE_EVENT_POST        : An event posted to the scheduler (schedEvent_t).
+ *              - TRACE_EVENT_HANDLER     : A scheduler handler run (schedEvent_t).
+ *              - TRACE_EVENT_STATE       : The state running, from its enter to its leave.
+ *              UART0ISR() and the sleep in PowerIdle() are not traced, as the
+ *              sending of the trace itself would fill the ring with them: the
+ *              core sleeps between the handler runs.
+ */
+typedef enum
+{
+    TRACE_EVENT_SYSTICK_ISR,
+    TRACE_EVENT_BUTTON_ISR,
+    TRACE_EVENT_UART1_ISR,
+    TRACE_EVENT_UART3_ISR,
+    TRACE_EVENT_BUTTON,
+    TRACE_EVENT_POST,
+    TRACE_EVENT_HANDLER,
+    TRACE_EVENT_STATE,
+    TRACE_EVENT_COUNT
+} traceEvent_t;
+
+/*
+ * Description: Structure holding the trace counters.
+ *              - recorded       : Records stored in the ring.
+ *              - sent           : Records streamed on UART0.
+ *              - lost           : Records overwritten before they were sent.
+ *              - bursts         : Bursts streamed on UART0.
+ *              - overheadCycles : CPU cycles of a trace point, measured by TraceInit().
+ */
+typedef struct
+{
+    uint32_t recorded;
+    uint32_t sent;
+    uint32_t lost;
+    uint32_t bursts;
+    uint32_t overheadCycles;
+} traceStats_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function starts the cycle counter, measures the cost of a trace
+ * point and empties the ring.
+ * Parameters: None.
+ * Returns: None.
+ */
+void TraceInit(void);
+
+/*
+ * Description :
+ * This function stores a record in the ring, it may be called from an
+ * ISR or from the main loop.
+ * Parameters: phase -> The phase (TRACE_PHASE_xxx).
+ *             event -> The event (TRACE_EVENT_xxx).
+ *             arg   -> The argument of the event.
+ * Returns: None.
+ */
+void TraceRecord(tracePhase_t phase, traceEvent_t event, uint16_t arg);
+
+/*
+ * Description :
+ * This function sends the records of the ring on UART0 in bursts, as
+ * many as the UART0 transmit ring buffer has room for, without waiting.
+ * It must be called from the main loop.
+ * Parameters: None.
+ * Returns: true if records are left in the ring.
+ */
+bool TraceFlush(void);
+
+/*
+ * Description :
+ * This function copies the trace counters.
+ * Parameters: stats -> A pointer to the structure where the counters will be stored.
+ * Returns: None.
+ */
+void TraceGetStats(traceStats_t *stats);
+
+#endif /* TRACE_H_ */
@@ -0,0 +1,501 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   xfer.c                                                       *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the file transfer state, forwarding a file   *
+ *                from the PC of one board to the PC of the other one          *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include "HAL/xfer.h"
+#include "HAL/UART_API.h"
+#include "HAL/net.h"
+#include "HAL/ring_buffer.h"
+#include "HAL/crc.h"
+#include "HAL/switch.h"
+#include "HAL/log.h"
+
+/*******************************************************************************
+ *                            Global Variables                                 *
+ *******************************************************************************/
+/* Bytes of the file read from UART0, waiting to be sent */
+static volatile uint8_t stageStorage[XFER_STAGE_SIZE];
+static ringBuffer_t stageRing;
+
+/* The block handed to ArqSend(), which keeps its own copy */
+static uint8_t block[XFER_BLOCK_SIZE];
+
+/* The file being sent: read from UART0, then its end frame waiting for
+ * the acknowledgements before the report */
+static bool txActive = false;
+static bool txEnding = false;
+static uint32_t txLength = 0U;
+static uint16_t txCrc = CRC16_INIT;
+static uint32_t txStartMs = 0U;
+static uint32_t txLastInputMs = 0U;
+static uint32_t txDeliveredMs = 0U;
+static uint32_t txInputLostBase = 0U;
+static uint32_t txSavedBase = 0U;
+
+/* The file being received */
+static bool rxActive = false;
+static uint32_t rxLength = 0U;
+static uint16_t rxCrc = CRC16_INIT;
+
+static xferStats_t xferStats;
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static uint32_t XferNow(void);
+static uint32_t XferInputLost(void);
+static uint32_t XferSaved(void);
+static bool XferWorkPending(void);
+static bool XferReadInput(void);
+static bool XferSendBlock(void);
+static void XferCheckDelivered(void);
+static void XferReport(uint32_t elapsedMs, uint32_t lost);
+static void XferWrite(const uint8_t *data, uint16_t length);
+static void XferReceiveFrame(const linkFrame_t *frame);
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function gives the time in ms, with the SysTick resolution.
+ * Parameters: None.
+ * Returns: The time since reset in ms.
+ */
+static uint32_t XferNow(void)
+{
+    return SysticGetTicks() * SYSTICK_PERIOD_MS;
+}
+
+/*
+ * Description :
+ * This function counts the UART0 bytes lost since reset, dropped because
+ * the receive ring buffer was full or overrun in the hardware.
+ * Parameters: None.
+ * Returns: The number of lost bytes.
+ */
+static uint32_t XferInputLost(void)
+{
+    uartStats_t stats;
+
+    UARTGetStats((uint32_t)UART0_MODULE, &stats);
+
+    return stats.rxDropped + stats.rxOverrun;
+}
+
+/*
+ * Description :
+ * This function counts the payload bytes the link compression saved since reset.
+ * Parameters: None.
+ * Returns: The number of saved bytes.
+ */
+static uint32_t XferSaved(void)
+{
+    arqStats_t stats;
+
+    ArqGetStats(LINK_PORT_UART1, &stats);
+
+    return stats.savedBytes;
+}
+
+/*
+ * Description :
+ * This function tells whether the file transfer state must run again
+ * without waiting for an event: a block with room for it in the send
+ * window or a sent file fully acknowledged. The bytes on either UART post
+ * their own events, and the end of a file is checked on the timer ticks.
+ * In uDMA mode the link is polled while its bytes keep arriving
+ * (UARTLinkPolling()).
+ * Parameters: None.
+ * Returns: true if work is pending.
+ */
+static bool XferWorkPending(void)
+{
+    return ((RingBufferCount(&stageRing) != 0U) && (ArqWindowFree(LINK_PORT_UART1) != 0U)) ||
+           (txEnding && (ArqWindowFree(LINK_PORT_UART1) == ARQ_WINDOW_SIZE)) || UARTLinkPolling();
+}
+
+/*
+ * Description :
+ * This function moves the bytes the PC sent into the staging buffer, the
+ * first one starting a new file. Nothing is read while the end of the
+ * previous file waits for its acknowledgement.
+ * Parameters: None.
+ * Returns: true if a byte was read.
+ */
+static bool XferReadInput(void)
+{
+    bool busy = false;
+    uint8_t data;
+
+    while (!txEnding && (RingBufferFree(&stageRing) != 0U) && UARTReceive((uint32_t)UART0_MODULE, &data))
+    {
+        if (!txActive)
+        {
+            txActive = true;
+            txLength = 0U;
+            txCrc = CRC16_INIT;
+            txStartMs = XferNow();
+            txDeliveredMs = txStartMs;
+            txInputLostBase = XferInputLost();
+            txSavedBase = XferSaved();
+        }
+
+        else
+        {
+
+        }
+
+        (void)RingBufferPut(&stageRing, data);
+        txLastInputMs = XferNow();
+        busy = true;
+    }
+
+    return busy;
+}
+
+/*
+ * Description :
+ * This function sends the next block of the file when the send window
+ * has room: a full block, or whatever was read when nothing is in
+ * flight. Once the PC stayed silent for XFER_IDLE_MS and every block was
+ * acknowledged, it sends the end frame instead.
+ * Parameters: None.
+ * Returns: true if a frame was handed to the reliable delivery layer.
+ */
+static bool XferSendBlock(void)
+{
+    bool sent = false;
+    uint16_t count = RingBufferCount(&stageRing);
+    uint8_t freeSlots = ArqWindowFree(LINK_PORT_UART1);
+
+    if (freeSlots == 0U)
+    {
+        /* Wait for an acknowledgement */
+    }
+
+    else if ((count >= (uint16_t)XFER_BLOCK_SIZE) || ((count != 0U) && (freeSlots == ARQ_WINDOW_SIZE)))
+    {
+        uint16_t length = (count > (uint16_t)XFER_BLOCK_SIZE) ? (uint16_t)XFER_BLOCK_SIZE : count;
+        uint16_t i;
+
+        for (i = 0U; i < length; i++)
+        {
+            (void)RingBufferGet(&stageRing, &block[i]);
+        }
+
+        txCrc = CRC16Update(txCrc, block, length);
+        txLength += length;
+        sent = ArqSend(LINK_PORT_UART1, (uint8_t)LINK_FRAME_FILE, block, (uint8_t)length);
+    }
+
+    else if (txActive && !txEnding && (count == 0U) && (freeSlots == ARQ_WINDOW_SIZE) &&
+             ((XferNow() - txLastInputMs) >= XFER_IDLE_MS))
+    {
+        block[0] = (uint8_t)(txLength >> 24);
+        block[1] = (uint8_t)(txLength >> 16);
+        block[2] = (uint8_t)(txLength >> 8);
+        block[3] = (uint8_t)txLength;
+        block[4] = (uint8_t)(txCrc >> 8);
+        block[5] = (uint8_t)txCrc;
+
+        sent = ArqSend(LINK_PORT_UART1, (uint8_t)LINK_FRAME_FILE_END, block, (uint8_t)XFER_END_LENGTH);
+        txEnding = sent;
+    }
+
+    else
+    {
+
+    }
+
+    return sent;
+}
+
+/*
+ * Description :
+ * This function follows the acknowledgements of the file being sent: it
+ * notes when every block read so far was delivered, and reports the file
+ * once its end frame was acknowledged too.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void XferCheckDelivered(void)
+{
+    bool delivered = (ArqWindowFree(LINK_PORT_UART1) == ARQ_WINDOW_SIZE) && (RingBufferCount(&stageRing) == 0U);
+
+    if (txActive && delivered && !txEnding)
+    {
+        txDeliveredMs = XferNow();
+    }
+
+    else if (txActive && delivered)
+    {
+        uint32_t lost = XferInputLost() - txInputLostBase;
+
+        xferStats.filesSent++;
+        xferStats.bytesSent += txLength;
+        xferStats.inputLost += lost;
+
+        XferReport(txDeliveredMs - txStartMs, lost);
+
+        txActive = false;
+        txEnding = false;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function prints the throughput of the file just sent on the
+ * terminal, next to the raw line rates of UART1 and UART0 (10 bits per
+ * byte with the start and stop bits), and the share of the file the link
+ * compression left to send.
+ * Parameters: elapsedMs -> Time from the first byte read to the last one delivered.
+ *             lost      -> UART0 bytes lost while the file was read.
+ * Returns: None.
+ */
+static void XferReport(uint32_t elapsedMs, uint32_t lost)
+{
+    uint32_t ms = (elapsedMs == 0U) ? SYSTICK_PERIOD_MS : elapsedMs;
+    uint32_t goodput = (uint32_t)(((uint64_t)txLength * 1000U) / ms);
+    uint32_t linkBaud = UARTGetBaudRate((uint32_t)UART1_MODULE);
+    uint32_t pcBaud = UARTGetBaudRate((uint32_t)UART0_MODULE);
+
+    uint32_t args[8];
+
+    /* The shares of the line rates and of the file are in 1/100 % */
+    args[0] = txLength;
+    args[1] = ms;
+    args[2] = goodput;
+    args[3] = (linkBaud >= 100U) ? ((goodput * 1000U) / (linkBaud / 100U)) : 0U;
+    args[4] = linkBaud;
+    args[5] = (pcBaud >= 100U) ? ((goodput * 1000U) / (pcBaud / 100U)) : 0U;
+    args[6] = pcBaud;
+    args[7] = (txLength != 0U) ?
+              (uint32_t)(((uint64_t)(txLength - (XferSaved() - txSavedBase)) * 10000U) / txLength) : 0U;
+
+    LogWrite(LOG_FILE_SENT, args, 8U);
+
+    if (lost != 0U)
+    {
+        Log1(LOG_INPUT_LOST, lost);
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function writes received bytes on UART0 unchanged, waiting only
+ * while the transmit ring buffer is full.
+ * Parameters: data   -> The bytes to be written.
+ *             length -> The number of bytes to be written.
+ * Returns: None.
+ */
+static void XferWrite(const uint8_t *data, uint16_t length)
+{
+    uint16_t sent = 0U;
+
+    while (sent < length)
+    {
+        uint16_t count = (uint16_t)(length - sent);
+        uint16_t space = UARTTxFree((uint32_t)UART0_MODULE);
+
+        if (count > space)
+        {
+            count = space;
+        }
+
+        else
+        {
+
+        }
+
+        sent += UARTWrite((uint32_t)UART0_MODULE, &data[sent], count);
+    }
+}
+
+/*
+ * Description :
+ * This function handles a data frame from the other board, handed by
+ * NetPoll() in any state serving the links: the blocks of a file are
+ * written on UART0, its end frame checks the length and the CRC. The
+ * other types are dropped.
+ * Parameters: frame -> The data frame returned by ArqPoll().
+ * Returns: None.
+ */
+static void XferReceiveFrame(const linkFrame_t *frame)
+{
+    if (frame->type == (uint8_t)LINK_FRAME_FILE)
+    {
+        if (!rxActive)
+        {
+            rxActive = true;
+            rxLength = 0U;
+            rxCrc = CRC16_INIT;
+        }
+
+        else
+        {
+
+        }
+
+        XferWrite(frame->payload, (uint16_t)frame->length);
+        rxCrc = CRC16Update(rxCrc, frame->payload, frame->length);
+        rxLength += frame->length;
+    }
+
+    else if ((frame->type == (uint8_t)LINK_FRAME_FILE_END) && (frame->length == XFER_END_LENGTH))
+    {
+        uint32_t length = ((uint32_t)frame->payload[0] << 24) | ((uint32_t)frame->payload[1] << 16) |
+                          ((uint32_t)frame->payload[2] << 8) | (uint32_t)frame->payload[3];
+        uint16_t crc = (uint16_t)(((uint32_t)frame->payload[4] << 8) | (uint32_t)frame->payload[5]);
+
+        if (!rxActive)
+        {
+            rxLength = 0U;
+            rxCrc = CRC16_INIT;
+        }
+
+        else
+        {
+
+        }
+
+        if ((length != rxLength) || (crc != rxCrc))
+        {
+            xferStats.badFiles++;
+        }
+
+        else
+        {
+
+        }
+
+        xferStats.filesReceived++;
+        xferStats.bytesReceived += rxLength;
+        rxActive = false;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function takes the file frames NetPoll() receives, whatever the
+ * state. It must be called after NetInit().
+ * Parameters: None.
+ * Returns: None.
+ */
+void XferInit(void)
+{
+    rxActive = false;
+    NetSetFrameHandler(&XferReceiveFrame);
+}
+
+/*
+ * Description :
+ * This function enters the file transfer state, a file cut short by the
+ * button before is neither finished nor reported. The chat packets are
+ * kept for the chat states meanwhile.
+ * Parameters: None.
+ * Returns: None.
+ */
+void XferRun(void)
+{
+    RingBufferInit(&stageRing, stageStorage, (uint16_t)XFER_STAGE_SIZE);
+    txActive = false;
+    txEnding = false;
+    NetHold(true);
+}
+
+/*
+ * Description :
+ * This function runs the file transfer state once: it sends the file the
+ * PC writes on UART0 to the other board, writes the file received from
+ * the other board on UART0, and reports the throughput of every file
+ * sent on the terminal.
+ * Parameters: None.
+ * Returns: true if it must run again without waiting for an event.
+ */
+bool XferStep(void)
+{
+    bool busy = XferReadInput();
+
+    /* The file frames go to XferReceiveFrame(), the packets passing
+     * through are forwarded and the ones for this board are held */
+    (void)NetPoll();
+
+    if (XferSendBlock())
+    {
+        busy = true;
+    }
+
+    else
+    {
+
+    }
+
+    XferCheckDelivered();
+
+    return busy || XferWorkPending();
+}
+
+/*
+ * Description :
+ * This function leaves the file transfer state, the chat packets kept
+ * meanwhile go to the chat states.
+ * Parameters: None.
+ * Returns: None.
+ */
+void XferLeave(void)
+{
+    NetHold(false);
+}
+
+/*
+ * Description :
+ * This function copies the file transfer counters.
+ * Parameters: stats -> A pointer to the structure where the counters will be stored.
+ * Returns: None.
+ */
+void XferGetStats(xferStats_t *stats)
+{
+    if (NULL != stats)
+    {
+        *stats = xferStats;
+    }
+
+    else
+    {
+
+    }
+}
@@ -0,0 +1,128 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   xfer.h                                                       *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file for the file transfer state, forwarding a file   *
+ *                from the PC of one board to the PC of the other one          *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef XFER_H_
+#define XFER_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "HAL/arq.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/*
+ * The bytes the PC sends on UART0 are forwarded as they arrive in
+ * LINK_FRAME_FILE frames of up to XFER_BLOCK_SIZE bytes, the reliable
+ * delivery layer keeping ARQ_WINDOW_SIZE of them in flight. A block leaves
+ * once it is full, or at once when nothing is in flight, so the blocks
+ * grow with the round trip time. The file ends when the PC sent nothing
+ * for XFER_IDLE_MS, a LINK_FRAME_FILE_END frame then carries its length
+ * and CRC-16:
+ *   LENGTH (4 bytes, most significant first) | CRC high | CRC low
+ * The other board writes the blocks unchanged to its UART0 and checks the
+ * length and CRC at the end, in any state serving the links: NetPoll()
+ * hands it the file frames (XferInit()).
+ */
+#define XFER_BLOCK_SIZE ARQ_MAX_PAYLOAD
+
+/* Silence on UART0 that ends the file being sent */
+#define XFER_IDLE_MS 1000U
+
+/* Bytes of the file read from UART0 and waiting for room in the send
+ * window, must be a power of two */
+#define XFER_STAGE_SIZE 1024U
+
+/* Payload bytes of a LINK_FRAME_FILE_END frame */
+#define XFER_END_LENGTH 6U
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Structure holding the file transfer counters.
+ *              - filesSent     : Files sent and acknowledged by the other board.
+ *              - bytesSent     : Bytes of those files.
+ *              - inputLost     : UART0 bytes lost while a file was being read,
+ *                                the PC sending faster than the link carries them.
+ *              - filesReceived : Files received up to their end frame.
+ *              - bytesReceived : Bytes of those files.
+ *              - badFiles      : Files received with a wrong length or CRC.
+ */
+typedef struct
+{
+    uint32_t filesSent;
+    uint32_t bytesSent;
+    uint32_t inputLost;
+    uint32_t filesReceived;
+    uint32_t bytesReceived;
+    uint32_t badFiles;
+} xferStats_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function takes the file frames NetPoll() receives, whatever the
+ * state. It must be called after NetInit().
+ * Parameters: None.
+ * Returns: None.
+ */
+void XferInit(void);
+
+/*
+ * Description :
+ * This function enters the file transfer state, a file cut short by the
+ * button before is neither finished nor reported. The chat packets are
+ * kept for the chat states meanwhile.
+ * Parameters: None.
+ * Returns: None.
+ */
+void XferRun(void);
+
+/*
+ * Description :
+ * This function runs the file transfer state once: it sends the file the
+ * PC writes on UART0 to the other board, writes the file received from
+ * the other board on UART0, and reports the throughput of every file
+ * sent on the terminal.
+ * Parameters: None.
+ * Returns: true if it must run again without waiting for an event.
+ */
+bool XferStep(void);
+
+/*
+ * Description :
+ * This function leaves the file transfer state, the chat packets kept
+ * meanwhile go to the chat states.
+ * Parameters: None.
+ * Returns: None.
+ */
+void XferLeave(void);
+
+/*
+ * Description :
+ * This function copies the file transfer counters.
+ * Parameters: stats -> A pointer to the structure where the counters will be stored.
+ * Returns: None.
+ */
+void XferGetStats(xferStats_t *stats);
+
+#endif /* XFER_H_ */
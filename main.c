@@ -26,12 +26,71 @@
 #include "driverlib/systick.h"
 #include "HAL/switch.h"
 #include "HAL/UART_API.h"
+#include "HAL/baud.h"
+#include "HAL/crc.h"
+#include "HAL/clock.h"
+#include "HAL/power.h"
+#include "HAL/sched.h"
+#include "HAL/timebase.h"
+#include "HAL/profile.h"
+#include "HAL/trace.h"
+#include "HAL/log.h"
+#include "HAL/bench.h"
+#include "HAL/frag.h"
+#include "HAL/net.h"
+#include "HAL/xfer.h"
+#include "HAL/ping.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* The scheduler timer ticking the protocols (retransmissions, announcements,
+ * baud rate monitor, end of a file), once every SysTick period */
+#define MAIN_TICK_TIMER 0U
+#define MAIN_TICK_MS SYSTICK_PERIOD_MS
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Structure describing a state of the application.
+ *              - enter : Runs once when the button selects the state.
+ *              - step  : Runs on every event while in the state, returns true
+ *                        while it has more work, NULL if the state only waits.
+ *              - leave : Runs once when the button selects the next state, may be NULL.
+ */
+typedef struct
+{
+    void (*enter)(void);
+    bool (*step)(void);
+    void (*leave)(void);
+} mainState_t;
 
 /*******************************************************************************
  *                            Global Variables                                 *
  *******************************************************************************/
-int8_t flag_state = 0;
-uint8_t flag_interrupt = 1U;
+/* Both flags are written by the button callback, in the GPIO or SysTick ISR */
+volatile int8_t flag_state = 0;
+volatile uint8_t flag_interrupt = 1U;
+
+/*
+ * An array of the states, selected in turn by the button.
+ *   - Element 0: The UARTOff state.
+ *   - Element 1: The UARTListen state.
+ *   - Element 2: The UARTSendAndReceive state.
+ *   - Element 3: The XferRun state.
+ *   - Element 4: The PingRun state.
+ */
+static const mainState_t states_map[STATES_NUMBER] = {
+                {&UARTOff , NULL , NULL} ,
+                {&UARTListen , &UARTListenStep , &UARTListenLeave} ,
+                {&UARTSendandReceive , &UARTSendandReceiveStep , &UARTSendandReceiveLeave} ,
+                {&XferRun , &XferStep , &XferLeave} ,
+                {&PingRun , &PingStep , &PingLeave}
+};
+
+/* The state running, flag_state is the one the button selected */
+static uint8_t mainState = 0U;
 
 /*******************************************************************************
  *                      Functions Prototypes                                   *
@@ -42,35 +101,207 @@ uint8_t flag_interrupt = 1U;
  */
 void main(void);
 
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static void MainButtonEvent(button_t *btn, buttonEvent_t event);
+static void MainButton(void);
+static void MainStep(void);
+static void MainTick(void);
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function is told about the events of the button, in an ISR: a
+ * press selects the next state, holding the button selects the Off state.
+ * Parameters: btn   -> The button.
+ *             event -> The button event.
+ * Returns: None.
+ */
+static void MainButtonEvent(button_t *btn, buttonEvent_t event)
+{
+    (void)btn;
+
+    if (event == BUTTON_EVENT_PRESS)
+    {
+        flag_state = (int8_t)(((uint8_t)flag_state + 1U) % STATES_NUMBER);
+        flag_interrupt = 1U;
+        SchedPost(SCHED_EVENT_BUTTON);
+    }
+
+    else if ((event == BUTTON_EVENT_LONG_PRESS) && (flag_state != 0))
+    {
+        flag_state = 0;
+        flag_interrupt = 1U;
+        SchedPost(SCHED_EVENT_BUTTON);
+    }
+
+    else
+    {
+
+    }
+
+    TRACE_INSTANT(TRACE_EVENT_BUTTON, ((uint32_t)(uint8_t)flag_state << 8) | (uint32_t)event);
+}
+
+/*
+ * Description :
+ * This function handles the button event: it leaves the running state
+ * and enters the one the button selected.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void MainButton(void)
+{
+    flag_interrupt = 0U;
+
+    if (NULL != states_map[mainState].leave)
+    {
+        states_map[mainState].leave();
+    }
+
+    else
+    {
+
+    }
+
+    TRACE_END(TRACE_EVENT_STATE, mainState);
+    mainState = (uint8_t)flag_state;
+    TRACE_BEGIN(TRACE_EVENT_STATE, mainState);
+    states_map[mainState].enter();
+
+    /* Give the new state a first run */
+    SchedPost(SCHED_EVENT_WORK);
+}
+
+/*
+ * Description :
+ * This function handles the data, tick and work events: it runs the
+ * running state once, and again later while it has more work, so the
+ * events of higher priority are served in between.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void MainStep(void)
+{
+    if ((NULL != states_map[mainState].step) && states_map[mainState].step())
+    {
+        SchedPost(SCHED_EVENT_WORK);
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function handles the tick event: it streams the trace records
+ * (TRACE_MODE) on UART0, runs the baud rate negotiation whatever the
+ * state and runs the running state once.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void MainTick(void)
+{
+#if (TRACE_MODE == 1U)
+    (void)TraceFlush();
+#endif
+
+    BaudPoll();
+    MainStep();
+}
+
 /*******************************************************************************
  *                              Main Function                                  *
  *******************************************************************************/
 void main(void)
 {
+    /* Run the core at its full speed before any peripheral is set up */
+    ClockInit();
+
+    /* Start the microsecond timebase the messages are stamped with */
+    TimebaseInit();
+
+    /* Clear the counters of the profiling probes (PROFILE_MODE) */
+    ProfileInit();
+
+    /* Empty the event trace (TRACE_MODE) */
+    TraceInit();
+
     /* Initialize the UART driver */
     UARTInit();
 
-    /* Initialize the Switch driver */
-    SwitchInit();
+    /* Start the log of the terminal messages (LOG_MODE) */
+    LogInit();
 
-    /*
-     * An array of function pointers representing different states.
-     *   - Element 0: Points to the UARTOff function.
-     *   - Element 1: Points to the UARTListen function.
-     *   - Element 2: Points to the UARTSendAndReceive function.
-     */
-    void (*states_map[3])(void) = {&UARTOff , &UARTListen , &UARTSendandReceive};
+#if (UART_PRINT_BAUD_TABLE == 1U)
+    /* Show the baud rates the UARTs can run at with this clock */
+    UARTPrintBaudTable();
+#endif
 
-    while(1)
+    /* Initialize the framed links to the neighbouring boards, the
+     * reliable delivery on top of them, the network routing the
+     * packets across the boards, the fragmentation of the messages
+     * and the baud rate negotiation, the ping frames taking their
+     * place among its control frames, and the file frames */
+    LinkInit();
+    ArqInit();
+    NetInit();
+    FragInit();
+    BaudInit();
+    PingInit();
+    XferInit();
+
+    /* Show the address the other boards reach this one at */
+    Log1(LOG_NODE, NetGetAddress());
+
+    /* Show the cost of the frame CRC, and the share of the CPU it takes
+     * with UART1 receiving without a pause at the top negotiated rate */
     {
-        /* Checks the flag_interrupt condition, and if it is true,
-         * calls the function pointed to by the states_map at the index
-         * specified by flag_state */
-        if (flag_interrupt)
-        {
-            states_map[flag_state]();
-        }
+        uint32_t crcCycles = CRC16Benchmark();
+
+        Log3(LOG_CRC_COST, crcCycles, CRC16LoadX100(crcCycles, BAUD_MAX_RATE), BAUD_MAX_RATE);
     }
-}
 
+#if (TRACE_MODE == 1U)
+    /* Show the cost of a trace point, the records follow in bursts */
+    {
+        traceStats_t traceStats;
 
+        TraceGetStats(&traceStats);
+        Log1(LOG_TRACE_COST, traceStats.overheadCycles);
+    }
+#endif
+
+    /* Start the scheduler before the ISRs post their events */
+    SchedInit();
+
+    /* Initialize the Switch driver, the button events select the states */
+    SwitchInit(&MainButtonEvent);
+
+    /* Start the idle time measurements */
+    PowerInit();
+
+#if (BENCH_MODE == 1U)
+    /* The benchmark suite takes the place of the chat, it never returns */
+    BenchRun();
+#endif
+
+    /* The button changes the state, every other event runs the state */
+    SchedSubscribe(SCHED_EVENT_BUTTON, &MainButton);
+    SchedSubscribe(SCHED_EVENT_LINK, &MainStep);
+    SchedSubscribe(SCHED_EVENT_TERMINAL, &MainStep);
+    SchedSubscribe(SCHED_EVENT_TICK, &MainTick);
+    SchedSubscribe(SCHED_EVENT_WORK, &MainStep);
+    SchedTimerStart(MAIN_TICK_TIMER, SCHED_EVENT_TICK, MAIN_TICK_MS, true);
+
+    /* Enter the first state, the button selects the next ones */
+    SchedPost(SCHED_EVENT_BUTTON);
+
+    /* Run the handlers of the events as they come, it never returns */
+    SchedRun();
+}
@@ -0,0 +1,21 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   flash.h                                                      *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: host simulation stand-in for the TivaWare driverlib          *
+ *                header driverlib/flash.h, only what the firmware uses        *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef __DRIVERLIB_FLASH_H__
+#define __DRIVERLIB_FLASH_H__
+#include <stdint.h>
+extern int32_t FlashUserGet(uint32_t *pui32User0, uint32_t *pui32User1);
+#endif
@@ -0,0 +1,28 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   interrupt.h                                                  *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: host simulation stand-in for the TivaWare driverlib          *
+ *                header driverlib/interrupt.h, only what the firmware uses    *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef __DRIVERLIB_INTERRUPT_H__
+#define __DRIVERLIB_INTERRUPT_H__
+#include <stdint.h>
+#include <stdbool.h>
+extern bool IntMasterEnable(void);
+extern bool IntMasterDisable(void);
+extern void IntRegister(uint32_t ui32Interrupt, void (*pfnHandler)(void));
+extern void IntPrioritySet(uint32_t ui32Interrupt, uint8_t ui8Priority);
+extern void IntEnable(uint32_t ui32Interrupt);
+extern void IntDisable(uint32_t ui32Interrupt);
+extern void IntPendSet(uint32_t ui32Interrupt);
+#endif
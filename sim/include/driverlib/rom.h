@@ -0,0 +1,19 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   rom.h                                                        *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: host simulation stand-in for the TivaWare driverlib          *
+ *                header driverlib/rom.h, only what the firmware uses          *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef __DRIVERLIB_ROM_H__
+#define __DRIVERLIB_ROM_H__
+#endif
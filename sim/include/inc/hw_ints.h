@@ -0,0 +1,35 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   hw_ints.h                                                    *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: host simulation stand-in for the TivaWare register           *
+ *                header inc/hw_ints.h, only what the firmware uses            *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef __HW_INTS_H__
+#define __HW_INTS_H__
+#define FAULT_SYSTICK           15
+#define INT_GPIOA               16
+#define INT_GPIOB               17
+#define INT_GPIOC               18
+#define INT_GPIOD               19
+#define INT_GPIOE               20
+#define INT_GPIOF               46
+#define INT_UART0               21
+#define INT_UART1               22
+#define INT_UART2               49
+#define INT_UART3               75
+#define INT_TIMER0A             35
+#define INT_TIMER1A             37
+#define INT_WTIMER0A            110
+#define INT_UDMAERR             63
+#define NUM_INTERRUPTS          155
+#endif
@@ -0,0 +1,21 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   hw_nvic.h                                                    *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: host simulation stand-in for the TivaWare register           *
+ *                header inc/hw_nvic.h, only what the firmware uses            *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef __HW_NVIC_H__
+#define __HW_NVIC_H__
+#define NVIC_INT_CTRL           0xE000ED04
+#define NVIC_INT_CTRL_PEND_SYST 0x04000000
+#endif
@@ -0,0 +1,23 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   hw_types.h                                                   *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: host simulation stand-in for the TivaWare register           *
+ *                header inc/hw_types.h, only what the firmware uses           *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef __HW_TYPES_H__
+#define __HW_TYPES_H__
+#include <stdint.h>
+#include <stdbool.h>
+extern volatile uint32_t *SimRegister(uint32_t ui32Addr);
+#define HWREG(x) (*SimRegister((uint32_t)(x)))
+#endif
@@ -0,0 +1,53 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   hw_uart.h                                                    *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: host simulation stand-in for the TivaWare register           *
+ *                header inc/hw_uart.h, only what the firmware uses            *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef __HW_UART_H__
+#define __HW_UART_H__
+#define UART_O_DR               0x00000000
+#define UART_O_RSR              0x00000004
+#define UART_O_FR               0x00000018
+#define UART_O_IBRD             0x00000024
+#define UART_O_FBRD             0x00000028
+#define UART_O_LCRH             0x0000002C
+#define UART_O_CTL              0x00000030
+#define UART_O_IFLS             0x00000034
+#define UART_O_IM               0x00000038
+#define UART_O_RIS              0x0000003C
+#define UART_O_MIS              0x00000040
+#define UART_O_ICR              0x00000044
+#define UART_O_DMACTL           0x00000048
+#define UART_O_9BITADDR         0x000000A4
+#define UART_O_9BITAMASK        0x000000A8
+#define UART_FR_TXFE            0x00000080
+#define UART_FR_RXFF            0x00000040
+#define UART_FR_TXFF            0x00000020
+#define UART_FR_RXFE            0x00000010
+#define UART_FR_BUSY            0x00000008
+#define UART_LCRH_WLEN_M        0x00000060
+#define UART_LCRH_WLEN_S        5
+#define UART_LCRH_FEN           0x00000010
+#define UART_LCRH_STP2          0x00000008
+#define UART_LCRH_PEN           0x00000002
+#define UART_CTL_RXE            0x00000200
+#define UART_CTL_TXE            0x00000100
+#define UART_CTL_HSE            0x00000020
+#define UART_CTL_EOT            0x00000010
+#define UART_CTL_UARTEN         0x00000001
+#define UART_IFLS_RX_M          0x00000038
+#define UART_IFLS_RX_S          3
+#define UART_IFLS_TX_M          0x00000007
+#define UART_9BITADDR_9BITEN    0x00008000
+#endif
@@ -0,0 +1,143 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   sim.h                                                        *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: header file shared by the models of the host simulation,     *
+ *                where the firmware runs against a fake driverlib             *
+ *                                                                             *
+ *******************************************************************************/
+
+#ifndef SIM_H_
+#define SIM_H_
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include <poll.h>
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* Period of the host timer signal standing in for the interrupt sources, the
+ * models are brought up to date and the pending ISRs run at least this often */
+#define SIM_TICK_US 50U
+
+/* Time a button stays pressed after a press request, or a hold request,
+ * and its contacts
+ * bouncing for SIM_BUTTON_BOUNCE_US when pressed and when released,
+ * changing every SIM_BUTTON_BOUNCE_STEP_US */
+#define SIM_BUTTON_PRESS_MS 150U
+#define SIM_BUTTON_HOLD_MS 1500U
+#define SIM_BUTTON_BOUNCE_US 2000U
+#define SIM_BUTTON_BOUNCE_STEP_US 250U
+
+/* A UART RX pin sees a framing error when the two ends of a wire run
+ * at rates further apart than this, in 1/100 % */
+#define SIM_BAUD_TOLERANCE_X100 300U
+
+/* Bytes carried per packet on the virtual wires */
+#define SIM_WIRE_BATCH 64U
+
+/* No interrupt pending */
+#define SIM_IRQ_NONE 0xFFFFFFFFU
+
+/* No timed event to come */
+#define SIM_NO_TIME 0xFFFFFFFFFFFFFFFFU
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Structure describing one simulated board.
+ *              - id          : The board number, 0 for board A, 1 for board B...
+ *              - consoleFd   : The UART0 end of the PC terminal (a PTY master), raw bytes.
+ *              - wireFd      : The UART1 end of the virtual wire to the previous board,
+ *                              to board B for board A.
+ *              - spareWireFd : The UART3 end of the virtual wire to the next board, or
+ *                              of the RS-485 bus, -1 if there is none.
+ *              - busPeer     : The bus address of the board UART3 talks to on the
+ *                              RS-485 bus, 0 when UART3 is not on the bus.
+ *              - errorPpm    : Bytes corrupted on the wires, per million.
+ *              - maxBaud     : Fastest rate the wires carry cleanly, 0 for no limit.
+ */
+typedef struct
+{
+    uint8_t id;
+    int consoleFd;
+    int wireFd;
+    int spareWireFd;
+    uint8_t busPeer;
+    uint32_t errorPpm;
+    uint32_t maxBaud;
+} simBoardConfig_t;
+
+/*
+ * Description: One byte on a virtual wire.
+ *              - arrivalNs : CLOCK_MONOTONIC time the stop bit reaches the other end.
+ *              - baud      : The rate the byte was sent at.
+ *              - data      : The byte.
+ *              - error     : The receive status bits (UART_RXERROR_xxx) it arrives with.
+ *              - address   : The 9th bit is set, the byte is an address in 9-bit mode.
+ */
+typedef struct
+{
+    uint64_t arrivalNs;
+    uint32_t baud;
+    uint8_t data;
+    uint8_t error;
+    bool address;
+} simWireByte_t;
+
+/*******************************************************************************
+ *                      Functions Prototypes                                   *
+ *******************************************************************************/
+/* The firmware main(), renamed by the build */
+void FirmwareMain(void);
+
+/* Core, sim_core.c */
+void SimBoardRun(const simBoardConfig_t *config);
+const simBoardConfig_t* SimBoardGetConfig(void);
+uint64_t SimNowNs(void);
+uint32_t SimClockHz(void);
+uint32_t SimRandom(void);
+void SimLock(void);
+void SimUnlock(void);
+void SimSync(void);
+bool SimInIsr(uint32_t irq);
+bool SimIrqEnabled(uint32_t irq);
+
+/* UART model, sim_uart.c */
+void SimUartInit(const simBoardConfig_t *config);
+void SimUartUpdate(uint64_t nowNs, bool stopOnIrq);
+bool SimUartIrqAsserted(uint32_t irq);
+void SimUartIrqEnter(uint32_t irq);
+void SimUartIrqExit(uint32_t irq);
+void SimUartFlushWire(void);
+uint64_t SimUartNextEventNs(uint64_t nowNs);
+uint8_t SimUartPollFds(struct pollfd *fds);
+volatile uint32_t* SimUartRegister(uint32_t addr);
+bool SimUartDmaRead(uint32_t base, uint8_t *data);
+bool SimUartDmaWrite(uint32_t base, uint8_t data, uint64_t writeNs);
+void SimUartDmaDone(uint32_t base);
+bool SimUartDmaEnabled(uint32_t base, uint32_t flags);
+
+/* uDMA model, sim_udma.c */
+void SimUdmaService(uint32_t base);
+
+/* GPIO model, sim_gpio.c */
+void SimGpioInit(void);
+void SimGpioPress(uint8_t pins, uint32_t ms);
+void SimGpioUpdate(uint64_t nowNs);
+bool SimGpioIrqAsserted(uint32_t irq);
+uint64_t SimGpioNextEventNs(uint64_t nowNs);
+
+#endif /* SIM_H_ */
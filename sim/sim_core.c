@@ -0,0 +1,1001 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   sim_core.c                                                   *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the core of the host simulation: time base,  *
+ *                system clock, NVIC, SysTick, sleep and the register space    *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <errno.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/time.h>
+#include "sim.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_nvic.h"
+#include "inc/hw_types.h"
+#include "driverlib/flash.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/systick.h"
+#include "driverlib/timer.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define SIM_PIOSC_HZ     16000000U
+#define SIM_PLL_HZ       200000000U
+#define SIM_DWT_CYCCNT   0xE0001004U
+#define SIM_SCRATCH_REGS 32U
+
+/* SYSDIV, SYSDIV2LSB and DIV400 fields of the SysCtlClockSet() configuration */
+#define SIM_SYSDIV_MASK  0xC7C00000U
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Structure holding the SysTick model, the counter is
+ *              kept as the CPU cycle of its next wrap.
+ */
+typedef struct
+{
+    bool enabled;
+    bool intEnabled;
+    bool pending;
+    uint32_t reload;
+    uint64_t nextWrap;
+} simSysTick_t;
+
+/*
+ * Description: Structure holding the model of the wide timer run as one
+ *              64-bit counter counting up at the CPU clock, kept as the
+ *              CPU cycle its count was 0 and the count when stopped.
+ */
+typedef struct
+{
+    bool enabled;
+    uint64_t start;
+    uint64_t value;
+    uint64_t load;
+} simWideTimer_t;
+
+/*******************************************************************************
+ *                            Global Variables                                 *
+ *******************************************************************************/
+static simBoardConfig_t boardConfig;
+
+/* The cycle counter runs at clockHz since clockBaseNs, when it read clockBaseCycles */
+static uint32_t clockHz = SIM_PIOSC_HZ;
+static uint64_t clockBaseNs = 0U;
+static uint64_t clockBaseCycles = 0U;
+
+static uint32_t randomState = 1U;
+
+/* NVIC: handlers, enables and software pending bits, PRIMASK */
+static void (*irqHandlers[NUM_INTERRUPTS])(void);
+static bool irqEnabled[NUM_INTERRUPTS];
+static bool irqSoftPending[NUM_INTERRUPTS];
+static volatile sig_atomic_t primask = 0;
+
+/* The models are only touched by one context at a time: a driverlib call
+ * holds the lock, the timer signal defers its work while it is held */
+static volatile sig_atomic_t lockDepth = 0;
+static volatile sig_atomic_t serviceActive = 0;
+static volatile sig_atomic_t serviceDeferred = 0;
+static volatile uint32_t activeIrq = SIM_IRQ_NONE;
+static volatile uint32_t isrCount = 0U;
+
+static simSysTick_t sysTick;
+static simWideTimer_t wideTimer;
+
+static struct
+{
+    uint32_t addr;
+    uint32_t value;
+} scratchRegs[SIM_SCRATCH_REGS];
+static uint32_t computedReg;
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static uint64_t SimCycles(void);
+static uint64_t SimCyclesToNs(uint64_t cycles);
+static void SimSysTickUpdate(uint64_t cycles);
+static void SimUpdate(bool stopOnIrq);
+static uint32_t SimNextIrq(void);
+static void SimRunIsr(uint32_t irq);
+static void SimService(void);
+static void SimWaitEvent(void);
+static void SimTimerSignal(int sig);
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function returns the CPU cycles since the board started.
+ * Parameters: None.
+ * Returns: The CPU cycle count.
+ */
+static uint64_t SimCycles(void)
+{
+    unsigned __int128 elapsed = (unsigned __int128)(SimNowNs() - clockBaseNs) * clockHz;
+
+    return clockBaseCycles + (uint64_t)(elapsed / 1000000000U);
+}
+
+/*
+ * Description :
+ * This function converts a CPU cycle count into the host time it is reached.
+ * Parameters: cycles -> The CPU cycle count.
+ * Returns: The CLOCK_MONOTONIC time in ns.
+ */
+static uint64_t SimCyclesToNs(uint64_t cycles)
+{
+    uint64_t ns = clockBaseNs;
+
+    if (cycles > clockBaseCycles)
+    {
+        ns += (uint64_t)(((unsigned __int128)(cycles - clockBaseCycles) * 1000000000U) / clockHz);
+    }
+
+    else
+    {
+
+    }
+
+    return ns;
+}
+
+/*
+ * Description :
+ * This function wraps the SysTick counter as many times as it reached
+ * zero, raising its interrupt once like the hardware does.
+ * Parameters: cycles -> The current CPU cycle count.
+ * Returns: None.
+ */
+static void SimSysTickUpdate(uint64_t cycles)
+{
+    if (sysTick.enabled && (cycles >= sysTick.nextWrap))
+    {
+        uint64_t period = (uint64_t)sysTick.reload + 1U;
+
+        sysTick.nextWrap += ((cycles - sysTick.nextWrap) / period + 1U) * period;
+        sysTick.pending = sysTick.pending || sysTick.intEnabled;
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function brings every model up to the current time.
+ * Parameters: stopOnIrq -> Stop delivering received bytes once an interrupt is raised.
+ * Returns: None.
+ */
+static void SimUpdate(bool stopOnIrq)
+{
+    uint64_t now = SimNowNs();
+
+    SimUartUpdate(now, stopOnIrq);
+    SimGpioUpdate(now);
+    SimSysTickUpdate(SimCycles());
+}
+
+/*
+ * Description :
+ * This function returns the pending interrupt the NVIC takes next, the
+ * SysTick exception first then the lowest IRQ number, all priorities
+ * being equal.
+ * Parameters: None.
+ * Returns: The interrupt number, or SIM_IRQ_NONE.
+ */
+static uint32_t SimNextIrq(void)
+{
+    uint32_t irq = SIM_IRQ_NONE;
+    uint32_t i;
+
+    if (sysTick.pending)
+    {
+        irq = (uint32_t)FAULT_SYSTICK;
+    }
+
+    else
+    {
+        for (i = (uint32_t)INT_GPIOA; (i < (uint32_t)NUM_INTERRUPTS) && (irq == SIM_IRQ_NONE); i++)
+        {
+            if (irqEnabled[i] && (irqSoftPending[i] || SimUartIrqAsserted(i) || SimGpioIrqAsserted(i)))
+            {
+                irq = i;
+            }
+
+            else
+            {
+
+            }
+        }
+    }
+
+    return irq;
+}
+
+/*
+ * Description :
+ * This function runs the handler of an interrupt, the way the core
+ * enters and leaves an exception.
+ * Parameters: irq -> The interrupt number.
+ * Returns: None.
+ */
+static void SimRunIsr(uint32_t irq)
+{
+    if (irq == (uint32_t)FAULT_SYSTICK)
+    {
+        sysTick.pending = false;
+    }
+
+    else
+    {
+        irqSoftPending[irq] = false;
+    }
+
+    activeIrq = irq;
+    SimUartIrqEnter(irq);
+
+    if (NULL != irqHandlers[irq])
+    {
+        irqHandlers[irq]();
+    }
+
+    else
+    {
+        /* The hardware would spin in the default handler, keep running instead */
+        fprintf(stderr, "sim: board %c: interrupt %u has no handler, disabled\n",
+                (char)('A' + boardConfig.id), (unsigned)irq);
+        irqEnabled[irq] = false;
+    }
+
+    SimUartIrqExit(irq);
+    activeIrq = SIM_IRQ_NONE;
+    isrCount++;
+    SimUartFlushWire();
+}
+
+/*
+ * Description :
+ * This function updates the models and runs the pending ISRs until none
+ * is left, it is what the hardware does between two instructions.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void SimService(void)
+{
+    uint32_t irq;
+
+    if (serviceActive != 0)
+    {
+        serviceDeferred = 1;
+        return;
+    }
+
+    else
+    {
+
+    }
+
+    serviceActive = 1;
+
+    do
+    {
+        serviceDeferred = 0;
+        SimUpdate(true);
+
+        while ((primask == 0) && ((irq = SimNextIrq()) != SIM_IRQ_NONE))
+        {
+            SimRunIsr(irq);
+            SimUpdate(true);
+        }
+    } while (serviceDeferred != 0);
+
+    SimUartFlushWire();
+    serviceActive = 0;
+}
+
+/*
+ * Description :
+ * This function blocks the host until a wire or a terminal has data or
+ * the next timed event of the models is due. The timer signal is held
+ * meanwhile so that an idle board does not wake up needlessly.
+ * Parameters: None.
+ * Returns: None.
+ */
+static void SimWaitEvent(void)
+{
+    struct pollfd fds[4];
+    struct timespec timeout;
+    sigset_t mask;
+    uint64_t now = SimNowNs();
+    uint64_t next = SimUartNextEventNs(now);
+    uint64_t button = SimGpioNextEventNs(now);
+    uint64_t wait;
+    uint8_t count = SimUartPollFds(fds);
+
+    next = (button < next) ? button : next;
+
+    if (sysTick.enabled && sysTick.intEnabled)
+    {
+        uint64_t wrap = SimCyclesToNs(sysTick.nextWrap);
+
+        next = (wrap < next) ? wrap : next;
+    }
+
+    else
+    {
+
+    }
+
+    wait = (next > now) ? (next - now) : 0U;
+    wait = (wait > 100000000U) ? 100000000U : wait;
+    timeout.tv_sec = (time_t)(wait / 1000000000U);
+    timeout.tv_nsec = (long)(wait % 1000000000U);
+
+    (void)sigprocmask(SIG_BLOCK, NULL, &mask);
+    (void)sigaddset(&mask, SIGALRM);
+    (void)ppoll(fds, (nfds_t)count, &timeout, &mask);
+}
+
+/*
+ * Description :
+ * Handler of the host timer signal, it plays the role of the
+ * interrupt lines: pending ISRs run as soon as nothing holds the models.
+ * Parameters: sig -> The signal number.
+ * Returns: None.
+ */
+static void SimTimerSignal(int sig)
+{
+    int savedErrno = errno;
+
+    (void)sig;
+
+    if ((lockDepth != 0) || (serviceActive != 0))
+    {
+        serviceDeferred = 1;
+    }
+
+    else
+    {
+        SimService();
+    }
+
+    errno = savedErrno;
+}
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function starts the models of a board and runs its firmware.
+ * Parameters: config -> The board wiring and the wire impairments.
+ * Returns: None, the process exits when the firmware returns.
+ */
+void SimBoardRun(const simBoardConfig_t *config)
+{
+    struct sigaction action;
+    struct itimerval timer;
+
+    boardConfig = *config;
+    clockBaseNs = SimNowNs();
+    randomState = (uint32_t)clockBaseNs ^ ((uint32_t)config->id * 0x9E3779B9U) ^ 0x5A5A5A5AU;
+    randomState = (randomState != 0U) ? randomState : 1U;
+
+    SimUartInit(&boardConfig);
+    SimGpioInit();
+
+    (void)memset(&action, 0, sizeof(action));
+    action.sa_handler = &SimTimerSignal;
+    action.sa_flags = SA_RESTART;
+    (void)sigemptyset(&action.sa_mask);
+    (void)sigaction(SIGALRM, &action, NULL);
+
+    timer.it_interval.tv_sec = 0;
+    timer.it_interval.tv_usec = (suseconds_t)SIM_TICK_US;
+    timer.it_value = timer.it_interval;
+    (void)setitimer(ITIMER_REAL, &timer, NULL);
+
+    FirmwareMain();
+
+    exit(EXIT_SUCCESS);
+}
+
+/*
+ * Description :
+ * This function returns the description of the running board.
+ * Parameters: None.
+ * Returns: A pointer to the board configuration.
+ */
+const simBoardConfig_t* SimBoardGetConfig(void)
+{
+    return &boardConfig;
+}
+
+/*
+ * Description :
+ * This function returns the host time shared by both boards.
+ * Parameters: None.
+ * Returns: The CLOCK_MONOTONIC time in ns.
+ */
+uint64_t SimNowNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000000U) + (uint64_t)now.tv_nsec;
+}
+
+/*
+ * Description :
+ * This function returns the system clock frequency set by SysCtlClockSet().
+ * Parameters: None.
+ * Returns: The system clock frequency in Hz.
+ */
+uint32_t SimClockHz(void)
+{
+    return clockHz;
+}
+
+/*
+ * Description :
+ * This function returns a pseudo random number for the wire impairments.
+ * Parameters: None.
+ * Returns: A 32-bit pseudo random number.
+ */
+uint32_t SimRandom(void)
+{
+    /* xorshift32 */
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+
+    return randomState;
+}
+
+/*
+ * Description :
+ * This function takes the models for a driverlib call.
+ * Parameters: None.
+ * Returns: None.
+ */
+void SimLock(void)
+{
+    lockDepth++;
+}
+
+/*
+ * Description :
+ * This function releases the models after a driverlib call. Outside an
+ * ISR the interrupts raised meanwhile are taken right away, as the core
+ * would take them after the store that raised them.
+ * Parameters: None.
+ * Returns: None.
+ */
+void SimUnlock(void)
+{
+    lockDepth--;
+
+    if ((lockDepth == 0) && (serviceActive == 0))
+    {
+        SimService();
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function brings the models up to date and runs the pending ISRs
+ * before a driverlib call changes a peripheral, so that what happened
+ * before the change is seen with the old settings.
+ * Parameters: None.
+ * Returns: None.
+ */
+void SimSync(void)
+{
+    if ((lockDepth == 0) && (serviceActive == 0))
+    {
+        SimService();
+    }
+
+    else
+    {
+
+    }
+}
+
+/*
+ * Description :
+ * This function tells whether the given interrupt handler is running.
+ * Parameters: irq -> The interrupt number.
+ * Returns: true inside the handler of irq.
+ */
+bool SimInIsr(uint32_t irq)
+{
+    return (activeIrq == irq);
+}
+
+/*
+ * Description :
+ * This function tells whether the NVIC lets the given interrupt through.
+ * Parameters: irq -> The interrupt number.
+ * Returns: true if the interrupt is enabled.
+ */
+bool SimIrqEnabled(uint32_t irq)
+{
+    return (irq < (uint32_t)NUM_INTERRUPTS) && irqEnabled[irq];
+}
+
+/*
+ * Description :
+ * This function maps a register address on its model, registers without
+ * a model are plain memory.
+ * Parameters: ui32Addr -> The register address.
+ * Returns: A pointer to the register.
+ */
+volatile uint32_t* SimRegister(uint32_t ui32Addr)
+{
+    volatile uint32_t *reg = SimUartRegister(ui32Addr);
+    uint32_t i;
+
+    if (NULL != reg)
+    {
+        return reg;
+    }
+
+    else if (ui32Addr == SIM_DWT_CYCCNT)
+    {
+        computedReg = (uint32_t)SimCycles();
+        return &computedReg;
+    }
+
+    else if (ui32Addr == (uint32_t)NVIC_INT_CTRL)
+    {
+        computedReg = sysTick.pending ? (uint32_t)NVIC_INT_CTRL_PEND_SYST : 0U;
+        return &computedReg;
+    }
+
+    else
+    {
+
+    }
+
+    for (i = 0U; i < SIM_SCRATCH_REGS; i++)
+    {
+        if ((scratchRegs[i].addr == ui32Addr) || (scratchRegs[i].addr == 0U))
+        {
+            scratchRegs[i].addr = ui32Addr;
+            return &scratchRegs[i].value;
+        }
+
+        else
+        {
+
+        }
+    }
+
+    fprintf(stderr, "sim: no room left for register 0x%08x\n", (unsigned)ui32Addr);
+    abort();
+}
+
+/*******************************************************************************
+ *                      Fake driverlib: interrupt.h                            *
+ *******************************************************************************/
+bool IntMasterEnable(void)
+{
+    bool wasDisabled;
+
+    SimLock();
+    wasDisabled = (primask != 0);
+    primask = 0;
+    SimUnlock();
+
+    return wasDisabled;
+}
+
+bool IntMasterDisable(void)
+{
+    bool wasDisabled = (primask != 0);
+
+    primask = 1;
+
+    return wasDisabled;
+}
+
+void IntRegister(uint32_t ui32Interrupt, void (*pfnHandler)(void))
+{
+    SimLock();
+    irqHandlers[ui32Interrupt] = pfnHandler;
+    SimUnlock();
+}
+
+void IntPrioritySet(uint32_t ui32Interrupt, uint8_t ui8Priority)
+{
+    (void)ui32Interrupt;
+    (void)ui8Priority;
+}
+
+void IntEnable(uint32_t ui32Interrupt)
+{
+    SimLock();
+
+    if (ui32Interrupt == (uint32_t)FAULT_SYSTICK)
+    {
+        sysTick.intEnabled = true;
+    }
+
+    else
+    {
+        irqEnabled[ui32Interrupt] = true;
+    }
+
+    SimUnlock();
+}
+
+void IntDisable(uint32_t ui32Interrupt)
+{
+    SimLock();
+
+    if (ui32Interrupt == (uint32_t)FAULT_SYSTICK)
+    {
+        sysTick.intEnabled = false;
+    }
+
+    else
+    {
+        irqEnabled[ui32Interrupt] = false;
+    }
+
+    SimUnlock();
+}
+
+void IntPendSet(uint32_t ui32Interrupt)
+{
+    SimLock();
+
+    if (ui32Interrupt == (uint32_t)FAULT_SYSTICK)
+    {
+        sysTick.pending = true;
+    }
+
+    else
+    {
+        irqSoftPending[ui32Interrupt] = true;
+    }
+
+    SimUnlock();
+}
+
+/*******************************************************************************
+ *                      Fake driverlib: systick.h                              *
+ *******************************************************************************/
+void SysTickEnable(void)
+{
+    SimLock();
+    sysTick.enabled = true;
+    sysTick.nextWrap = SimCycles() + (uint64_t)sysTick.reload + 1U;
+    SimUnlock();
+}
+
+void SysTickDisable(void)
+{
+    SimLock();
+    sysTick.enabled = false;
+    SimUnlock();
+}
+
+void SysTickIntRegister(void (*pfnHandler)(void))
+{
+    SimLock();
+    irqHandlers[FAULT_SYSTICK] = pfnHandler;
+    SimUnlock();
+}
+
+void SysTickIntEnable(void)
+{
+    SimLock();
+    sysTick.intEnabled = true;
+    SimUnlock();
+}
+
+void SysTickIntDisable(void)
+{
+    SimLock();
+    sysTick.intEnabled = false;
+    SimUnlock();
+}
+
+void SysTickPeriodSet(uint32_t ui32Period)
+{
+    /* Like the hardware, the new period starts at the next wrap */
+    SimLock();
+    sysTick.reload = ui32Period - 1U;
+    SimUnlock();
+}
+
+uint32_t SysTickPeriodGet(void)
+{
+    return sysTick.reload + 1U;
+}
+
+uint32_t SysTickValueGet(void)
+{
+    uint32_t value = 0U;
+
+    SimLock();
+
+    if (sysTick.enabled)
+    {
+        uint64_t cycles = SimCycles();
+
+        SimSysTickUpdate(cycles);
+        value = (uint32_t)(sysTick.nextWrap - cycles - 1U);
+    }
+
+    else
+    {
+
+    }
+
+    SimUnlock();
+
+    return value;
+}
+
+/*******************************************************************************
+ *                      Fake driverlib: timer.h                                *
+ *******************************************************************************/
+/* Only WTIMER0, the timebase, is modelled: one 64-bit periodic timer
+ * counting up to its load value */
+void TimerConfigure(uint32_t ui32Base, uint32_t ui32Config)
+{
+    (void)ui32Base;
+    (void)ui32Config;
+
+    SimLock();
+    wideTimer.enabled = false;
+    wideTimer.value = 0U;
+    SimUnlock();
+}
+
+void TimerLoadSet64(uint32_t ui32Base, uint64_t ui64Value)
+{
+    (void)ui32Base;
+
+    SimLock();
+    wideTimer.load = ui64Value;
+    SimUnlock();
+}
+
+void TimerEnable(uint32_t ui32Base, uint32_t ui32Timer)
+{
+    (void)ui32Base;
+    (void)ui32Timer;
+
+    SimLock();
+
+    if (!wideTimer.enabled)
+    {
+        wideTimer.enabled = true;
+        wideTimer.start = SimCycles() - wideTimer.value;
+    }
+
+    else
+    {
+
+    }
+
+    SimUnlock();
+}
+
+void TimerDisable(uint32_t ui32Base, uint32_t ui32Timer)
+{
+    (void)ui32Base;
+    (void)ui32Timer;
+
+    SimLock();
+
+    if (wideTimer.enabled)
+    {
+        wideTimer.enabled = false;
+        wideTimer.value = SimCycles() - wideTimer.start;
+    }
+
+    else
+    {
+
+    }
+
+    SimUnlock();
+}
+
+uint64_t TimerValueGet64(uint32_t ui32Base)
+{
+    uint64_t value;
+
+    (void)ui32Base;
+
+    SimLock();
+    value = wideTimer.enabled ? (SimCycles() - wideTimer.start) : wideTimer.value;
+
+    if (wideTimer.load != UINT64_MAX)
+    {
+        value %= wideTimer.load + 1U;
+    }
+
+    else
+    {
+
+    }
+
+    SimUnlock();
+
+    return value;
+}
+
+/*******************************************************************************
+ *                      Fake driverlib: sysctl.h                               *
+ *******************************************************************************/
+void SysCtlPeripheralEnable(uint32_t ui32Peripheral)
+{
+    (void)ui32Peripheral;
+}
+
+void SysCtlPeripheralDisable(uint32_t ui32Peripheral)
+{
+    (void)ui32Peripheral;
+}
+
+bool SysCtlPeripheralReady(uint32_t ui32Peripheral)
+{
+    (void)ui32Peripheral;
+
+    return true;
+}
+
+void SysCtlPeripheralSleepEnable(uint32_t ui32Peripheral)
+{
+    (void)ui32Peripheral;
+}
+
+void SysCtlPeripheralDeepSleepEnable(uint32_t ui32Peripheral)
+{
+    (void)ui32Peripheral;
+}
+
+void SysCtlPeripheralClockGating(bool bEnable)
+{
+    (void)bEnable;
+}
+
+void SysCtlClockSet(uint32_t ui32Config)
+{
+    uint32_t divider10;
+    uint32_t hz;
+
+    /* The dividers the firmware may ask for, times 10 */
+    uint32_t sysdiv = ui32Config & SIM_SYSDIV_MASK;
+
+    if (sysdiv == ((uint32_t)SYSCTL_SYSDIV_2_5 & SIM_SYSDIV_MASK))
+    {
+        divider10 = 25U;
+    }
+
+    else if (sysdiv == ((uint32_t)SYSCTL_SYSDIV_4 & SIM_SYSDIV_MASK))
+    {
+        divider10 = 40U;
+    }
+
+    else if (sysdiv == ((uint32_t)SYSCTL_SYSDIV_5 & SIM_SYSDIV_MASK))
+    {
+        divider10 = 50U;
+    }
+
+    else
+    {
+        divider10 = 10U;
+    }
+
+    if ((ui32Config & (uint32_t)SYSCTL_USE_OSC) == (uint32_t)SYSCTL_USE_OSC)
+    {
+        hz = (uint32_t)(((uint64_t)SIM_PIOSC_HZ * 10U) / divider10);
+    }
+
+    else
+    {
+        hz = (uint32_t)(((uint64_t)SIM_PLL_HZ * 10U) / divider10);
+    }
+
+    SimLock();
+    clockBaseCycles = SimCycles();
+    clockBaseNs = SimNowNs();
+    clockHz = hz;
+    SimUnlock();
+}
+
+uint32_t SysCtlClockGet(void)
+{
+    return clockHz;
+}
+
+void SysCtlDelay(uint32_t ui32Count)
+{
+    /* Three cycles per loop, the interrupts keep running meanwhile */
+    uint64_t end = SimNowNs() + (((uint64_t)ui32Count * 3U * 1000000000U) / clockHz);
+
+    while (SimNowNs() < end)
+    {
+
+    }
+}
+
+void SysCtlSleep(void)
+{
+    uint32_t isrs = isrCount;
+    bool awake = false;
+
+    /* WFI: return after an ISR ran, or at once when an interrupt
+     * is pending behind PRIMASK */
+    while (!awake)
+    {
+        SimService();
+
+        if ((isrCount != isrs) || ((primask != 0) && (SimNextIrq() != SIM_IRQ_NONE)))
+        {
+            awake = true;
+        }
+
+        else
+        {
+            SimWaitEvent();
+        }
+    }
+}
+
+void SysCtlDeepSleep(void)
+{
+    SysCtlSleep();
+}
+
+/*******************************************************************************
+ *                      Fake driverlib: flash.h                                *
+ *******************************************************************************/
+/* USER_REG0 holds the board number plus one, the node address of the
+ * network layer, so that every simulated board has its own */
+int32_t FlashUserGet(uint32_t *pui32User0, uint32_t *pui32User1)
+{
+    /* The node address, then the bus peer address */
+    *pui32User0 = ((uint32_t)boardConfig.id + 1U) | ((uint32_t)boardConfig.busPeer << 8);
+    *pui32User1 = 0xFFFFFFFFU;
+
+    return 0;
+}
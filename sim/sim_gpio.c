@@ -0,0 +1,482 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   sim_gpio.c                                                   *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the GPIO model of the host simulation, the   *
+ *                two LaunchPad buttons pressed from the launcher              *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <signal.h>
+#include <string.h>
+#include "sim.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/gpio.h"
+#include "driverlib/interrupt.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define SIM_GPIO_PORT_COUNT 6U
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: Structure holding the interrupt registers of a GPIO port.
+ *              - base  : The port base address.
+ *              - irq   : The port interrupt number.
+ *              - level : The pin levels seen at the last update.
+ *              - is    : The pins sensing levels rather than edges (GPIOIS).
+ *              - ibe   : The pins sensing both edges (GPIOIBE).
+ *              - iev   : The pins sensing rising edges or high levels (GPIOIEV).
+ *              - im    : The pins raising the interrupt (GPIOIM).
+ *              - ris   : The raw interrupt status (GPIORIS).
+ */
+typedef struct
+{
+    uint32_t base;
+    uint32_t irq;
+    uint8_t level;
+    uint8_t is;
+    uint8_t ibe;
+    uint8_t iev;
+    uint8_t im;
+    uint8_t ris;
+} simGpioPort_t;
+
+/*******************************************************************************
+ *                            Global Variables                                 *
+ *******************************************************************************/
+/* Buttons the launcher asked to press or to hold, set from the signal handler */
+static volatile sig_atomic_t pressRequest = 0;
+static volatile sig_atomic_t holdRequest = 0;
+
+/* Time each PF pin was pressed and is released again, PF0 (SW2) and
+ * PF4 (SW1) have pull-ups */
+static uint64_t pressNs[8];
+static uint64_t releaseNs[8];
+
+static simGpioPort_t ports[SIM_GPIO_PORT_COUNT] = {
+    { (uint32_t)GPIO_PORTA_BASE, (uint32_t)INT_GPIOA, 0xFFU, 0U, 0U, 0U, 0U, 0U },
+    { (uint32_t)GPIO_PORTB_BASE, (uint32_t)INT_GPIOB, 0xFFU, 0U, 0U, 0U, 0U, 0U },
+    { (uint32_t)GPIO_PORTC_BASE, (uint32_t)INT_GPIOC, 0xFFU, 0U, 0U, 0U, 0U, 0U },
+    { (uint32_t)GPIO_PORTD_BASE, (uint32_t)INT_GPIOD, 0xFFU, 0U, 0U, 0U, 0U, 0U },
+    { (uint32_t)GPIO_PORTE_BASE, (uint32_t)INT_GPIOE, 0xFFU, 0U, 0U, 0U, 0U, 0U },
+    { (uint32_t)GPIO_PORTF_BASE, (uint32_t)INT_GPIOF, 0xFFU, 0U, 0U, 0U, 0U, 0U }
+};
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static void SimGpioSignal(int sig, siginfo_t *info, void *context);
+static simGpioPort_t* SimGpioFind(uint32_t base);
+static bool SimGpioPressed(uint8_t pin, uint64_t now);
+static uint8_t SimGpioLevel(uint32_t base, uint64_t now);
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+/*
+ * Description :
+ * Handler of the button signals: SIGUSR1 presses SW2 (PF0), the button
+ * the firmware reads, SIGUSR2 presses SW1 (PF4). A signal queued with a
+ * non-zero value holds the button instead.
+ * Parameters: sig     -> The signal number.
+ *             info    -> The signal information, with the queued value.
+ *             context -> Unused.
+ * Returns: None.
+ */
+static void SimGpioSignal(int sig, siginfo_t *info, void *context)
+{
+    int pin = (sig == SIGUSR1) ? (int)GPIO_PIN_0 : (int)GPIO_PIN_4;
+
+    (void)context;
+
+    if ((info->si_code == SI_QUEUE) && (info->si_value.sival_int != 0))
+    {
+        holdRequest |= pin;
+    }
+
+    else
+    {
+        pressRequest |= pin;
+    }
+}
+
+/*
+ * Description :
+ * This function finds the model of a GPIO port.
+ * Parameters: base -> The port base address.
+ * Returns: The port, or NULL for an unknown base address.
+ */
+static simGpioPort_t* SimGpioFind(uint32_t base)
+{
+    simGpioPort_t *port = NULL;
+    uint8_t i;
+
+    for (i = 0U; (i < SIM_GPIO_PORT_COUNT) && (NULL == port); i++)
+    {
+        port = (ports[i].base == base) ? &ports[i] : NULL;
+    }
+
+    return port;
+}
+
+/*
+ * Description :
+ * This function tells whether the button of a PF pin is pressed, its
+ * contacts closing and opening every SIM_BUTTON_BOUNCE_STEP_US for
+ * SIM_BUTTON_BOUNCE_US after the press and after the release.
+ * Parameters: pin -> The PF pin number.
+ *             now -> The host time.
+ * Returns: true if the contacts are closed.
+ */
+static bool SimGpioPressed(uint8_t pin, uint64_t now)
+{
+    uint64_t bounce = (uint64_t)SIM_BUTTON_BOUNCE_US * 1000U;
+    uint64_t step = (uint64_t)SIM_BUTTON_BOUNCE_STEP_US * 1000U;
+    bool pressed = false;
+
+    if ((now < pressNs[pin]) || (now >= (releaseNs[pin] + bounce)))
+    {
+        pressed = false;
+    }
+
+    else if (now < (pressNs[pin] + bounce))
+    {
+        pressed = (((now - pressNs[pin]) / step) % 2U) == 0U;
+    }
+
+    else if (now < releaseNs[pin])
+    {
+        pressed = true;
+    }
+
+    else
+    {
+        pressed = (((now - releaseNs[pin]) / step) % 2U) == 1U;
+    }
+
+    return pressed;
+}
+
+/*
+ * Description :
+ * This function returns the levels of the pins of a port, every input
+ * is pulled up and a pressed button pulls its pin low.
+ * Parameters: base -> The port base address.
+ *             now  -> The host time.
+ * Returns: The pin levels.
+ */
+static uint8_t SimGpioLevel(uint32_t base, uint64_t now)
+{
+    uint8_t level = 0xFFU;
+    uint8_t i;
+
+    if (base == (uint32_t)GPIO_PORTF_BASE)
+    {
+        for (i = 0U; i < 8U; i++)
+        {
+            if (SimGpioPressed(i, now))
+            {
+                level &= (uint8_t)~(1U << i);
+            }
+
+            else
+            {
+
+            }
+        }
+    }
+
+    else
+    {
+
+    }
+
+    return level;
+}
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function releases the buttons and takes the button signals.
+ * Parameters: None.
+ * Returns: None.
+ */
+void SimGpioInit(void)
+{
+    struct sigaction action;
+
+    (void)memset(pressNs, 0, sizeof(pressNs));
+    (void)memset(releaseNs, 0, sizeof(releaseNs));
+
+    (void)memset(&action, 0, sizeof(action));
+    action.sa_sigaction = &SimGpioSignal;
+    action.sa_flags = SA_RESTART | SA_SIGINFO;
+    (void)sigemptyset(&action.sa_mask);
+    (void)sigaction(SIGUSR1, &action, NULL);
+    (void)sigaction(SIGUSR2, &action, NULL);
+}
+
+/*
+ * Description :
+ * This function presses PF buttons, a button still pressed is held longer.
+ * Parameters: pins -> The PF pins of the buttons.
+ *             ms   -> The time they stay pressed.
+ * Returns: None.
+ */
+void SimGpioPress(uint8_t pins, uint32_t ms)
+{
+    uint64_t now = SimNowNs();
+    uint64_t release = now + ((uint64_t)ms * 1000000U);
+    uint8_t i;
+
+    for (i = 0U; i < 8U; i++)
+    {
+        if ((pins & (1U << i)) == 0U)
+        {
+
+        }
+
+        else if (now < releaseNs[i])
+        {
+            releaseNs[i] = release;
+        }
+
+        else
+        {
+            pressNs[i] = now;
+            releaseNs[i] = release;
+        }
+    }
+}
+
+/*
+ * Description :
+ * This function presses and holds the buttons the launcher asked for and latches
+ * the pin changes since the last update in the interrupt status of the
+ * ports, like the GPIO edge and level detectors.
+ * Parameters: nowNs -> The host time.
+ * Returns: None.
+ */
+void SimGpioUpdate(uint64_t nowNs)
+{
+    uint8_t i;
+
+    if ((pressRequest != 0) || (holdRequest != 0))
+    {
+        uint8_t pressed = (uint8_t)pressRequest;
+        uint8_t held = (uint8_t)holdRequest;
+
+        pressRequest = 0;
+        holdRequest = 0;
+        SimGpioPress(pressed, SIM_BUTTON_PRESS_MS);
+        SimGpioPress(held, SIM_BUTTON_HOLD_MS);
+    }
+
+    else
+    {
+
+    }
+
+    for (i = 0U; i < SIM_GPIO_PORT_COUNT; i++)
+    {
+        simGpioPort_t *port = &ports[i];
+        uint8_t level = SimGpioLevel(port->base, nowNs);
+        uint8_t changed = port->level ^ level;
+        uint8_t edges = (changed & port->ibe) |
+                        (changed & (uint8_t)~port->ibe & ((port->iev & level) | ((uint8_t)~port->iev & port->level)));
+        uint8_t levels = (port->iev & level) | ((uint8_t)~port->iev & (uint8_t)~level);
+
+        port->ris |= (edges & (uint8_t)~port->is) | (levels & port->is);
+        port->level = level;
+    }
+}
+
+/*
+ * Description :
+ * This function tells whether a GPIO port raises its interrupt.
+ * Parameters: irq -> The interrupt number.
+ * Returns: true if an unmasked pin latched an edge or sees its level.
+ */
+bool SimGpioIrqAsserted(uint32_t irq)
+{
+    bool asserted = false;
+    uint8_t i;
+
+    for (i = 0U; i < SIM_GPIO_PORT_COUNT; i++)
+    {
+        asserted = asserted || ((ports[i].irq == irq) && ((ports[i].ris & ports[i].im) != 0U));
+    }
+
+    return asserted;
+}
+
+/*
+ * Description :
+ * This function returns the time of the next button contact change.
+ * Parameters: nowNs -> The host time.
+ * Returns: The host time of the change, or SIM_NO_TIME.
+ */
+uint64_t SimGpioNextEventNs(uint64_t nowNs)
+{
+    uint64_t bounce = (uint64_t)SIM_BUTTON_BOUNCE_US * 1000U;
+    uint64_t step = (uint64_t)SIM_BUTTON_BOUNCE_STEP_US * 1000U;
+    uint64_t next = SIM_NO_TIME;
+    uint8_t i;
+
+    for (i = 0U; i < 8U; i++)
+    {
+        uint64_t event = SIM_NO_TIME;
+
+        if ((nowNs >= pressNs[i]) && (nowNs < (pressNs[i] + bounce)))
+        {
+            event = nowNs + step - ((nowNs - pressNs[i]) % step);
+        }
+
+        else if (nowNs < releaseNs[i])
+        {
+            event = releaseNs[i];
+        }
+
+        else if (nowNs < (releaseNs[i] + bounce))
+        {
+            event = nowNs + step - ((nowNs - releaseNs[i]) % step);
+        }
+
+        else
+        {
+
+        }
+
+        next = (event < next) ? event : next;
+    }
+
+    return next;
+}
+
+/*******************************************************************************
+ *                      Fake driverlib: gpio.h                                 *
+ *******************************************************************************/
+void GPIOPinConfigure(uint32_t ui32PinConfig)
+{
+    (void)ui32PinConfig;
+}
+
+void GPIOPinTypeUART(uint32_t ui32Port, uint8_t ui8Pins)
+{
+    (void)ui32Port;
+    (void)ui8Pins;
+}
+
+void GPIOPinTypeGPIOInput(uint32_t ui32Port, uint8_t ui8Pins)
+{
+    (void)ui32Port;
+    (void)ui8Pins;
+}
+
+void GPIOPinTypeGPIOOutput(uint32_t ui32Port, uint8_t ui8Pins)
+{
+    (void)ui32Port;
+    (void)ui8Pins;
+}
+
+void GPIOPadConfigSet(uint32_t ui32Port, uint8_t ui8Pins, uint32_t ui32Strength, uint32_t ui32PadType)
+{
+    (void)ui32Port;
+    (void)ui8Pins;
+    (void)ui32Strength;
+    (void)ui32PadType;
+}
+
+int32_t GPIOPinRead(uint32_t ui32Port, uint8_t ui8Pins)
+{
+    return (int32_t)(SimGpioLevel(ui32Port, SimNowNs()) & ui8Pins);
+}
+
+void GPIOPinWrite(uint32_t ui32Port, uint8_t ui8Pins, uint8_t ui8Val)
+{
+    (void)ui32Port;
+    (void)ui8Pins;
+    (void)ui8Val;
+}
+
+void GPIOUnlockPin(uint32_t ui32Port, uint8_t ui8Pins)
+{
+    (void)ui32Port;
+    (void)ui8Pins;
+}
+
+void GPIOIntTypeSet(uint32_t ui32Port, uint8_t ui8Pins, uint32_t ui32IntType)
+{
+    simGpioPort_t *port = SimGpioFind(ui32Port);
+
+    SimLock();
+    port->ibe = ((ui32IntType & (uint32_t)GPIO_BOTH_EDGES) != 0U) ? (port->ibe | ui8Pins) : (port->ibe & (uint8_t)~ui8Pins);
+    port->is = ((ui32IntType & (uint32_t)GPIO_LOW_LEVEL) != 0U) ? (port->is | ui8Pins) : (port->is & (uint8_t)~ui8Pins);
+    port->iev = ((ui32IntType & (uint32_t)GPIO_RISING_EDGE) != 0U) ? (port->iev | ui8Pins) : (port->iev & (uint8_t)~ui8Pins);
+    SimUnlock();
+}
+
+void GPIOIntEnable(uint32_t ui32Port, uint32_t ui32IntFlags)
+{
+    simGpioPort_t *port = SimGpioFind(ui32Port);
+
+    SimLock();
+    port->im |= (uint8_t)ui32IntFlags;
+    SimUnlock();
+}
+
+void GPIOIntDisable(uint32_t ui32Port, uint32_t ui32IntFlags)
+{
+    simGpioPort_t *port = SimGpioFind(ui32Port);
+
+    SimLock();
+    port->im &= (uint8_t)~ui32IntFlags;
+    SimUnlock();
+}
+
+uint32_t GPIOIntStatus(uint32_t ui32Port, bool bMasked)
+{
+    simGpioPort_t *port = SimGpioFind(ui32Port);
+    uint32_t status;
+
+    SimLock();
+    status = (uint32_t)(bMasked ? (port->ris & port->im) : port->ris);
+    SimUnlock();
+
+    return status;
+}
+
+void GPIOIntClear(uint32_t ui32Port, uint32_t ui32IntFlags)
+{
+    simGpioPort_t *port = SimGpioFind(ui32Port);
+
+    /* A pin sensing a level latches it again at the next update */
+    SimLock();
+    port->ris &= (uint8_t)~ui32IntFlags;
+    SimUnlock();
+}
+
+void GPIOIntRegister(uint32_t ui32Port, void (*pfnIntHandler)(void))
+{
+    simGpioPort_t *port = SimGpioFind(ui32Port);
+
+    IntRegister(port->irq, pfnIntHandler);
+    IntEnable(port->irq);
+}
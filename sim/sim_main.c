@@ -0,0 +1,506 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   sim_main.c                                                   *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: launcher of the host simulation: two boards wired UART1 to   *
+ *                UART1, each UART0 on a PTY standing for the PC terminal      *
+ *                and, with -B, every UART3 on a shared RS-485 bus             *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include "sim.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+/* Boards wired in a chain: A.UART1 to B.UART1, then the UART3 of every
+ * board to the UART1 of the next one */
+#define SIM_BOARD_COUNT 2U
+#define SIM_MAX_BOARDS 4U
+
+/* Room for the bytes of a few ms at the fastest rates on the wire */
+#define SIM_WIRE_BUFFER (1024 * 1024)
+
+/* Bus address given to a board with no peer on the RS-485 bus, no board
+ * has it so its frames are filtered out by every other board */
+#define SIM_NO_BUS_PEER 0xFEU
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static void SimUsage(const char *name);
+static int SimOpenTerminal(char *path, size_t size);
+static bool SimWire(int *ends);
+static void SimBusForward(const int *bus, uint32_t count, uint32_t from);
+static pid_t SimStartBoard(const simBoardConfig_t *config, uint32_t count, uint32_t index, const int *bus, bool busMode);
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+static void SimUsage(const char *name)
+{
+    fprintf(stderr,
+            "usage: %s [-B] [-e ppm] [-m baud] [-n boards]\n"
+            "  -B        RS-485 bus: UART1 wired in pairs A-B and C-D, every UART3 on\n"
+            "            one bus, board B talking to board C on it (UART3_MULTIDROP_MODE)\n"
+            "  -e ppm    corrupt this many bytes per million on the wires\n"
+            "  -m baud   fastest rate the wires carry, faster bytes are garbled\n"
+            "  -n boards boards wired in a chain, 2 to %u\n",
+            name, (unsigned)SIM_MAX_BOARDS);
+}
+
+/*
+ * Description :
+ * This function opens a PTY in raw mode for the terminal of a board.
+ * Parameters: path -> Where the name of the terminal side is stored.
+ *             size -> The size of path.
+ * Returns: The board side of the PTY, or -1 on error.
+ */
+static int SimOpenTerminal(char *path, size_t size)
+{
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    struct termios raw;
+    int slave;
+
+    if ((master < 0) || (grantpt(master) != 0) || (unlockpt(master) != 0))
+    {
+        return -1;
+    }
+
+    else
+    {
+
+    }
+
+    (void)snprintf(path, size, "%s", ptsname(master));
+
+    /* No echo or line editing, the firmware does both. The terminal side
+     * stays open so that the board side does not fail with no one attached. */
+    slave = open(path, O_RDWR | O_NOCTTY);
+
+    if ((slave < 0) || (tcgetattr(slave, &raw) != 0))
+    {
+        return -1;
+    }
+
+    else
+    {
+
+    }
+
+    cfmakeraw(&raw);
+    (void)tcsetattr(slave, TCSANOW, &raw);
+    (void)fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+
+    return master;
+}
+
+/*
+ * Description :
+ * This function opens a virtual wire, keeping the byte boundaries of the
+ * packets, with room for SIM_WIRE_BUFFER bytes each way.
+ * Parameters: ends -> Where the two ends are stored.
+ * Returns: true on success.
+ */
+static bool SimWire(int *ends)
+{
+    int buffer = SIM_WIRE_BUFFER;
+    bool opened = (socketpair(AF_UNIX, SOCK_SEQPACKET, 0, ends) == 0);
+    uint32_t i;
+
+    for (i = 0U; (i < 2U) && opened; i++)
+    {
+        (void)setsockopt(ends[i], SOL_SOCKET, SO_SNDBUF, &buffer, sizeof(buffer));
+        (void)setsockopt(ends[i], SOL_SOCKET, SO_RCVBUF, &buffer, sizeof(buffer));
+    }
+
+    return opened;
+}
+
+/*
+ * Description :
+ * This function carries what a board put on the RS-485 bus to every other
+ * board, whose UART3 keeps or drops it by its address. The bytes keep their
+ * arrival times; boards driving the bus at the same time are not detected.
+ * Parameters: bus   -> The launcher ends of the bus wires, one per board.
+ *             count -> The number of boards.
+ *             from  -> The board whose bus wire is readable.
+ * Returns: None.
+ */
+static void SimBusForward(const int *bus, uint32_t count, uint32_t from)
+{
+    simWireByte_t packet[SIM_WIRE_BATCH];
+    ssize_t length = recv(bus[from], packet, sizeof(packet), 0);
+    uint32_t i;
+
+    for (i = 0U; (i < count) && (length > 0); i++)
+    {
+        if (i != from)
+        {
+            (void)send(bus[i], packet, (size_t)length, 0);
+        }
+
+        else
+        {
+
+        }
+    }
+}
+
+/*
+ * Description :
+ * This function starts the process of a board, as after a power on
+ * reset: its firmware starts from main() on the wires and the terminal
+ * the launcher keeps open, the bytes already on them included.
+ * Parameters: config  -> The configuration of every board.
+ *             count   -> The number of boards.
+ *             index   -> The board to be started.
+ *             bus     -> The launcher ends of the bus wires, one per board.
+ *             busMode -> The boards share an RS-485 bus.
+ * Returns: The process of the board, or -1 on error.
+ */
+static pid_t SimStartBoard(const simBoardConfig_t *config, uint32_t count, uint32_t index, const int *bus, bool busMode)
+{
+    pid_t pid = fork();
+    uint32_t j;
+
+    if (pid == 0)
+    {
+        /* Only the ends of this board stay open */
+        for (j = 0U; j < count; j++)
+        {
+            if (j != index)
+            {
+                (void)close(config[j].wireFd);
+                (void)close(config[j].consoleFd);
+
+                if (config[j].spareWireFd >= 0)
+                {
+                    (void)close(config[j].spareWireFd);
+                }
+
+                else
+                {
+
+                }
+            }
+
+            else
+            {
+
+            }
+
+            if (busMode)
+            {
+                (void)close(bus[j]);
+            }
+
+            else
+            {
+
+            }
+        }
+
+        SimBoardRun(&config[index]);
+    }
+
+    else
+    {
+
+    }
+
+    return pid;
+}
+
+/*******************************************************************************
+ *                              Main Function                                  *
+ *******************************************************************************/
+int main(int argc, char *argv[])
+{
+    simBoardConfig_t config[SIM_MAX_BOARDS];
+    char terminal[SIM_MAX_BOARDS][64];
+    pid_t pid[SIM_MAX_BOARDS];
+    uint32_t boardCount = SIM_BOARD_COUNT;
+    uint32_t errorPpm = 0U;
+    uint32_t maxBaud = 0U;
+    int wire[SIM_MAX_BOARDS - 1U][2];
+    int busWire[SIM_MAX_BOARDS][2];
+    int bus[SIM_MAX_BOARDS];
+    struct pollfd fds[SIM_MAX_BOARDS + 1U];
+    bool busMode = false;
+    int option;
+    uint32_t i;
+    bool running = true;
+
+    while ((option = getopt(argc, argv, "Be:m:n:h")) != -1)
+    {
+        switch (option)
+        {
+        case 'B':
+            busMode = true;
+            break;
+        case 'e':
+            errorPpm = (uint32_t)strtoul(optarg, NULL, 10);
+            break;
+        case 'm':
+            maxBaud = (uint32_t)strtoul(optarg, NULL, 10);
+            break;
+        case 'n':
+            boardCount = (uint32_t)strtoul(optarg, NULL, 10);
+            break;
+        default:
+            SimUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    if ((boardCount < 2U) || (boardCount > SIM_MAX_BOARDS))
+    {
+        SimUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    else
+    {
+
+    }
+
+    /* A chain has a wire between every two boards, on a bus only the
+     * pairs A-B and C-D are wired and every board has a bus wire */
+    for (i = 0U; i < (boardCount - 1U); i++)
+    {
+        if (((!busMode) || ((i % 2U) == 0U)) && !SimWire(wire[i]))
+        {
+            perror("socketpair");
+            return EXIT_FAILURE;
+        }
+
+        else
+        {
+
+        }
+    }
+
+    for (i = 0U; (i < boardCount) && busMode; i++)
+    {
+        if (!SimWire(busWire[i]))
+        {
+            perror("socketpair");
+            return EXIT_FAILURE;
+        }
+
+        else
+        {
+            bus[i] = busWire[i][0];
+        }
+    }
+
+    for (i = 0U; i < boardCount; i++)
+    {
+        config[i].id = (uint8_t)i;
+
+        if (busMode)
+        {
+            /* Board B (address 2) and board C (address 3) talk on the bus */
+            if ((i % 2U) != 0U)
+            {
+                config[i].wireFd = wire[i - 1U][1];
+            }
+
+            else
+            {
+                config[i].wireFd = ((i + 1U) < boardCount) ? wire[i][0] : -1;
+            }
+
+            config[i].spareWireFd = busWire[i][1];
+            config[i].busPeer = (i == 1U) ? 3U : ((i == 2U) ? 2U : SIM_NO_BUS_PEER);
+        }
+
+        else
+        {
+            config[i].wireFd = (i == 0U) ? wire[0][0] : wire[i - 1U][1];
+            config[i].spareWireFd = ((i == 0U) || (i == (boardCount - 1U))) ? -1 : wire[i][0];
+            config[i].busPeer = 0U;
+        }
+
+        config[i].errorPpm = errorPpm;
+        config[i].maxBaud = maxBaud;
+        config[i].consoleFd = SimOpenTerminal(terminal[i], sizeof(terminal[i]));
+
+        if (config[i].consoleFd < 0)
+        {
+            perror("pty");
+            return EXIT_FAILURE;
+        }
+
+        else
+        {
+
+        }
+    }
+
+    (void)fflush(stdout);
+
+    for (i = 0U; i < boardCount; i++)
+    {
+        pid[i] = SimStartBoard(config, boardCount, i, bus, busMode);
+
+        if (pid[i] < 0)
+        {
+            perror("fork");
+            return EXIT_FAILURE;
+        }
+
+        else
+        {
+
+        }
+    }
+
+    for (i = 0U; i < boardCount; i++)
+    {
+        printf("board %c: pid %d, PC terminal %s\n", (char)('A' + i), (int)pid[i], terminal[i]);
+    }
+
+    printf("commands: a / b / ... press the button of board A / B / ..., A / B / ... hold it, "
+           "1 / 2 / ... reset it, q quits\n");
+    (void)fflush(stdout);
+
+    /* The commands, then the bus wires carried by the launcher */
+    fds[0].fd = STDIN_FILENO;
+    fds[0].events = POLLIN;
+
+    for (i = 0U; i < boardCount; i++)
+    {
+        fds[i + 1U].fd = busMode ? bus[i] : -1;
+        fds[i + 1U].events = POLLIN;
+    }
+
+    while (running)
+    {
+        unsigned char command = 0U;
+
+        if (poll(fds, boardCount + 1U, -1) <= 0)
+        {
+            /* Interrupted, poll again */
+        }
+
+        else
+        {
+            for (i = 0U; i < boardCount; i++)
+            {
+                if ((fds[i + 1U].revents & POLLIN) != 0)
+                {
+                    SimBusForward(bus, boardCount, i);
+                }
+
+                else
+                {
+
+                }
+            }
+
+            if ((fds[0].revents & (POLLIN | POLLHUP)) == 0)
+            {
+
+            }
+
+            else if (read(STDIN_FILENO, &command, 1U) != 1)
+            {
+                /* No commands any more, run until killed */
+                fds[0].fd = -1;
+            }
+
+            else
+            {
+
+            }
+        }
+
+        switch (command)
+        {
+        case 'a':
+        case 'b':
+        case 'c':
+        case 'd':
+            if ((uint32_t)(command - 'a') < boardCount)
+            {
+                (void)kill(pid[command - 'a'], SIGUSR1);
+            }
+
+            else
+            {
+
+            }
+            break;
+        case 'A':
+        case 'B':
+        case 'C':
+        case 'D':
+            if ((uint32_t)(command - 'A') < boardCount)
+            {
+                union sigval hold;
+
+                hold.sival_int = 1;
+                (void)sigqueue(pid[command - 'A'], SIGUSR1, hold);
+            }
+
+            else
+            {
+
+            }
+            break;
+        case '1':
+        case '2':
+        case '3':
+        case '4':
+            if ((uint32_t)(command - '1') < boardCount)
+            {
+                /* Power the board off and on, its wires keep their bytes */
+                i = (uint32_t)(command - '1');
+                (void)kill(pid[i], SIGKILL);
+                (void)waitpid(pid[i], NULL, 0);
+                pid[i] = SimStartBoard(config, boardCount, i, bus, busMode);
+            }
+
+            else
+            {
+
+            }
+            break;
+        case 'q':
+            running = false;
+            break;
+        default:
+            break;
+        }
+    }
+
+    for (i = 0U; i < boardCount; i++)
+    {
+        (void)kill(pid[i], SIGTERM);
+        (void)waitpid(pid[i], NULL, 0);
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,1381 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   sim_uart.c                                                   *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the UART model of the host simulation, with  *
+ *                byte-time accurate FIFOs and the virtual wires               *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include "sim.h"
+#include "inc/hw_ints.h"
+#include "inc/hw_memmap.h"
+#include "inc/hw_uart.h"
+#include "driverlib/interrupt.h"
+#include "driverlib/uart.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define SIM_UART_COUNT      3U
+#define SIM_UART_FIFO_DEPTH 16U
+
+/* Bytes in the TX FIFO and the shift register, must be a power of two */
+#define SIM_UART_TX_QUEUE   32U
+
+/* Bytes on their way to the RX pin, must be a power of two */
+#define SIM_UART_INBOUND    4096U
+
+/* The receive timeout fires after 32 idle bit times */
+#define SIM_UART_RT_BITS    32U
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: A byte written to the transmitter, its start and end times
+ *              on the line are set once the transmitter runs.
+ */
+typedef struct
+{
+    uint8_t data;
+    bool address;
+    bool scheduled;
+    uint64_t writeNs;
+    uint64_t startNs;
+    uint64_t endNs;
+} simTxByte_t;
+
+/*
+ * Description: Structure holding the model of one UART module.
+ *              - The registers the driverlib functions read and write.
+ *              - The RX FIFO holding data words, the error bits above bit 8.
+ *              - The TX queue: the bytes of the FIFO then the one being shifted.
+ *              - The bytes of the wire or the terminal not yet arrived.
+ *              - The 9-bit mode address match, and whether the bytes on the
+ *                line follow a matching address byte.
+ */
+typedef struct
+{
+    uint32_t base;
+    uint32_t irq;
+    int fd;
+    bool console;
+
+    uint32_t ctl;
+    uint32_t lcrh;
+    uint32_t ibrd;
+    uint32_t fbrd;
+    uint32_t ifls;
+    uint32_t im;
+    uint32_t ris;
+    uint32_t rsr;
+    uint32_t dmactl;
+    uint32_t computed;
+    uint32_t scratch[8];
+
+    uint16_t rxFifo[SIM_UART_FIFO_DEPTH];
+    uint8_t rxHead;
+    uint8_t rxCount;
+    uint64_t rxLastNs;
+    bool rtArmed;
+
+    simTxByte_t tx[SIM_UART_TX_QUEUE];
+    uint8_t txHead;
+    uint8_t txCount;
+    uint8_t txWaitingPrev;
+    bool txBusyPrev;
+    uint64_t txLastEnd;
+    uint64_t txEdgeNs;
+
+    simWireByte_t inbound[SIM_UART_INBOUND];
+    uint16_t inHead;
+    uint16_t inCount;
+    uint64_t consoleLastNs;
+
+    simWireByte_t outbound[SIM_WIRE_BATCH];
+    uint8_t outCount;
+    uint32_t outLost;
+
+    uint32_t bitAddr;
+    uint32_t bitAmask;
+    bool selected;
+
+    bool dmaDone;
+} simUart_t;
+
+/*******************************************************************************
+ *                            Global Variables                                 *
+ *******************************************************************************/
+static simUart_t uarts[SIM_UART_COUNT];
+
+/* RX and TX FIFO trigger levels selected by UARTFIFOLevelSet() */
+static const uint8_t fifoLevels[5] = {2U, 4U, 8U, 12U, 14U};
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static simUart_t* SimUartFind(uint32_t base);
+static uint32_t SimUartBaud(const simUart_t *uart);
+static uint64_t SimUartCharNs(const simUart_t *uart);
+static uint8_t SimUartDepth(const simUart_t *uart);
+static uint8_t SimUartRxLevel(const simUart_t *uart);
+static uint8_t SimUartTxLevel(const simUart_t *uart);
+static bool SimUartTxRunning(const simUart_t *uart);
+static uint8_t SimUartTxWaiting(const simUart_t *uart, uint64_t nowNs);
+static bool SimUartTxBusy(simUart_t *uart, uint64_t nowNs);
+static void SimUartTxRetire(simUart_t *uart, uint64_t nowNs);
+static void SimUartTxEmit(simUart_t *uart, const simTxByte_t *byte);
+static void SimUartTxSchedule(simUart_t *uart);
+static void SimUartTxEdge(simUart_t *uart, uint64_t nowNs);
+static bool SimUartTxPut(simUart_t *uart, uint8_t data, bool address, uint64_t writeNs);
+static bool SimUartRxPop(simUart_t *uart, uint16_t *word);
+static void SimUartRxPush(simUart_t *uart, const simWireByte_t *wireByte);
+static void SimUartReadInbound(simUart_t *uart, uint64_t nowNs);
+static bool SimUartAsserted(const simUart_t *uart);
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function maps a UART base address to its model.
+ * Parameters: base -> The UART base address.
+ * Returns: A pointer to the model, or NULL for a UART without one.
+ */
+static simUart_t* SimUartFind(uint32_t base)
+{
+    simUart_t *uart = NULL;
+    uint32_t i;
+
+    for (i = 0U; i < SIM_UART_COUNT; i++)
+    {
+        if (uarts[i].base == base)
+        {
+            uart = &uarts[i];
+        }
+
+        else
+        {
+
+        }
+    }
+
+    return uart;
+}
+
+/*
+ * Description :
+ * This function computes the rate the divisors give with the system clock.
+ * Parameters: uart -> The UART model.
+ * Returns: The baud rate, 0 when the UART was never configured.
+ */
+static uint32_t SimUartBaud(const simUart_t *uart)
+{
+    uint32_t divisor = (uart->ibrd * 64U) + uart->fbrd;
+    uint64_t clock = ((uart->ctl & (uint32_t)UART_CTL_HSE) != 0U) ? ((uint64_t)SimClockHz() * 8U)
+                                                                 : ((uint64_t)SimClockHz() * 4U);
+
+    return (divisor != 0U) ? (uint32_t)((clock + (divisor / 2U)) / divisor) : 0U;
+}
+
+/*
+ * Description :
+ * This function returns the time a character takes on the line, start
+ * bit, data bits, parity bit and stop bits.
+ * Parameters: uart -> The UART model.
+ * Returns: The character time in ns.
+ */
+static uint64_t SimUartCharNs(const simUart_t *uart)
+{
+    uint32_t baud = SimUartBaud(uart);
+    uint32_t bits = 1U + 5U + ((uart->lcrh & (uint32_t)UART_LCRH_WLEN_M) >> UART_LCRH_WLEN_S);
+
+    bits += ((uart->lcrh & (uint32_t)UART_LCRH_PEN) != 0U) ? 1U : 0U;
+    bits += ((uart->lcrh & (uint32_t)UART_LCRH_STP2) != 0U) ? 2U : 1U;
+
+    return (baud != 0U) ? (((uint64_t)bits * 1000000000U) / baud) : 1000000U;
+}
+
+static uint8_t SimUartDepth(const simUart_t *uart)
+{
+    return ((uart->lcrh & (uint32_t)UART_LCRH_FEN) != 0U) ? (uint8_t)SIM_UART_FIFO_DEPTH : 1U;
+}
+
+static uint8_t SimUartRxLevel(const simUart_t *uart)
+{
+    uint32_t select = (uart->ifls & (uint32_t)UART_IFLS_RX_M) >> UART_IFLS_RX_S;
+
+    return ((uart->lcrh & (uint32_t)UART_LCRH_FEN) != 0U) ? fifoLevels[(select < 5U) ? select : 4U] : 1U;
+}
+
+static uint8_t SimUartTxLevel(const simUart_t *uart)
+{
+    uint32_t select = uart->ifls & (uint32_t)UART_IFLS_TX_M;
+
+    return ((uart->lcrh & (uint32_t)UART_LCRH_FEN) != 0U) ? fifoLevels[(select < 5U) ? select : 4U] : 0U;
+}
+
+static bool SimUartTxRunning(const simUart_t *uart)
+{
+    uint32_t on = (uint32_t)UART_CTL_UARTEN | (uint32_t)UART_CTL_TXE;
+
+    return ((uart->ctl & on) == on) && (SimUartBaud(uart) != 0U);
+}
+
+/*
+ * Description :
+ * This function counts the bytes still in the TX FIFO, the byte being
+ * shifted out is not counted.
+ * Parameters: uart  -> The UART model.
+ *             nowNs -> The current time.
+ * Returns: The number of bytes in the TX FIFO.
+ */
+static uint8_t SimUartTxWaiting(const simUart_t *uart, uint64_t nowNs)
+{
+    uint8_t waiting = 0U;
+    uint8_t i;
+
+    for (i = 0U; i < uart->txCount; i++)
+    {
+        const simTxByte_t *byte = &uart->tx[(uart->txHead + i) & (SIM_UART_TX_QUEUE - 1U)];
+
+        if (!byte->scheduled || (byte->startNs > nowNs))
+        {
+            waiting++;
+        }
+
+        else
+        {
+
+        }
+    }
+
+    return waiting;
+}
+
+static bool SimUartTxBusy(simUart_t *uart, uint64_t nowNs)
+{
+    SimUartTxRetire(uart, nowNs);
+
+    return (uart->txCount != 0U) && (uart->tx[uart->txHead].scheduled || SimUartTxRunning(uart));
+}
+
+/*
+ * Description :
+ * This function drops the bytes whose stop bit is out.
+ * Parameters: uart  -> The UART model.
+ *             nowNs -> The current time.
+ * Returns: None.
+ */
+static void SimUartTxRetire(simUart_t *uart, uint64_t nowNs)
+{
+    while ((uart->txCount != 0U) && uart->tx[uart->txHead].scheduled && (uart->tx[uart->txHead].endNs <= nowNs))
+    {
+        uart->txHead = (uint8_t)((uart->txHead + 1U) & (SIM_UART_TX_QUEUE - 1U));
+        uart->txCount--;
+    }
+}
+
+/*
+ * Description :
+ * This function puts a byte on the line: raw to the terminal of UART0,
+ * stamped with its arrival time on the wire of UART1 or UART3, where the
+ * configured impairments are applied.
+ * Parameters: uart -> The UART model.
+ *             byte -> The byte, its stop bit ending at endNs.
+ * Returns: None.
+ */
+static void SimUartTxEmit(simUart_t *uart, const simTxByte_t *byte)
+{
+    uint8_t data = byte->data;
+
+    if (uart->fd < 0)
+    {
+
+    }
+
+    else if (uart->console)
+    {
+        /* Output is dropped while no terminal reads it */
+        (void)write(uart->fd, &data, 1U);
+    }
+
+    else
+    {
+        const simBoardConfig_t *config = SimBoardGetConfig();
+        simWireByte_t *wireByte = &uart->outbound[uart->outCount];
+
+        wireByte->arrivalNs = byte->endNs;
+        wireByte->baud = SimUartBaud(uart);
+        wireByte->data = data;
+        wireByte->error = 0U;
+        wireByte->address = byte->address;
+
+        if ((config->maxBaud != 0U) && (wireByte->baud > config->maxBaud))
+        {
+            /* Too fast for the wire: every character is garbled */
+            wireByte->data = (uint8_t)SimRandom();
+            wireByte->error = (uint8_t)UART_RXERROR_FRAMING;
+        }
+
+        else if ((config->errorPpm != 0U) && ((SimRandom() % 1000000U) < config->errorPpm))
+        {
+            /* Either a bit flipped, or the stop bit was lost */
+            if ((SimRandom() & 1U) != 0U)
+            {
+                wireByte->data ^= (uint8_t)(1U << (SimRandom() & 7U));
+            }
+
+            else
+            {
+                wireByte->error = (uint8_t)UART_RXERROR_FRAMING;
+            }
+        }
+
+        else
+        {
+
+        }
+
+        uart->outCount++;
+
+        if (uart->outCount == SIM_WIRE_BATCH)
+        {
+            SimUartFlushWire();
+        }
+
+        else
+        {
+
+        }
+    }
+}
+
+/*
+ * Description :
+ * This function gives the written bytes their time on the line, back
+ * to back while the transmitter has data.
+ * Parameters: uart -> The UART model.
+ * Returns: None.
+ */
+static void SimUartTxSchedule(simUart_t *uart)
+{
+    uint8_t i;
+
+    for (i = 0U; (i < uart->txCount) && SimUartTxRunning(uart); i++)
+    {
+        simTxByte_t *byte = &uart->tx[(uart->txHead + i) & (SIM_UART_TX_QUEUE - 1U)];
+
+        if (!byte->scheduled)
+        {
+            byte->startNs = (byte->writeNs > uart->txLastEnd) ? byte->writeNs : uart->txLastEnd;
+            byte->endNs = byte->startNs + SimUartCharNs(uart);
+            byte->scheduled = true;
+            uart->txLastEnd = byte->endNs;
+            SimUartTxEmit(uart, byte);
+        }
+
+        else
+        {
+
+        }
+    }
+}
+
+/*
+ * Description :
+ * This function raises the TX interrupt when the TX FIFO drained through
+ * its trigger level, or in end of transmission mode when the last stop
+ * bit is out, and records when that happened.
+ * Parameters: uart  -> The UART model.
+ *             nowNs -> The current time.
+ * Returns: None.
+ */
+static void SimUartTxEdge(simUart_t *uart, uint64_t nowNs)
+{
+    uint8_t level = SimUartTxLevel(uart);
+    uint8_t waiting = SimUartTxWaiting(uart, nowNs);
+
+    if ((uart->ctl & (uint32_t)UART_CTL_EOT) != 0U)
+    {
+        if (!SimUartTxBusy(uart, nowNs) && uart->txBusyPrev)
+        {
+            uart->ris |= (uint32_t)UART_INT_TX;
+            uart->txEdgeNs = uart->txLastEnd;
+        }
+
+        else
+        {
+
+        }
+    }
+
+    else if ((waiting <= level) && (uart->txWaitingPrev > level))
+    {
+        /* The FIFO went down to the level when the byte level places
+         * before its end started shifting out */
+        uint8_t index = (uint8_t)(uart->txCount - 1U - level);
+        const simTxByte_t *byte = &uart->tx[(uart->txHead + index) & (SIM_UART_TX_QUEUE - 1U)];
+
+        uart->ris |= (uint32_t)UART_INT_TX;
+        uart->txEdgeNs = (uart->txCount > level) && byte->scheduled ? byte->startNs : nowNs;
+    }
+
+    else
+    {
+
+    }
+
+    uart->txWaitingPrev = waiting;
+    uart->txBusyPrev = SimUartTxBusy(uart, nowNs);
+}
+
+/*
+ * Description :
+ * This function writes a byte to the transmitter if the TX FIFO has room.
+ * Parameters: uart    -> The UART model.
+ *             data    -> The byte.
+ *             address -> The byte goes out with its 9th bit set.
+ *             writeNs -> The time the byte was written.
+ * Returns: true if the byte was accepted.
+ */
+static bool SimUartTxPut(simUart_t *uart, uint8_t data, bool address, uint64_t writeNs)
+{
+    uint64_t now = SimNowNs();
+    bool accepted = false;
+
+    SimUartTxRetire(uart, now);
+
+    if ((SimUartTxWaiting(uart, now) < SimUartDepth(uart)) && (uart->txCount < SIM_UART_TX_QUEUE))
+    {
+        simTxByte_t *byte = &uart->tx[(uart->txHead + uart->txCount) & (SIM_UART_TX_QUEUE - 1U)];
+
+        byte->data = data;
+        byte->address = address;
+        byte->scheduled = false;
+        byte->writeNs = writeNs;
+        uart->txCount++;
+        SimUartTxSchedule(uart);
+        uart->txWaitingPrev = SimUartTxWaiting(uart, now);
+        uart->txBusyPrev = true;
+        accepted = true;
+    }
+
+    else
+    {
+
+    }
+
+    return accepted;
+}
+
+/*
+ * Description :
+ * This function reads a data word from the RX FIFO, clearing the RX and
+ * receive timeout interrupts the way reading the data register does.
+ * Parameters: uart -> The UART model.
+ *             word -> Where the data word is stored.
+ * Returns: true if the FIFO had a data word.
+ */
+static bool SimUartRxPop(simUart_t *uart, uint16_t *word)
+{
+    bool popped = false;
+
+    if (uart->rxCount != 0U)
+    {
+        *word = uart->rxFifo[uart->rxHead];
+        uart->rxHead = (uint8_t)((uart->rxHead + 1U) % SIM_UART_FIFO_DEPTH);
+        uart->rxCount--;
+        popped = true;
+
+        if (uart->rxCount < SimUartRxLevel(uart))
+        {
+            uart->ris &= ~(uint32_t)UART_INT_RX;
+        }
+
+        else
+        {
+
+        }
+
+        if (uart->rxCount == 0U)
+        {
+            uart->ris &= ~(uint32_t)UART_INT_RT;
+        }
+
+        else
+        {
+
+        }
+    }
+
+    else
+    {
+
+    }
+
+    return popped;
+}
+
+/*
+ * Description :
+ * This function receives a byte arriving on the RX pin: it is checked
+ * against the receiver rate, stored in the RX FIFO or lost as an overrun.
+ * In 9-bit mode an address byte selects the receiver or not, and the
+ * data bytes only enter the RX FIFO of a selected receiver.
+ * Parameters: uart     -> The UART model.
+ *             wireByte -> The arriving byte.
+ * Returns: None.
+ */
+static void SimUartRxPush(simUart_t *uart, const simWireByte_t *wireByte)
+{
+    uint32_t on = (uint32_t)UART_CTL_UARTEN | (uint32_t)UART_CTL_RXE;
+    uint32_t baud = SimUartBaud(uart);
+    uint8_t data = wireByte->data;
+    uint8_t error = wireByte->error;
+
+    if (((uart->ctl & on) != on) || (baud == 0U))
+    {
+        /* Nobody listens */
+    }
+
+    else if (((uart->bitAddr & (uint32_t)UART_9BITADDR_9BITEN) != 0U) &&
+             (wireByte->address ? ((data & uart->bitAmask) != (uart->bitAddr & uart->bitAmask)) : !uart->selected))
+    {
+        /* Filtered out by the address match, the CPU never sees it */
+        uart->selected = false;
+    }
+
+    else
+    {
+        uint32_t difference = (wireByte->baud > baud) ? (wireByte->baud - baud) : (baud - wireByte->baud);
+
+        if (((uint64_t)difference * 10000U) > ((uint64_t)baud * SIM_BAUD_TOLERANCE_X100))
+        {
+            /* Sampled at the wrong rate */
+            data = (uint8_t)(data ^ 0xA5U);
+            error |= (uint8_t)UART_RXERROR_FRAMING;
+        }
+
+        else
+        {
+
+        }
+
+        uart->rsr |= (uint32_t)error;
+        uart->ris |= ((error & (uint8_t)UART_RXERROR_FRAMING) != 0U) ? (uint32_t)UART_INT_FE : 0U;
+
+        if (wireByte->address && ((uart->bitAddr & (uint32_t)UART_9BITADDR_9BITEN) != 0U))
+        {
+            /* A matching address byte enters the RX FIFO too */
+            uart->selected = true;
+            uart->ris |= (uint32_t)UART_INT_9BIT;
+        }
+
+        else
+        {
+
+        }
+
+        if (uart->rxCount < SimUartDepth(uart))
+        {
+            uart->rxFifo[(uart->rxHead + uart->rxCount) % SIM_UART_FIFO_DEPTH] = (uint16_t)((uint16_t)data | ((uint16_t)error << 8));
+            uart->rxCount++;
+
+            if (uart->rxCount >= SimUartRxLevel(uart))
+            {
+                uart->ris |= (uint32_t)UART_INT_RX;
+            }
+
+            else
+            {
+
+            }
+        }
+
+        else
+        {
+            uart->rsr |= (uint32_t)UART_RXERROR_OVERRUN;
+            uart->ris |= (uint32_t)UART_INT_OE;
+        }
+
+        uart->rxLastNs = wireByte->arrivalNs;
+        uart->rtArmed = true;
+        SimUdmaService(uart->base);
+    }
+}
+
+/*
+ * Description :
+ * This function takes what the wire or the terminal carried since the
+ * last call. Typed characters are spaced by one character time.
+ * Parameters: uart  -> The UART model.
+ *             nowNs -> The current time.
+ * Returns: None.
+ */
+static void SimUartReadInbound(simUart_t *uart, uint64_t nowNs)
+{
+    bool more = (uart->fd >= 0);
+
+    while (more && ((SIM_UART_INBOUND - uart->inCount) >= SIM_WIRE_BATCH))
+    {
+        if (uart->console)
+        {
+            uint8_t buffer[SIM_WIRE_BATCH];
+            ssize_t length = read(uart->fd, buffer, sizeof(buffer));
+            ssize_t i;
+
+            for (i = 0; i < length; i++)
+            {
+                simWireByte_t *wireByte = &uart->inbound[(uart->inHead + uart->inCount) & (SIM_UART_INBOUND - 1U)];
+                uint64_t earliest = uart->consoleLastNs + SimUartCharNs(uart);
+
+                uart->consoleLastNs = (earliest > nowNs) ? earliest : nowNs;
+                wireByte->arrivalNs = uart->consoleLastNs;
+                wireByte->baud = SimUartBaud(uart);
+                wireByte->data = buffer[i];
+                wireByte->error = 0U;
+                uart->inCount++;
+            }
+
+            more = (length > 0);
+        }
+
+        else
+        {
+            simWireByte_t buffer[SIM_WIRE_BATCH];
+            ssize_t length = recv(uart->fd, buffer, sizeof(buffer), MSG_DONTWAIT);
+            ssize_t count = (length > 0) ? (length / (ssize_t)sizeof(simWireByte_t)) : 0;
+            ssize_t i;
+
+            for (i = 0; i < count; i++)
+            {
+                uart->inbound[(uart->inHead + uart->inCount) & (SIM_UART_INBOUND - 1U)] = buffer[i];
+                uart->inCount++;
+            }
+
+            more = (count > 0);
+        }
+    }
+}
+
+/*
+ * Description :
+ * This function tells whether the UART drives its interrupt line.
+ * Parameters: uart -> The UART model.
+ * Returns: true if an enabled interrupt source is raised.
+ */
+static bool SimUartAsserted(const simUart_t *uart)
+{
+    return ((uart->ris & uart->im) != 0U) || uart->dmaDone;
+}
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function resets the UART models and attaches UART0 to the
+ * terminal, UART1 and UART3 to the wires.
+ * Parameters: config -> The board wiring.
+ * Returns: None.
+ */
+void SimUartInit(const simBoardConfig_t *config)
+{
+    (void)memset(uarts, 0, sizeof(uarts));
+
+    uarts[0].base = (uint32_t)UART0_BASE;
+    uarts[0].irq = (uint32_t)INT_UART0;
+    uarts[0].fd = config->consoleFd;
+    uarts[0].console = true;
+
+    uarts[1].base = (uint32_t)UART1_BASE;
+    uarts[1].irq = (uint32_t)INT_UART1;
+    uarts[1].fd = config->wireFd;
+    uarts[1].console = false;
+
+    uarts[2].base = (uint32_t)UART3_BASE;
+    uarts[2].irq = (uint32_t)INT_UART3;
+    uarts[2].fd = config->spareWireFd;
+    uarts[2].console = false;
+}
+
+/*
+ * Description :
+ * This function brings the UARTs up to the current time: finished
+ * characters leave the transmitters, arrived characters enter the
+ * receivers and the interrupt sources are raised.
+ * Parameters: nowNs     -> The current time.
+ *             stopOnIrq -> Stop delivering characters to a UART once its
+ *                          interrupt is raised, the rest is delivered after
+ *                          the ISR ran, as it would have on time on the board.
+ * Returns: None.
+ */
+void SimUartUpdate(uint64_t nowNs, bool stopOnIrq)
+{
+    uint32_t i;
+
+    for (i = 0U; i < SIM_UART_COUNT; i++)
+    {
+        simUart_t *uart = &uarts[i];
+        bool stop = false;
+
+        SimUartTxSchedule(uart);
+        SimUartTxEdge(uart, nowNs);
+        SimUartTxRetire(uart, nowNs);
+        SimUartReadInbound(uart, nowNs);
+
+        while ((uart->inCount != 0U) && (uart->inbound[uart->inHead].arrivalNs <= nowNs) && !stop)
+        {
+            if (stopOnIrq && SimIrqEnabled(uart->irq) && SimUartAsserted(uart))
+            {
+                stop = true;
+            }
+
+            else
+            {
+                SimUartRxPush(uart, &uart->inbound[uart->inHead]);
+                uart->inHead = (uint16_t)((uart->inHead + 1U) & (SIM_UART_INBOUND - 1U));
+                uart->inCount--;
+            }
+        }
+
+        if ((uart->rxCount != 0U) && uart->rtArmed &&
+            (nowNs >= (uart->rxLastNs + ((SimUartCharNs(uart) * SIM_UART_RT_BITS) / 10U))))
+        {
+            uart->ris |= (uint32_t)UART_INT_RT;
+            uart->rtArmed = false;
+        }
+
+        else
+        {
+
+        }
+
+        SimUdmaService(uart->base);
+    }
+}
+
+/*
+ * Description :
+ * This function tells whether a UART drives the given interrupt line.
+ * Parameters: irq -> The interrupt number.
+ * Returns: true if the interrupt is raised by a UART.
+ */
+bool SimUartIrqAsserted(uint32_t irq)
+{
+    bool asserted = false;
+    uint32_t i;
+
+    for (i = 0U; i < SIM_UART_COUNT; i++)
+    {
+        asserted = asserted || ((uarts[i].irq == irq) && SimUartAsserted(&uarts[i]));
+    }
+
+    return asserted;
+}
+
+/*
+ * Description :
+ * This function is called when the core enters a UART ISR, the uDMA
+ * completion is a pulse taken at that point.
+ * Parameters: irq -> The interrupt number.
+ * Returns: None.
+ */
+void SimUartIrqEnter(uint32_t irq)
+{
+    uint32_t i;
+
+    for (i = 0U; i < SIM_UART_COUNT; i++)
+    {
+        if (uarts[i].irq == irq)
+        {
+            uarts[i].dmaDone = false;
+        }
+
+        else
+        {
+
+        }
+    }
+}
+
+/*
+ * Description :
+ * This function is called when the core leaves a UART ISR. Bytes written
+ * by the ISR were written when the TX FIFO reached its level: the ISR is
+ * taken as running at that time, which keeps the line busy when the host
+ * was late to run it.
+ * Parameters: irq -> The interrupt number.
+ * Returns: None.
+ */
+void SimUartIrqExit(uint32_t irq)
+{
+    uint32_t i;
+
+    for (i = 0U; i < SIM_UART_COUNT; i++)
+    {
+        if (uarts[i].irq == irq)
+        {
+            uarts[i].txEdgeNs = 0U;
+        }
+
+        else
+        {
+
+        }
+    }
+}
+
+/*
+ * Description :
+ * This function sends the wire bytes stamped since the last call.
+ * Parameters: None.
+ * Returns: None.
+ */
+void SimUartFlushWire(void)
+{
+    uint32_t i;
+
+    for (i = 0U; i < SIM_UART_COUNT; i++)
+    {
+        simUart_t *uart = &uarts[i];
+
+        if ((uart->outCount != 0U) && (uart->fd >= 0) && !uart->console)
+        {
+            ssize_t sent = send(uart->fd, uart->outbound, (size_t)uart->outCount * sizeof(simWireByte_t),
+                                MSG_DONTWAIT | MSG_NOSIGNAL);
+
+            if ((sent < 0) && (uart->outLost == 0U) && (errno != EPIPE))
+            {
+                fprintf(stderr, "sim: board %c: the wire is full, bytes lost\n", (char)('A' + SimBoardGetConfig()->id));
+            }
+
+            else
+            {
+
+            }
+
+            uart->outLost += (sent < 0) ? uart->outCount : 0U;
+        }
+
+        else
+        {
+
+        }
+
+        uart->outCount = 0U;
+    }
+}
+
+/*
+ * Description :
+ * This function returns the time of the next UART event: a character
+ * arriving, a TX FIFO slot freeing, the end of a character or a receive
+ * timeout.
+ * Parameters: nowNs -> The current time.
+ * Returns: The time of the next event, or the maximum time if none.
+ */
+uint64_t SimUartNextEventNs(uint64_t nowNs)
+{
+    uint64_t next = SIM_NO_TIME;
+    uint32_t i;
+    uint8_t j;
+
+    for (i = 0U; i < SIM_UART_COUNT; i++)
+    {
+        simUart_t *uart = &uarts[i];
+
+        if (uart->inCount != 0U)
+        {
+            uint64_t arrival = uart->inbound[uart->inHead].arrivalNs;
+            next = (arrival < next) ? arrival : next;
+        }
+
+        else
+        {
+
+        }
+
+        for (j = 0U; j < uart->txCount; j++)
+        {
+            const simTxByte_t *byte = &uart->tx[(uart->txHead + j) & (SIM_UART_TX_QUEUE - 1U)];
+            uint64_t event = (byte->startNs > nowNs) ? byte->startNs : byte->endNs;
+
+            next = (byte->scheduled && (event < next)) ? event : next;
+        }
+
+        if ((uart->rxCount != 0U) && uart->rtArmed)
+        {
+            uint64_t timeout = uart->rxLastNs + ((SimUartCharNs(uart) * SIM_UART_RT_BITS) / 10U);
+            next = (timeout < next) ? timeout : next;
+        }
+
+        else
+        {
+
+        }
+    }
+
+    return next;
+}
+
+/*
+ * Description :
+ * This function lists the descriptors the host waits on while the board sleeps.
+ * Parameters: fds -> Array of at least SIM_UART_COUNT entries.
+ * Returns: The number of descriptors.
+ */
+uint8_t SimUartPollFds(struct pollfd *fds)
+{
+    uint8_t count = 0U;
+    uint32_t i;
+
+    for (i = 0U; i < SIM_UART_COUNT; i++)
+    {
+        if ((uarts[i].fd >= 0) && ((SIM_UART_INBOUND - uarts[i].inCount) >= SIM_WIRE_BATCH))
+        {
+            fds[count].fd = uarts[i].fd;
+            fds[count].events = POLLIN;
+            fds[count].revents = 0;
+            count++;
+        }
+
+        else
+        {
+
+        }
+    }
+
+    return count;
+}
+
+/*
+ * Description :
+ * This function maps a UART register address on the model.
+ * Parameters: addr -> The register address.
+ * Returns: A pointer to the register, or NULL if it is not a UART register.
+ */
+volatile uint32_t* SimUartRegister(uint32_t addr)
+{
+    simUart_t *uart = SimUartFind(addr & 0xFFFFF000U);
+    uint32_t *reg = NULL;
+
+    if (NULL != uart)
+    {
+        switch (addr & 0x00000FFFU)
+        {
+        case UART_O_RSR:
+            reg = &uart->rsr;
+            break;
+        case UART_O_FR:
+            uart->computed = (uart->rxCount == 0U) ? (uint32_t)UART_FR_RXFE : 0U;
+            uart->computed |= (uart->rxCount == SimUartDepth(uart)) ? (uint32_t)UART_FR_RXFF : 0U;
+            uart->computed |= (SimUartTxWaiting(uart, SimNowNs()) == SimUartDepth(uart)) ? (uint32_t)UART_FR_TXFF : 0U;
+            uart->computed |= (SimUartTxWaiting(uart, SimNowNs()) == 0U) ? (uint32_t)UART_FR_TXFE : 0U;
+            uart->computed |= SimUartTxBusy(uart, SimNowNs()) ? (uint32_t)UART_FR_BUSY : 0U;
+            reg = &uart->computed;
+            break;
+        case UART_O_IBRD:
+            reg = &uart->ibrd;
+            break;
+        case UART_O_FBRD:
+            reg = &uart->fbrd;
+            break;
+        case UART_O_LCRH:
+            reg = &uart->lcrh;
+            break;
+        case UART_O_CTL:
+            reg = &uart->ctl;
+            break;
+        case UART_O_IFLS:
+            reg = &uart->ifls;
+            break;
+        case UART_O_IM:
+            reg = &uart->im;
+            break;
+        case UART_O_RIS:
+            reg = &uart->ris;
+            break;
+        case UART_O_MIS:
+            uart->computed = uart->ris & uart->im;
+            reg = &uart->computed;
+            break;
+        case UART_O_DMACTL:
+            reg = &uart->dmactl;
+            break;
+        case UART_O_9BITADDR:
+            reg = &uart->bitAddr;
+            break;
+        case UART_O_9BITAMASK:
+            reg = &uart->bitAmask;
+            break;
+        default:
+            reg = &uart->scratch[(addr >> 2) & 7U];
+            break;
+        }
+    }
+
+    else
+    {
+
+    }
+
+    return reg;
+}
+
+/*
+ * Description :
+ * These functions are the uDMA requests of a UART: reading its data
+ * register, writing it, signalling the end of a transfer.
+ */
+bool SimUartDmaRead(uint32_t base, uint8_t *data)
+{
+    simUart_t *uart = SimUartFind(base);
+    uint16_t word;
+    bool popped = (NULL != uart) && SimUartRxPop(uart, &word);
+
+    if (popped)
+    {
+        *data = (uint8_t)word;
+    }
+
+    else
+    {
+
+    }
+
+    return popped;
+}
+
+bool SimUartDmaWrite(uint32_t base, uint8_t data, uint64_t writeNs)
+{
+    simUart_t *uart = SimUartFind(base);
+
+    return (NULL != uart) && SimUartTxPut(uart, data, false, writeNs);
+}
+
+void SimUartDmaDone(uint32_t base)
+{
+    simUart_t *uart = SimUartFind(base);
+
+    if (NULL != uart)
+    {
+        uart->dmaDone = true;
+    }
+
+    else
+    {
+
+    }
+}
+
+bool SimUartDmaEnabled(uint32_t base, uint32_t flags)
+{
+    simUart_t *uart = SimUartFind(base);
+
+    return (NULL != uart) && ((uart->dmactl & flags) == flags);
+}
+
+/*******************************************************************************
+ *                      Fake driverlib: uart.h                                 *
+ *******************************************************************************/
+void UARTEnable(uint32_t ui32Base)
+{
+    simUart_t *uart = SimUartFind(ui32Base);
+
+    SimLock();
+    uart->lcrh |= (uint32_t)UART_LCRH_FEN;
+    uart->ctl |= (uint32_t)UART_CTL_UARTEN | (uint32_t)UART_CTL_TXE | (uint32_t)UART_CTL_RXE;
+    SimUartTxSchedule(uart);
+    SimUnlock();
+}
+
+void UARTDisable(uint32_t ui32Base)
+{
+    simUart_t *uart = SimUartFind(ui32Base);
+
+    /* Like the driverlib, let the character being sent finish first */
+    SimSync();
+    SimLock();
+
+    while (SimUartTxBusy(uart, SimNowNs()))
+    {
+
+    }
+
+    uart->lcrh &= ~(uint32_t)UART_LCRH_FEN;
+    uart->ctl &= ~((uint32_t)UART_CTL_UARTEN | (uint32_t)UART_CTL_TXE | (uint32_t)UART_CTL_RXE);
+    SimUnlock();
+}
+
+void UARTConfigSetExpClk(uint32_t ui32Base, uint32_t ui32UARTClk, uint32_t ui32Baud, uint32_t ui32Config)
+{
+    simUart_t *uart = SimUartFind(ui32Base);
+    uint32_t divisor;
+
+    UARTDisable(ui32Base);
+
+    SimLock();
+
+    if ((ui32Baud * 16U) > ui32UARTClk)
+    {
+        uart->ctl |= (uint32_t)UART_CTL_HSE;
+        ui32Baud /= 2U;
+    }
+
+    else
+    {
+        uart->ctl &= ~(uint32_t)UART_CTL_HSE;
+    }
+
+    divisor = (((ui32UARTClk * 8U) / ui32Baud) + 1U) / 2U;
+    uart->ibrd = divisor / 64U;
+    uart->fbrd = divisor % 64U;
+    uart->lcrh = ui32Config;
+    SimUnlock();
+
+    UARTEnable(ui32Base);
+}
+
+void UARTFIFOLevelSet(uint32_t ui32Base, uint32_t ui32TxLevel, uint32_t ui32RxLevel)
+{
+    SimUartFind(ui32Base)->ifls = ui32TxLevel | ui32RxLevel;
+}
+
+void UARTFIFOEnable(uint32_t ui32Base)
+{
+    SimUartFind(ui32Base)->lcrh |= (uint32_t)UART_LCRH_FEN;
+}
+
+void UARTFIFODisable(uint32_t ui32Base)
+{
+    SimUartFind(ui32Base)->lcrh &= ~(uint32_t)UART_LCRH_FEN;
+}
+
+bool UARTCharsAvail(uint32_t ui32Base)
+{
+    return (SimUartFind(ui32Base)->rxCount != 0U);
+}
+
+bool UARTSpaceAvail(uint32_t ui32Base)
+{
+    simUart_t *uart = SimUartFind(ui32Base);
+    uint64_t now = SimNowNs();
+    bool space;
+
+    SimLock();
+    SimUartTxRetire(uart, now);
+    space = (SimUartTxWaiting(uart, now) < SimUartDepth(uart)) && (uart->txCount < SIM_UART_TX_QUEUE);
+    SimUnlock();
+
+    return space;
+}
+
+int32_t UARTCharGetNonBlocking(uint32_t ui32Base)
+{
+    uint16_t word;
+    int32_t result = -1;
+
+    SimLock();
+
+    if (SimUartRxPop(SimUartFind(ui32Base), &word))
+    {
+        result = (int32_t)word;
+    }
+
+    else
+    {
+
+    }
+
+    SimUnlock();
+
+    return result;
+}
+
+int32_t UARTCharGet(uint32_t ui32Base)
+{
+    int32_t result;
+
+    while ((result = UARTCharGetNonBlocking(ui32Base)) < 0)
+    {
+
+    }
+
+    return result;
+}
+
+bool UARTCharPutNonBlocking(uint32_t ui32Base, unsigned char ucData)
+{
+    simUart_t *uart = SimUartFind(ui32Base);
+    uint64_t writeNs = SimNowNs();
+    bool accepted;
+
+    SimLock();
+
+    if (SimInIsr(uart->irq) && (uart->txEdgeNs != 0U))
+    {
+        writeNs = uart->txEdgeNs;
+    }
+
+    else
+    {
+
+    }
+
+    accepted = SimUartTxPut(uart, (uint8_t)ucData, false, writeNs);
+    SimUnlock();
+
+    return accepted;
+}
+
+void UARTCharPut(uint32_t ui32Base, unsigned char ucData)
+{
+    while (!UARTCharPutNonBlocking(ui32Base, ucData))
+    {
+
+    }
+}
+
+bool UARTBusy(uint32_t ui32Base)
+{
+    bool busy;
+
+    SimLock();
+    busy = SimUartTxBusy(SimUartFind(ui32Base), SimNowNs());
+    SimUnlock();
+
+    return busy;
+}
+
+void UARTIntRegister(uint32_t ui32Base, void (*pfnHandler)(void))
+{
+    simUart_t *uart = SimUartFind(ui32Base);
+
+    IntRegister(uart->irq, pfnHandler);
+    IntEnable(uart->irq);
+}
+
+void UARTIntEnable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    SimLock();
+    SimUartFind(ui32Base)->im |= ui32IntFlags;
+    SimUnlock();
+}
+
+void UARTIntDisable(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    SimLock();
+    SimUartFind(ui32Base)->im &= ~ui32IntFlags;
+    SimUnlock();
+}
+
+uint32_t UARTIntStatus(uint32_t ui32Base, bool bMasked)
+{
+    simUart_t *uart = SimUartFind(ui32Base);
+
+    return bMasked ? (uart->ris & uart->im) : uart->ris;
+}
+
+void UARTIntClear(uint32_t ui32Base, uint32_t ui32IntFlags)
+{
+    SimLock();
+    SimUartFind(ui32Base)->ris &= ~ui32IntFlags;
+    SimUnlock();
+}
+
+void UARTDMAEnable(uint32_t ui32Base, uint32_t ui32DMAFlags)
+{
+    SimLock();
+    SimUartFind(ui32Base)->dmactl |= ui32DMAFlags;
+    SimUnlock();
+}
+
+void UARTDMADisable(uint32_t ui32Base, uint32_t ui32DMAFlags)
+{
+    SimLock();
+    SimUartFind(ui32Base)->dmactl &= ~ui32DMAFlags;
+    SimUnlock();
+}
+
+uint32_t UARTRxErrorGet(uint32_t ui32Base)
+{
+    return SimUartFind(ui32Base)->rsr & 0x0000000FU;
+}
+
+void UARTRxErrorClear(uint32_t ui32Base)
+{
+    SimUartFind(ui32Base)->rsr = 0U;
+}
+
+void UARTTxIntModeSet(uint32_t ui32Base, uint32_t ui32Mode)
+{
+    simUart_t *uart = SimUartFind(ui32Base);
+
+    uart->ctl = (uart->ctl & ~(uint32_t)UART_CTL_EOT) | (ui32Mode & (uint32_t)UART_CTL_EOT);
+}
+
+void UART9BitEnable(uint32_t ui32Base)
+{
+    SimLock();
+    SimUartFind(ui32Base)->bitAddr |= (uint32_t)UART_9BITADDR_9BITEN;
+    SimUnlock();
+}
+
+void UART9BitDisable(uint32_t ui32Base)
+{
+    SimLock();
+    SimUartFind(ui32Base)->bitAddr &= ~(uint32_t)UART_9BITADDR_9BITEN;
+    SimUnlock();
+}
+
+void UART9BitAddrSet(uint32_t ui32Base, uint8_t ui8Addr, uint8_t ui8Mask)
+{
+    simUart_t *uart = SimUartFind(ui32Base);
+
+    SimLock();
+    uart->bitAddr = (uart->bitAddr & (uint32_t)UART_9BITADDR_9BITEN) | (uint32_t)ui8Addr;
+    uart->bitAmask = (uint32_t)ui8Mask;
+    SimUnlock();
+}
+
+void UART9BitAddrSend(uint32_t ui32Base, uint8_t ui8Addr)
+{
+    simUart_t *uart = SimUartFind(ui32Base);
+
+    /* Like the driverlib, wait for the transmitter to be idle before and
+     * after the address byte, the 9th bit is only set for that byte */
+    SimSync();
+    SimLock();
+
+    while (SimUartTxBusy(uart, SimNowNs()))
+    {
+
+    }
+
+    (void)SimUartTxPut(uart, ui8Addr, true, SimNowNs());
+
+    while (SimUartTxBusy(uart, SimNowNs()))
+    {
+
+    }
+
+    SimUnlock();
+}
@@ -0,0 +1,270 @@
+/*******************************************************************************
+ *                                                                             *
+ * [FILE NAME]:   sim_udma.c                                                   *
+ *                                                                             *
+ * [AUTHORS]:     Ahmed Saeed, Amr Gafar, Kareem Abd-elrasheed,                *
+ *                Mohamed Abosreea, Ahmed Maher, and Mohamed Ramadan           *
+ *                                                                             *
+ * [Version]:     1.0.0                                                        *
+ *                                                                             *
+ * [DATE]:        17/10/2026                                                   *
+ *                                                                             *
+ * [DESCRIPTION]: source file for the uDMA model of the host simulation,       *
+ *                basic and ping-pong transfers between UART1 and memory       *
+ *                                                                             *
+ *******************************************************************************/
+
+/*******************************************************************************
+ *                                 Includes                                    *
+ *******************************************************************************/
+#include "sim.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/uart.h"
+#include "driverlib/udma.h"
+
+/*******************************************************************************
+ *                                Definitions                                  *
+ *******************************************************************************/
+#define SIM_UDMA_CHANNELS 32U
+
+/*******************************************************************************
+ *                               Types Declaration                             *
+ *******************************************************************************/
+/*
+ * Description: One channel control structure: the transfer mode, the memory
+ *              side of the transfer, its size and the items left.
+ */
+typedef struct
+{
+    uint32_t mode;
+    uint8_t *memory;
+    uint32_t size;
+    uint32_t left;
+} simUdmaControl_t;
+
+/*
+ * Description: One channel: its primary and alternate control structures
+ *              and the one in use.
+ */
+typedef struct
+{
+    simUdmaControl_t control[2];
+    bool enabled;
+    uint8_t active;
+    uint64_t enabledNs;
+} simUdmaChannel_t;
+
+/*******************************************************************************
+ *                            Global Variables                                 *
+ *******************************************************************************/
+static simUdmaChannel_t channels[SIM_UDMA_CHANNELS];
+
+/*******************************************************************************
+ *                      Private Functions Prototypes                           *
+ *******************************************************************************/
+static void SimUdmaItemDone(simUdmaChannel_t *channel, uint32_t base);
+
+/*******************************************************************************
+ *                      Private Functions definitions                          *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function counts a transferred item. At the end of a control
+ * structure the peripheral is told, a ping-pong channel moves on to the
+ * other structure and the channel stops if that one is not armed.
+ * Parameters: channel -> The uDMA channel.
+ *             base    -> The UART it serves.
+ * Returns: None.
+ */
+static void SimUdmaItemDone(simUdmaChannel_t *channel, uint32_t base)
+{
+    simUdmaControl_t *control = &channel->control[channel->active];
+    uint32_t mode = control->mode;
+
+    control->left--;
+
+    if (control->left == 0U)
+    {
+        control->mode = (uint32_t)UDMA_MODE_STOP;
+        SimUartDmaDone(base);
+
+        /* A ping-pong channel always moves on to the other structure,
+         * so it resumes from there once it is enabled again */
+        if (mode == (uint32_t)UDMA_MODE_PINGPONG)
+        {
+            channel->active ^= 1U;
+        }
+
+        else
+        {
+
+        }
+
+        if (channel->control[channel->active].mode == (uint32_t)UDMA_MODE_STOP)
+        {
+            channel->enabled = false;
+        }
+
+        else
+        {
+
+        }
+    }
+
+    else
+    {
+
+    }
+}
+
+/*******************************************************************************
+ *                      Functions definitions                                  *
+ *******************************************************************************/
+/*
+ * Description :
+ * This function serves the uDMA requests of a UART: received bytes are
+ * moved to memory as soon as they arrive and bytes to send are moved
+ * to the TX FIFO as long as it has room.
+ * Parameters: base -> The UART base address.
+ * Returns: None.
+ */
+void SimUdmaService(uint32_t base)
+{
+    if (base == (uint32_t)UART1_BASE)
+    {
+        simUdmaChannel_t *rx = &channels[UDMA_CHANNEL_UART1RX];
+        simUdmaChannel_t *tx = &channels[UDMA_CHANNEL_UART1TX];
+        uint8_t data;
+
+        while (rx->enabled && SimUartDmaEnabled(base, (uint32_t)UART_DMA_RX) &&
+               (rx->control[rx->active].mode != (uint32_t)UDMA_MODE_STOP) && SimUartDmaRead(base, &data))
+        {
+            simUdmaControl_t *control = &rx->control[rx->active];
+
+            control->memory[control->size - control->left] = data;
+            SimUdmaItemDone(rx, base);
+        }
+
+        /* A transfer keeps the line busy from the time it was enabled */
+        while (tx->enabled && SimUartDmaEnabled(base, (uint32_t)UART_DMA_TX) &&
+               (tx->control[tx->active].mode != (uint32_t)UDMA_MODE_STOP) &&
+               SimUartDmaWrite(base, tx->control[tx->active].memory[tx->control[tx->active].size - tx->control[tx->active].left],
+                               tx->enabledNs))
+        {
+            SimUdmaItemDone(tx, base);
+        }
+    }
+
+    else
+    {
+
+    }
+}
+
+/*******************************************************************************
+ *                      Fake driverlib: udma.h                                 *
+ *******************************************************************************/
+void uDMAEnable(void)
+{
+}
+
+void uDMADisable(void)
+{
+}
+
+uint32_t uDMAErrorStatusGet(void)
+{
+    return 0U;
+}
+
+void uDMAErrorStatusClear(void)
+{
+}
+
+void uDMAChannelEnable(uint32_t ui32ChannelNum)
+{
+    simUdmaChannel_t *channel = &channels[ui32ChannelNum & (SIM_UDMA_CHANNELS - 1U)];
+
+    SimLock();
+    channel->enabled = true;
+    channel->enabledNs = SimNowNs();
+    SimUdmaService((uint32_t)UART1_BASE);
+    SimUnlock();
+}
+
+void uDMAChannelDisable(uint32_t ui32ChannelNum)
+{
+    SimLock();
+    channels[ui32ChannelNum & (SIM_UDMA_CHANNELS - 1U)].enabled = false;
+    SimUnlock();
+}
+
+bool uDMAChannelIsEnabled(uint32_t ui32ChannelNum)
+{
+    return channels[ui32ChannelNum & (SIM_UDMA_CHANNELS - 1U)].enabled;
+}
+
+void uDMAControlBaseSet(void *pControlTable)
+{
+    (void)pControlTable;
+}
+
+void uDMAChannelAttributeEnable(uint32_t ui32ChannelNum, uint32_t ui32Attr)
+{
+    (void)ui32ChannelNum;
+    (void)ui32Attr;
+}
+
+void uDMAChannelAttributeDisable(uint32_t ui32ChannelNum, uint32_t ui32Attr)
+{
+    (void)ui32ChannelNum;
+    (void)ui32Attr;
+}
+
+void uDMAChannelControlSet(uint32_t ui32ChannelStructIndex, uint32_t ui32Control)
+{
+    /* Only byte transfers between a UART and memory are modelled */
+    (void)ui32ChannelStructIndex;
+    (void)ui32Control;
+}
+
+void uDMAChannelTransferSet(uint32_t ui32ChannelStructIndex, uint32_t ui32Mode, void *pvSrcAddr, void *pvDstAddr,
+                            uint32_t ui32TransferSize)
+{
+    simUdmaChannel_t *channel = &channels[ui32ChannelStructIndex & (SIM_UDMA_CHANNELS - 1U)];
+    simUdmaControl_t *control = &channel->control[((ui32ChannelStructIndex & (uint32_t)UDMA_ALT_SELECT) != 0U) ? 1U : 0U];
+
+    SimLock();
+    control->mode = ui32Mode;
+    control->memory = ((ui32ChannelStructIndex & (SIM_UDMA_CHANNELS - 1U)) == (uint32_t)UDMA_CHANNEL_UART1RX) ?
+                      (uint8_t *)pvDstAddr : (uint8_t *)pvSrcAddr;
+    control->size = ui32TransferSize;
+    control->left = ui32TransferSize;
+    SimUnlock();
+}
+
+uint32_t uDMAChannelSizeGet(uint32_t ui32ChannelStructIndex)
+{
+    simUdmaChannel_t *channel = &channels[ui32ChannelStructIndex & (SIM_UDMA_CHANNELS - 1U)];
+
+    return channel->control[((ui32ChannelStructIndex & (uint32_t)UDMA_ALT_SELECT) != 0U) ? 1U : 0U].left;
+}
+
+uint32_t uDMAChannelModeGet(uint32_t ui32ChannelStructIndex)
+{
+    simUdmaChannel_t *channel = &channels[ui32ChannelStructIndex & (SIM_UDMA_CHANNELS - 1U)];
+
+    return channel->control[((ui32ChannelStructIndex & (uint32_t)UDMA_ALT_SELECT) != 0U) ? 1U : 0U].mode;
+}
+
+void uDMAChannelAssign(uint32_t ui32Mapping)
+{
+    (void)ui32Mapping;
+}
+
+void uDMAIntRegister(uint32_t ui32IntChannel, void (*pfnHandler)(void))
+{
+    /* Bus errors are never raised */
+    (void)ui32IntChannel;
+    (void)pfnHandler;
+}
@@ -0,0 +1,217 @@
+#!/usr/bin/env python3
+################################################################################
+# Runs the benchmark suite of the firmware built with BENCH_MODE set to 1U
+# and collects its results, one JSON object per line.
+#
+#   bench.py --sim sim/build/bench/uart_chat_sim [--sim-args "-e 100"]
+#   bench.py --port /dev/ttyACM0 [--baud 115200]
+#
+# --output stores the results, --baseline compares them with the results of
+# an earlier run and exits with status 1 when a figure got worse by more than
+# --tolerance percent, so that a regression between two firmware versions
+# shows up. See the Benchmark section of the README.
+################################################################################
+
+import argparse
+import json
+import os
+import re
+import select
+import subprocess
+import sys
+import termios
+import time
+import tty
+
+# Figures compared with the baseline, and whether a larger value is better
+COMPARED = (
+    ("goodput_bytes_per_s", True),
+    ("latency_p50_us", False),
+    ("latency_p99_us", False),
+    ("cycles_per_byte", False),
+)
+
+# Figures of the compression records, keyed by corpus and frame size
+COMPARED_COMPRESSION = (
+    ("ratio_x100", True),
+    ("compress_cycles_per_byte", False),
+    ("decompress_cycles_per_byte", False),
+)
+
+BAUD_CONSTANTS = {
+    9600: termios.B9600,
+    19200: termios.B19200,
+    38400: termios.B38400,
+    57600: termios.B57600,
+    115200: termios.B115200,
+}
+
+
+def open_terminal(path, baud):
+    """Opens a serial port or a simulated terminal in raw mode."""
+    fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+    tty.setraw(fd)
+
+    if baud is not None:
+        attrs = termios.tcgetattr(fd)
+        attrs[4] = attrs[5] = BAUD_CONSTANTS[baud]
+        termios.tcsetattr(fd, termios.TCSANOW, attrs)
+
+    return fd
+
+
+def read_results(fd, timeout):
+    """Starts the suite and returns its JSON records, up to the end record."""
+    records = []
+    pending = b""
+    deadline = time.monotonic() + timeout
+
+    termios.tcflush(fd, termios.TCIFLUSH)
+    os.write(fd, b"b")
+
+    while True:
+        left = deadline - time.monotonic()
+        if left <= 0:
+            raise TimeoutError("no end record after %d s" % timeout)
+
+        ready, _, _ = select.select([fd], [], [], left)
+        if not ready:
+            continue
+
+        pending += os.read(fd, 4096)
+        while b"\n" in pending:
+            line, pending = pending.split(b"\n", 1)
+            line = line.strip(b"\r ").decode("ascii", "replace")
+            if not line.startswith("{"):
+                continue
+
+            record = json.loads(line)
+            records.append(record)
+            print(line, file=sys.stderr)
+
+            if record.get("type") == "end":
+                return records
+
+
+def run_sim(binary, sim_args, timeout):
+    """Starts the two simulated boards and runs the suite on board A."""
+    sim = subprocess.Popen([binary] + sim_args.split(), stdin=subprocess.PIPE,
+                           stdout=subprocess.PIPE, text=True)
+    try:
+        terminals = []
+        while len(terminals) < 2:
+            line = sim.stdout.readline()
+            if not line:
+                raise RuntimeError("the simulation stopped")
+            match = re.match(r"board [AB]: pid \d+, PC terminal (\S+)", line)
+            if match:
+                terminals.append(match.group(1))
+
+        fd = open_terminal(terminals[0], None)
+        try:
+            return read_results(fd, timeout)
+        finally:
+            os.close(fd)
+    finally:
+        sim.stdin.write("q")
+        sim.stdin.close()
+        sim.wait()
+
+
+def compare(results, baseline, tolerance):
+    """Prints the change of every figure, returns the number of regressions."""
+    before = {r["size"]: r for r in baseline if r.get("type") == "result"}
+    regressions = 0
+
+    for result in (r for r in results if r.get("type") == "result"):
+        old = before.get(result["size"])
+        if old is None:
+            continue
+
+        for name, larger_is_better in COMPARED:
+            if old[name] == 0:
+                continue
+
+            change = 100.0 * (result[name] - old[name]) / old[name]
+            worse = -change if larger_is_better else change
+            flag = ""
+            if worse > tolerance:
+                flag = "  REGRESSION"
+                regressions += 1
+            print("size %5d %-20s %10d -> %10d %+7.1f%%%s"
+                  % (result["size"], name, old[name], result[name], change, flag))
+
+        if result["loss_ppm"] > old["loss_ppm"]:
+            print("size %5d loss_ppm %d -> %d  REGRESSION"
+                  % (result["size"], old["loss_ppm"], result["loss_ppm"]))
+            regressions += 1
+
+    before = {(r["corpus"], r["frame_bytes"]): r
+              for r in baseline if r.get("type") == "compression"}
+
+    for result in (r for r in results if r.get("type") == "compression"):
+        key = (result["corpus"], result["frame_bytes"])
+        old = before.get(key)
+        if old is None:
+            continue
+
+        for name, larger_is_better in COMPARED_COMPRESSION:
+            if old[name] == 0:
+                continue
+
+            change = 100.0 * (result[name] - old[name]) / old[name]
+            worse = -change if larger_is_better else change
+            flag = ""
+            if worse > tolerance:
+                flag = "  REGRESSION"
+                regressions += 1
+            print("%-6s %3d %-26s %8d -> %8d %+7.1f%%%s"
+                  % (key + (name, old[name], result[name], change, flag)))
+
+        if not result["round_trip"]:
+            print("%-6s %3d round_trip failed  REGRESSION" % key)
+            regressions += 1
+
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Runs the benchmark suite of the firmware.")
+    target = parser.add_mutually_exclusive_group(required=True)
+    target.add_argument("--sim", help="host simulation binary built with BENCH_MODE=1U")
+    target.add_argument("--port", help="serial port of the board running the suite")
+    parser.add_argument("--sim-args", default="", help="options of the simulation, e.g. \"-e 100\"")
+    parser.add_argument("--baud", type=int, default=115200, choices=sorted(BAUD_CONSTANTS))
+    parser.add_argument("--timeout", type=int, default=600, help="seconds allowed to the suite")
+    parser.add_argument("--output", help="file where the results are stored")
+    parser.add_argument("--baseline", help="results of an earlier run to compare with")
+    parser.add_argument("--tolerance", type=float, default=10.0, help="allowed change in percent")
+    args = parser.parse_args()
+
+    if args.sim is not None:
+        results = run_sim(args.sim, args.sim_args, args.timeout)
+    else:
+        fd = open_terminal(args.port, args.baud)
+        try:
+            results = read_results(fd, args.timeout)
+        finally:
+            os.close(fd)
+
+    lines = "".join(json.dumps(r, sort_keys=True) + "\n" for r in results)
+    if args.output is not None:
+        with open(args.output, "w") as output:
+            output.write(lines)
+    else:
+        sys.stdout.write(lines)
+
+    if args.baseline is not None:
+        with open(args.baseline) as baseline:
+            old = [json.loads(line) for line in baseline if line.strip()]
+        if compare(results, old, args.tolerance) != 0:
+            return 1
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+################################################################################
+# Turns the binary log of the firmware built with LOG_MODE set to 1U back
+# into text, with the string table of the firmware (HAL/log_table.h).
+#
+#   logdecode.py capture.bin                 decodes a capture of UART0
+#   logdecode.py --port /dev/ttyACM0         terminal of the board, Ctrl-] quits
+#
+# Every byte outside a log frame, the text typed and received in the chat,
+# goes through unchanged. --table reads the table of another source tree,
+# it must be the one the firmware was built with. See the Log section of
+# the README.
+################################################################################
+
+import argparse
+import os
+import re
+import select
+import sys
+import termios
+import tty
+
+FRAME_START = 0x1F
+QUIT = b"\x1d"
+
+DEFAULT_TABLE = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "HAL", "log_table.h")
+
+MESSAGE = re.compile(r'^\s*LOG_MESSAGE\(\s*(\w+)\s*,\s*((?:"(?:[^"\\]|\\.)*"\s*)+)\)', re.MULTILINE)
+STRING = re.compile(r'"((?:[^"\\]|\\.)*)"')
+CONVERSION = re.compile(r"%(.)")
+ESCAPES = {"n": "\n", "r": "\r", "t": "\t", "\\": "\\", '"': '"', "'": "'", "0": "\0"}
+
+BAUD_CONSTANTS = {
+    9600: termios.B9600,
+    19200: termios.B19200,
+    38400: termios.B38400,
+    57600: termios.B57600,
+    115200: termios.B115200,
+}
+
+
+def read_table(path):
+    """Returns the name and format of every message, in the order of their ids."""
+    with open(path) as source:
+        text = source.read()
+
+    table = []
+    for name, strings in MESSAGE.findall(text):
+        literal = "".join(STRING.findall(strings))
+        table.append((name, re.sub(r"\\(.)", lambda m: ESCAPES.get(m.group(1), m.group(1)), literal)))
+    return table
+
+
+def arguments_of(fmt):
+    """Counts the conversions of a format taking an argument."""
+    return sum(1 for conversion in CONVERSION.findall(fmt) if conversion in "udh")
+
+
+def render(fmt, args):
+    """Fills a format in as the firmware does with LOG_MODE set to 0U."""
+    values = iter(args)
+
+    def convert(match):
+        conversion = match.group(1)
+        if conversion == "u":
+            return str(next(values))
+        if conversion == "d":
+            value = next(values)
+            return str(value - (1 << 32) if value & 0x80000000 else value)
+        if conversion == "h":
+            value = next(values)
+            return "%d.%02d" % (value // 100, value % 100)
+        return conversion
+
+    return CONVERSION.sub(convert, fmt)
+
+
+class Decoder:
+    """Decodes a stream fed in pieces, a frame may be cut between two of them."""
+
+    def __init__(self, table):
+        self.table = table
+        self.pending = b""
+        self.frames = 0
+        self.bytes_in = 0
+        self.text_out = 0
+        self.errors = 0
+
+    def feed(self, data):
+        """Returns the text of the bytes received so far, less an unfinished frame."""
+        self.bytes_in += len(data)
+        data = self.pending + data
+        out = []
+        i = 0
+
+        while i < len(data):
+            start = data.find(bytes([FRAME_START]), i)
+            if start < 0:
+                out.append(data[i:].decode("latin-1"))
+                i = len(data)
+                break
+
+            out.append(data[i:start].decode("latin-1"))
+            frame = self.parse(data, start)
+            if frame is None:
+                break
+            text, i = frame
+            out.append(text)
+
+        self.pending = data[i:]
+        text = "".join(out)
+        self.text_out += len(text)
+        return text
+
+    def parse(self, data, start):
+        """Reads the frame at start, returns its text and where it ends, None if cut."""
+        if start + 1 >= len(data):
+            return None
+
+        number = data[start + 1]
+        if number >= len(self.table):
+            # Not a frame of this table, the byte goes through
+            self.errors += 1
+            return "<log %d?>" % number, start + 2
+
+        name, fmt = self.table[number]
+        args = []
+        i = start + 2
+
+        for _ in range(arguments_of(fmt)):
+            value, shift = 0, 0
+            while True:
+                if i >= len(data):
+                    return None
+                byte = data[i]
+                i += 1
+                value |= (byte & 0x7F) << shift
+                shift += 7
+                if byte < 0x80:
+                    break
+            args.append(value & 0xFFFFFFFF)
+
+        self.frames += 1
+        if name == "LOG_TABLE" and args and args[0] != len(self.table):
+            sys.stderr.write("logdecode: the firmware has %d messages, the table %d\n" % (args[0], len(self.table)))
+        return render(fmt, args), i
+
+
+def terminal(path, baud, decoder):
+    """Runs a terminal on the board: the keys go to it, its log is decoded."""
+    fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+    stdin = sys.stdin.fileno()
+    saved = termios.tcgetattr(stdin) if os.isatty(stdin) else None
+
+    try:
+        tty.setraw(fd)
+        attrs = termios.tcgetattr(fd)
+        attrs[4] = attrs[5] = BAUD_CONSTANTS[baud]
+        termios.tcsetattr(fd, termios.TCSANOW, attrs)
+        if saved is not None:
+            tty.setraw(stdin)
+
+        while True:
+            ready, _, _ = select.select([fd, stdin], [], [])
+            if fd in ready:
+                sys.stdout.write(decoder.feed(os.read(fd, 4096)))
+                sys.stdout.flush()
+            if stdin in ready:
+                keys = os.read(stdin, 64)
+                if not keys or QUIT in keys:
+                    break
+                os.write(fd, keys)
+    finally:
+        if saved is not None:
+            termios.tcsetattr(stdin, termios.TCSADRAIN, saved)
+        os.close(fd)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Turns the binary log of the firmware back into text.")
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("capture", nargs="?", help="file holding what the board wrote on UART0, - for stdin")
+    source.add_argument("--port", help="serial port of the board, to be used as its terminal")
+    parser.add_argument("--baud", type=int, default=115200, choices=sorted(BAUD_CONSTANTS))
+    parser.add_argument("--table", default=DEFAULT_TABLE, help="string table the firmware was built with")
+    args = parser.parse_args()
+
+    decoder = Decoder(read_table(args.table))
+
+    if args.port is not None:
+        terminal(args.port, args.baud, decoder)
+        return 0
+
+    if args.capture == "-":
+        data = sys.stdin.buffer.read()
+    else:
+        with open(args.capture, "rb") as capture:
+            data = capture.read()
+
+    sys.stdout.write(decoder.feed(data))
+    sys.stderr.write("%d frames, %d bytes decoded into %d characters, %d unknown\n"
+                     % (decoder.frames, decoder.bytes_in, decoder.text_out, decoder.errors))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,234 @@
+#!/usr/bin/env python3
+################################################################################
+# Turns the trace bursts of the firmware built with TRACE_MODE set to 1U into
+# a Chrome / Perfetto trace, to be opened in ui.perfetto.dev or
+# chrome://tracing.
+#
+#   trace2json.py capture.bin --output trace.json
+#   trace2json.py --port /dev/ttyACM0 --seconds 10 --output trace.json
+#
+# The capture is everything the board wrote on UART0, for example with
+# `cat /dev/ttyACM0 > capture.bin` on a port set raw with `stty raw`. The
+# terminal text between the bursts is skipped, and the bursts with a bad
+# CRC are counted and dropped. See the Trace section of the README.
+################################################################################
+
+import argparse
+import json
+import os
+import select
+import struct
+import sys
+import termios
+import time
+import tty
+
+MAGIC = b"TRC1"
+HEADER_LENGTH = 11
+RECORD_LENGTH = 7
+CRC_LENGTH = 2
+
+# The events in the order of traceEvent_t (HAL/trace.h): their name, the
+# track they are drawn on and how their argument reads
+EVENTS = (
+    ("SysticISR", "SysTick ISR", "tick"),
+    ("ButtonISR", "Button ISR", None),
+    ("UART1ISR", "UART1 ISR", None),
+    ("UART3ISR", "UART3 ISR", None),
+    ("Button", "Button", "button"),
+    ("Post", "Scheduler", "event"),
+    ("Handler", "Main loop", "event"),
+    ("State", "State", "state"),
+)
+
+PHASES = {0: "i", 1: "B", 2: "E"}
+
+SCHED_EVENTS = ("BUTTON", "LINK", "TERMINAL", "TICK", "WORK")
+BUTTON_EVENTS = ("PRESS", "RELEASE", "LONG_PRESS", "DOUBLE_PRESS")
+STATES = ("Off", "Listen", "SendAndReceive", "FileTransfer", "Ping")
+
+BAUD_CONSTANTS = {
+    9600: termios.B9600,
+    19200: termios.B19200,
+    38400: termios.B38400,
+    57600: termios.B57600,
+    115200: termios.B115200,
+}
+
+
+def crc16(data):
+    """CRC-16 of HAL/crc.c: polynomial 0x1021, initial value 0xFFFF."""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if (crc & 0x8000) else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def parse_bursts(capture, stats):
+    """Yields the clock, the records lost before it and the records of every burst."""
+    start = capture.find(MAGIC)
+
+    while start >= 0:
+        header = capture[start:start + HEADER_LENGTH]
+        if len(header) < HEADER_LENGTH:
+            stats["truncated"] += 1
+            return
+
+        hz, lost, count = struct.unpack(">IHB", header[4:])
+        end = start + HEADER_LENGTH + count * RECORD_LENGTH
+        burst = capture[start:end + CRC_LENGTH]
+
+        if len(burst) < end + CRC_LENGTH - start:
+            stats["truncated"] += 1
+            return
+
+        if struct.unpack(">H", burst[-CRC_LENGTH:])[0] != crc16(burst[:-CRC_LENGTH]):
+            # Text that looks like a burst, or a damaged one
+            stats["bad_crc"] += 1
+            start = capture.find(MAGIC, start + 1)
+            continue
+
+        records = [struct.unpack(">BHI", burst[i:i + RECORD_LENGTH])
+                   for i in range(HEADER_LENGTH, HEADER_LENGTH + count * RECORD_LENGTH, RECORD_LENGTH)]
+        stats["bursts"] += 1
+        stats["records"] += count
+        stats["lost"] += lost
+        yield hz, lost, records
+
+        start = capture.find(MAGIC, end + CRC_LENGTH)
+
+
+def describe(kind, arg):
+    """Reads the argument of an event."""
+    if kind == "event":
+        return {"event": SCHED_EVENTS[arg] if arg < len(SCHED_EVENTS) else arg}
+    if kind == "state":
+        return {"state": STATES[arg] if arg < len(STATES) else arg}
+    if kind == "button":
+        event, state = arg & 0xFF, arg >> 8
+        return {"event": BUTTON_EVENTS[event] if event < len(BUTTON_EVENTS) else event,
+                "selected": STATES[state] if state < len(STATES) else state}
+    if kind == "tick":
+        return {"tick": arg}
+    return {}
+
+
+def convert(capture):
+    """Returns the trace events of a capture and the figures about it."""
+    stats = {"bursts": 0, "records": 0, "lost": 0, "bad_crc": 0, "truncated": 0}
+    tracks = {}
+    events = []
+    open_spans = {}
+    cycles = None
+    last = 0
+
+    for hz, lost, records in parse_bursts(capture, stats):
+        if lost != 0 and cycles is not None:
+            events.append({"name": "lost %d records" % lost, "ph": "i", "s": "g", "pid": 1, "tid": 0,
+                           "ts": cycles * 1e6 / hz})
+
+        for kind, arg, stamp in records:
+            # The 32 bit cycle counter wraps, a record may be a little older
+            # than the one before it when an ISR stored it in between
+            delta = ((stamp - last + 0x80000000) & 0xFFFFFFFF) - 0x80000000
+            cycles = stamp if cycles is None else cycles + delta
+            last = stamp
+
+            phase, number = PHASES.get(kind >> 6), kind & 0x3F
+            if phase is None or number >= len(EVENTS):
+                continue
+            name, track, reading = EVENTS[number]
+            tid = tracks.setdefault(track, len(tracks) + 1)
+
+            # A span ending without its start, cut by the start of the trace
+            # or by lost records, is left out
+            depth = open_spans.get((tid, name), 0)
+            if phase == "E":
+                if depth == 0:
+                    continue
+                open_spans[(tid, name)] = depth - 1
+            elif phase == "B":
+                open_spans[(tid, name)] = depth + 1
+
+            label = name
+            if reading == "state":
+                label = describe(reading, arg)["state"]
+            elif reading == "event" and phase != "E":
+                label = "%s %s" % (name, describe(reading, arg)["event"])
+            event = {"name": label, "cat": name, "ph": phase, "pid": 1, "tid": tid,
+                     "ts": cycles * 1e6 / hz, "args": describe(reading, arg)}
+            if phase == "i":
+                event["s"] = "t"
+            events.append(event)
+
+    for track, tid in tracks.items():
+        events.append({"name": "thread_name", "ph": "M", "pid": 1, "tid": tid, "args": {"name": track}})
+        events.append({"name": "thread_sort_index", "ph": "M", "pid": 1, "tid": tid, "args": {"sort_index": tid}})
+    events.append({"name": "process_name", "ph": "M", "pid": 1, "args": {"name": "UART Chat"}})
+
+    return events, stats
+
+
+def capture_port(path, baud, seconds):
+    """Reads a serial port or a simulated terminal for a while."""
+    fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+    data = b""
+
+    try:
+        tty.setraw(fd)
+        attrs = termios.tcgetattr(fd)
+        attrs[4] = attrs[5] = BAUD_CONSTANTS[baud]
+        termios.tcsetattr(fd, termios.TCSANOW, attrs)
+
+        deadline = time.monotonic() + seconds
+        while True:
+            left = deadline - time.monotonic()
+            if left <= 0:
+                break
+            ready, _, _ = select.select([fd], [], [], left)
+            if ready:
+                data += os.read(fd, 4096)
+    finally:
+        os.close(fd)
+
+    return data
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Turns the trace bursts of the firmware into a Perfetto trace.")
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("capture", nargs="?", help="file holding what the board wrote on UART0, - for stdin")
+    source.add_argument("--port", help="serial port of the board to capture from")
+    parser.add_argument("--baud", type=int, default=115200, choices=sorted(BAUD_CONSTANTS))
+    parser.add_argument("--seconds", type=float, default=10.0, help="capture time with --port")
+    parser.add_argument("--output", help="file where the trace is stored")
+    args = parser.parse_args()
+
+    if args.port is not None:
+        capture = capture_port(args.port, args.baud, args.seconds)
+    elif args.capture == "-":
+        capture = sys.stdin.buffer.read()
+    else:
+        with open(args.capture, "rb") as source_file:
+            capture = source_file.read()
+
+    events, stats = convert(capture)
+    text = json.dumps({"traceEvents": events, "displayTimeUnit": "ns"})
+
+    if args.output is not None:
+        with open(args.output, "w") as output:
+            output.write(text)
+    else:
+        sys.stdout.write(text + "\n")
+
+    sys.stderr.write("%(bursts)d bursts, %(records)d records, %(lost)d lost, "
+                     "%(bad_crc)d bad CRC, %(truncated)d truncated\n" % stats)
+
+    return 0 if stats["bursts"] != 0 else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())